@@ -0,0 +1,60 @@
+//
+//  CoreWorkloadBenchmark.swift
+//  OpenSwiftUIBenchmark
+
+import Benchmark
+import OpenSwiftUICore
+
+/// Runs the headless workloads of OpenSwiftUICore, reporting the wall clock
+/// percentiles and the number of allocations of each.
+func coreWorkloadBenchmarks() {
+    var workloads: [_BenchmarkWorkload] = []
+    #if !OPENSWIFTUI_SWIFTUI_RENDERER
+    for children in [10, 1_000] {
+        workloads.append(.viewGraphInstantiation(children: children))
+    }
+    for children in [10, 1_000, 100_000] {
+        workloads.append(.stackLayout(children: children))
+    }
+    for columns in [10, 100] {
+        workloads.append(.nestedStackLayout(columns: columns))
+    }
+    for count in [10, 1_000] {
+        workloads.append(.forEachUpdate(count: count))
+    }
+    #endif
+    for depth in [10, 100, 1_000] {
+        workloads.append(.propertyListLookup(depth: depth))
+    }
+    for depth in [20, 100, 400] {
+        workloads.append(.environmentLookup(depth: depth))
+    }
+    for items in [100, 10_000] {
+        workloads.append(.displayListEncoding(items: items))
+        workloads.append(.displayListDecoding(items: items))
+        workloads.append(.displayListCanonicalization(items: items))
+    }
+    for items in [1_000, 10_000] {
+        workloads.append(.nestedDisplayListEncoding(items: items))
+    }
+    for elements in [100, 10_000] {
+        workloads.append(.pathArchiving(elements: elements))
+    }
+    for parallel in [false, true] {
+        workloads.append(.flatDisplayListCanonicalization(items: 50_000, parallel: parallel))
+    }
+    for workload in workloads {
+        let configuration = Benchmark.Configuration(
+            metrics: [.wallClock, .mallocCountTotal, .peakMemoryResident],
+            maxDuration: .seconds(5),
+            maxIterations: workload.size >= 10_000 ? 10 : 1_000
+        )
+        Benchmark(workload.name, configuration: configuration) { benchmark, body in
+            for _ in benchmark.scaledIterations {
+                body()
+            }
+        } setup: {
+            workload.prepare()
+        }
+    }
+}
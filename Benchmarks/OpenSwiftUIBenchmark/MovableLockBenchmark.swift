@@ -0,0 +1,66 @@
+//
+//  MovableLockBenchmark.swift
+//  OpenSwiftUIBenchmark
+
+import Benchmark
+import Foundation
+import OpenSwiftUI_SPI
+
+extension BenchmarkMetric {
+    static let lockWaitTime = BenchmarkMetric.custom("Lock wait per update (ns)", polarity: .prefersSmaller, useScalingFactor: false)
+    static let lockHoldTime = BenchmarkMetric.custom("Lock hold per update (ns)", polarity: .prefersSmaller, useScalingFactor: false)
+}
+
+/// Simulates `Update.begin()` / `Update.end()` pairs issued from several
+/// threads at once and reports how long each update waited for and held the
+/// lock.
+func movableLockBenchmarks() {
+    let updatesPerThread = 1_000
+    for threadCount in [1, 4, 8] {
+        Benchmark(
+            "MovableLock contention (\(threadCount) threads)",
+            configuration: .init(metrics: [.wallClock, .lockWaitTime, .lockHoldTime])
+        ) { benchmark in
+            let lock = MovableLock()
+            defer { lock.destroy() }
+            let waits = UnsafeMutableBufferPointer<UInt64>.allocate(capacity: threadCount)
+            let holds = UnsafeMutableBufferPointer<UInt64>.allocate(capacity: threadCount)
+            defer {
+                waits.deallocate()
+                holds.deallocate()
+            }
+            waits.initialize(repeating: 0)
+            holds.initialize(repeating: 0)
+
+            benchmark.startMeasurement()
+            DispatchQueue.concurrentPerform(iterations: threadCount) { index in
+                var wait: UInt64 = 0
+                var hold: UInt64 = 0
+                for _ in 0 ..< updatesPerThread {
+                    let start = DispatchTime.now().uptimeNanoseconds
+                    lock.lock()
+                    let acquired = DispatchTime.now().uptimeNanoseconds
+                    // Nested update, as issued by Update.ensure { Update.begin() }
+                    lock.lock()
+                    var value = 0
+                    for i in 0 ..< 64 {
+                        value &+= i
+                    }
+                    blackHole(value)
+                    lock.unlock()
+                    let released = DispatchTime.now().uptimeNanoseconds
+                    lock.unlock()
+                    wait &+= acquired - start
+                    hold &+= released - acquired
+                }
+                waits[index] = wait
+                holds[index] = hold
+            }
+            benchmark.stopMeasurement()
+
+            let updates = UInt64(threadCount * updatesPerThread)
+            benchmark.measurement(.lockWaitTime, Int(waits.reduce(0, +) / updates))
+            benchmark.measurement(.lockHoldTime, Int(holds.reduce(0, +) / updates))
+        }
+    }
+}
@@ -0,0 +1,54 @@
+//
+//  PathBooleanBenchmark.swift
+//  OpenSwiftUIBenchmark
+
+import Benchmark
+import Foundation
+import OpenSwiftUICore
+
+/// Returns a closed star-shaped polygon with `count` segments whose edges
+/// zigzag between two radii, so that overlapping stars cross on almost
+/// every segment.
+private func starPath(segments count: Int, center: CGPoint, radius: CGFloat) -> Path {
+    var path = Path()
+    path.addLines((0 ..< count).map { index in
+        let angle = CGFloat(index) / CGFloat(count) * 2 * .pi
+        let r = index.isMultiple(of: 2) ? radius : radius * 0.8
+        return CGPoint(x: center.x + r * cos(angle), y: center.y + r * sin(angle))
+    })
+    path.closeSubpath()
+    return path
+}
+
+/// Combines two overlapping stars of 10 to 100k segments each.
+func pathBooleanBenchmarks() {
+    for count in [10, 100, 1_000, 10_000, 100_000] {
+        let lhs = starPath(segments: count, center: CGPoint(x: 100, y: 100), radius: 100)
+        let rhs = starPath(segments: count, center: CGPoint(x: 140, y: 120), radius: 90)
+        let configuration = Benchmark.Configuration(
+            metrics: [.wallClock, .mallocCountTotal],
+            maxDuration: .seconds(5),
+            maxIterations: count >= 10_000 ? 10 : 1_000
+        )
+        Benchmark("Path union (\(count) segments)", configuration: configuration) { benchmark in
+            for _ in benchmark.scaledIterations {
+                blackHole(lhs.union(rhs))
+            }
+        }
+        Benchmark("Path intersection (\(count) segments)", configuration: configuration) { benchmark in
+            for _ in benchmark.scaledIterations {
+                blackHole(lhs.intersection(rhs))
+            }
+        }
+        Benchmark("Path subtracting (\(count) segments)", configuration: configuration) { benchmark in
+            for _ in benchmark.scaledIterations {
+                blackHole(lhs.subtracting(rhs, eoFill: true))
+            }
+        }
+        Benchmark("Path lineIntersection (\(count) segments)", configuration: configuration) { benchmark in
+            for _ in benchmark.scaledIterations {
+                blackHole(lhs.lineIntersection(rhs))
+            }
+        }
+    }
+}
@@ -8,7 +8,7 @@
 import Benchmark
 
 let benchmarks = {
-    Benchmark("Minimal benchmark") { _ in
-      // measure something here
-    }
+    movableLockBenchmarks()
+    pathBooleanBenchmarks()
+    coreWorkloadBenchmarks()
 }
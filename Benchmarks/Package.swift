@@ -4,6 +4,10 @@
 import Foundation
 import PackageDescription
 
+// Mirrors the SWIFTUI_RENDERER setting of OpenSwiftUI, which leaves out the
+// workloads driving the OpenSwiftUI renderer.
+let swiftUIRenderCondition = ProcessInfo.processInfo.environment["OPENSWIFTUI_SWIFTUI_RENDERER"] == "1"
+
 let package = Package(
     name: "OpenSwiftUIBenchmark",
     platforms: [
@@ -21,8 +25,13 @@ let package = Package(
               name: "OpenSwiftUIBenchmark",
               dependencies: [
                   .product(name: "Benchmark", package: "package-benchmark"),
+                  .product(name: "OpenSwiftUI_SPI", package: "OpenSwiftUI"),
+                  .product(name: "OpenSwiftUICore", package: "OpenSwiftUI"),
               ],
               path: "OpenSwiftUIBenchmark",
+              swiftSettings: swiftUIRenderCondition ? [
+                  .define("OPENSWIFTUI_SWIFTUI_RENDERER", .when(platforms: [.macOS])),
+              ] : [],
               plugins: [
                   .plugin(name: "BenchmarkPlugin", package: "package-benchmark"),
               ]
@@ -267,7 +267,7 @@ extension TimelineView: View, PrimitiveView, UnaryView where Content: View {
         #endif
     }
 
-    private struct UpdateFilter: StatefulRule, AsyncAttribute {
+    private struct UpdateFilter: StatefulRule, AsyncAttribute, ObservedAttribute {
         @Attribute var view: TimelineView
         @Attribute var schedule: Schedule
         @Attribute var phase: _GraphInputs.Phase
@@ -285,6 +285,10 @@ extension TimelineView: View, PrimitiveView, UnaryView where Content: View {
         var currentTime: Double
         var nextTime: Double
         var cadence: Context.Cadence
+        /* OpenSwiftUI Addition Begin */
+        let timelineID = UniqueID()
+        weak var timelineScheduler: TimelineScheduler?
+        /* OpenSwiftUI Addition End */
 
         #if (os(iOS) || os(visionOS)) && OPENSWIFTUI_LINK_BACKLIGHTSERVICES
         init(
@@ -449,13 +453,31 @@ extension TimelineView: View, PrimitiveView, UnaryView where Content: View {
                     }
                 }
             }
+            /* OpenSwiftUI Addition Begin */
+            // The deadline is coalesced with those of the other timelines of
+            // the graph, so that timelines with close entries share updates.
+            let viewGraph = ViewGraph.current
+            timelineScheduler = viewGraph.timelineScheduler
             if nextTime != .infinity {
                 let interval = nextTime - currentReferenceTime
-                let viewGraph = ViewGraph.current
                 let nextUpdateTime = interval + time
-                viewGraph.nextUpdate.views.at(nextUpdateTime)
+                let wakeTime = viewGraph.timelineScheduler.schedule(
+                    timelineID,
+                    at: nextUpdateTime,
+                    interval: nextTime - currentTime
+                )
+                viewGraph.nextUpdate.views.at(wakeTime)
+            } else {
+                viewGraph.timelineScheduler.cancel(timelineID)
             }
+            /* OpenSwiftUI Addition End */
+        }
+
+        /* OpenSwiftUI Addition Begin */
+        mutating func destroy() {
+            timelineScheduler?.cancel(timelineID)
         }
+        /* OpenSwiftUI Addition End */
 
         #if (os(iOS) || os(visionOS)) && OPENSWIFTUI_LINK_BACKLIGHTSERVICES
         mutating func updateFromBacklightServices(frameSpecifier: BLSAlwaysOnFrameSpecifier) -> Bool {
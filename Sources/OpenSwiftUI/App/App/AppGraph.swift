@@ -75,6 +75,7 @@ package final class AppGraph: GraphHost {
     init<Application>(app: Application) where Application: App {
         /* OpenSwiftUI Addition Begin */
         rendererConfiguration = Application.rendererConfiguration
+        RuntimeMetadataSnapshot.beginLaunch()
         /* OpenSwiftUI Addition End */
         makeRootScene = { inputs in
             let fields = DynamicPropertyCache.fields(of: Application.self)
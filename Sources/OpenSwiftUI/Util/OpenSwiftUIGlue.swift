@@ -63,6 +63,10 @@ final public class OpenSwiftUIGlue: CoreGlue {
         MakeDefaultLayoutComputerResult(value: graph.viewGraph().$defaultLayoutComputer)
     }
 
+    override final public func startChildGeometries(_ params: StartChildGeometriesParameters) {}
+
+    override final public func endChildGeometries(_ params: EndChildGeometriesParameters) {}
+
     override final public func makeLayoutView<L>(
         root: _GraphValue<L>,
         inputs: _ViewInputs,
@@ -0,0 +1,228 @@
+//
+//  TimelineScheduler.swift
+//  OpenSwiftUICore
+//
+//  Status: Complete
+
+/* OpenSwiftUI Addition Begin */
+
+// MARK: - TimelineScheduler
+
+/// The next deadlines of the timelines of a view graph, such as those of
+/// `TimelineView`, merged so that deadlines close to each other are served
+/// by a single graph update.
+///
+/// Each timeline schedules its next deadline with a tolerance. The graph
+/// wakes at the earliest time that is within the tolerance of every pending
+/// deadline it passes, so timelines whose entries fall a few milliseconds
+/// apart update together instead of each waking the graph on its own.
+/// Deadlines are only ever served late, never early.
+///
+/// The deadlines are kept in a binary min-heap indexed by timeline, so that
+/// rescheduling or cancelling a timeline is logarithmic in the number of
+/// timelines.
+package final class TimelineScheduler {
+    /// The longest time a deadline can be delayed to share an update with
+    /// other deadlines.
+    ///
+    /// The tolerance of a timeline is also limited to a tenth of the
+    /// interval between its entries, so that fast timelines, such as
+    /// animation schedules, aren't visibly delayed.
+    package var tolerance: Double
+
+    /// The counters of the deadlines served so far.
+    package private(set) var statistics = Statistics()
+
+    private var heap: [Entry] = []
+
+    private var positions: [UniqueID: Int] = [:]
+
+    /// Creates a scheduler.
+    ///
+    /// - Parameter tolerance: The longest time a deadline can be delayed.
+    package init(tolerance: Double = 0.1) {
+        self.tolerance = tolerance
+    }
+
+    /// The number of timelines with a pending deadline.
+    package var count: Int {
+        heap.count
+    }
+
+    /// Schedules the next deadline of a timeline, replacing its previous
+    /// deadline.
+    ///
+    /// - Parameters:
+    ///   - id: The identifier of the timeline.
+    ///   - deadline: The time of the next entry of the timeline.
+    ///   - interval: The time between the current and the next entries of
+    ///     the timeline.
+    /// - Returns: The time at which the graph should be updated.
+    @discardableResult
+    package func schedule(_ id: UniqueID, at deadline: Time, interval: Double) -> Time {
+        let entry = Entry(
+            id: id,
+            deadline: deadline,
+            tolerance: max(interval.isFinite ? min(tolerance, interval * 0.1) : tolerance, 0)
+        )
+        if let position = positions[id] {
+            let oldDeadline = heap[position].deadline
+            heap[position] = entry
+            if deadline < oldDeadline {
+                siftUp(from: position)
+            } else {
+                siftDown(from: position)
+            }
+        } else {
+            heap.append(entry)
+            positions[id] = heap.count - 1
+            siftUp(from: heap.count - 1)
+        }
+        return wakeTime
+    }
+
+    /// Removes the pending deadline of a timeline.
+    ///
+    /// - Parameter id: The identifier of the timeline.
+    package func cancel(_ id: UniqueID) {
+        guard let position = positions.removeValue(forKey: id) else {
+            return
+        }
+        let last = heap.removeLast()
+        guard position < heap.count else {
+            return
+        }
+        heap[position] = last
+        positions[last.id] = position
+        siftDown(from: position)
+        siftUp(from: positions[last.id]!)
+    }
+
+    /// The time at which the graph should be updated for the pending
+    /// deadlines, or `infinity` if there are none.
+    ///
+    /// This is the earliest time by which some deadline reaches the end of
+    /// its tolerance. Only the deadlines before that time are visited: a
+    /// subtree of the heap whose root is later can't end sooner.
+    package var wakeTime: Time {
+        guard !heap.isEmpty else {
+            return .infinity
+        }
+        var wakeTime = Time.infinity
+        var stack = [0]
+        while let position = stack.popLast() {
+            let entry = heap[position]
+            guard entry.deadline < wakeTime else {
+                continue
+            }
+            wakeTime = min(wakeTime, entry.deadline + entry.tolerance)
+            let child = 2 * position + 1
+            if child < heap.count {
+                stack.append(child)
+            }
+            if child + 1 < heap.count {
+                stack.append(child + 1)
+            }
+        }
+        return wakeTime
+    }
+
+    /// Removes the deadlines that are due at `time`, counting them as served
+    /// by one update.
+    ///
+    /// - Parameter time: The time of the update.
+    package func advance(to time: Time) {
+        var deadlineCount = 0
+        var lastDeadline: Time?
+        while let first = heap.first, first.deadline <= time {
+            // Timelines with equal deadlines would have shared an update
+            // anyway, so they are counted once.
+            if first.deadline != lastDeadline {
+                deadlineCount += 1
+                lastDeadline = first.deadline
+            }
+            cancel(first.id)
+        }
+        guard deadlineCount != 0 else {
+            return
+        }
+        statistics.wakeups += 1
+        statistics.deadlines += deadlineCount
+    }
+
+    /// Removes every pending deadline and resets the counters.
+    package func reset() {
+        heap = []
+        positions = [:]
+        statistics = Statistics()
+    }
+
+    // MARK: - TimelineScheduler.Statistics
+
+    /// Counters of the deadlines served by a scheduler.
+    package struct Statistics: Equatable {
+        /// The number of updates that served at least one deadline.
+        package var wakeups = 0
+
+        /// The number of distinct deadlines served, that is, the number of
+        /// updates needed without coalescing.
+        package var deadlines = 0
+
+        /// The number of updates saved by coalescing deadlines.
+        package var savedWakeups: Int {
+            deadlines - wakeups
+        }
+
+        package init() {}
+    }
+
+    // MARK: - Heap
+
+    private struct Entry {
+        var id: UniqueID
+
+        var deadline: Time
+
+        var tolerance: Double
+    }
+
+    private func siftUp(from position: Int) {
+        var position = position
+        let entry = heap[position]
+        while position > 0 {
+            let parent = (position - 1) / 2
+            guard entry.deadline < heap[parent].deadline else {
+                break
+            }
+            heap[position] = heap[parent]
+            positions[heap[position].id] = position
+            position = parent
+        }
+        heap[position] = entry
+        positions[entry.id] = position
+    }
+
+    private func siftDown(from position: Int) {
+        var position = position
+        let entry = heap[position]
+        while true {
+            var child = 2 * position + 1
+            guard child < heap.count else {
+                break
+            }
+            if child + 1 < heap.count, heap[child + 1].deadline < heap[child].deadline {
+                child += 1
+            }
+            guard heap[child].deadline < entry.deadline else {
+                break
+            }
+            heap[position] = heap[child]
+            positions[heap[position].id] = position
+            position = child
+        }
+        heap[position] = entry
+        positions[entry.id] = position
+    }
+}
+
+/* OpenSwiftUI Addition End */
@@ -243,6 +243,8 @@ package struct DynamicPropertyCache {
                 fields.behaviors.subtract(.allowsAsync)
             }
             cache.wrappedValue[identifier] = fields
+            // OpenSwiftUI Addition: record the type for the runtime metadata snapshot
+            RuntimeMetadataSnapshot.recordFieldLayout(of: type)
             return fields
         }
         return fields
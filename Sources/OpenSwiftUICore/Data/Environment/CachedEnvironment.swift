@@ -15,7 +15,7 @@ package import OpenAttributeGraphShims
 package struct CachedEnvironment {
     package private(set) var environment: Attribute<EnvironmentValues>
 
-    package struct ID: Equatable {
+    package struct ID: Hashable {
         package var base: UniqueID
 
         package init() {
@@ -23,16 +23,28 @@ package struct CachedEnvironment {
         }
     }
 
+    /* OpenSwiftUI Addition Begin */
+    private enum MapKey: Hashable {
+        case id(CachedEnvironment.ID)
+        case resolvedShapeStyles(ResolvedShapeStyles)
+    }
+    /* OpenSwiftUI Addition End */
+
     private struct MapItem {
-        var key: CachedEnvironment.ID
+        var key: MapKey
         var value: AnyAttribute
     }
 
+    /// The attributes derived from the environment, in the order they were
+    /// created.
     private var mapItems: [MapItem]
 
-    private var animatedFrame: AnimatedFrame?
+    /* OpenSwiftUI Addition Begin */
+    /// The index in `mapItems` of every key.
+    private var mapIndices: [MapKey: Int]
+    /* OpenSwiftUI Addition End */
 
-    private var resolvedShapeStyles: [ResolvedShapeStyles: Attribute<ShapeStyle.Pack>]
+    private var animatedFrame: AnimatedFrame?
 
     struct PlatformCache {}
 
@@ -42,21 +54,44 @@ package struct CachedEnvironment {
     init(_ environment: Attribute<EnvironmentValues>) {
         self.environment = environment
         self.mapItems = []
+        self.mapIndices = [:]
         self.animatedFrame = nil
-        self.resolvedShapeStyles = [:]
         self.platformCache = PlatformCache()
     }
 
     package mutating func attribute<T>(id: CachedEnvironment.ID, _ body: @escaping (EnvironmentValues) -> T) -> Attribute<T> {
-        guard let item = mapItems.first(where: { $0.key == id }) else {
+        guard let index = mapIndices[.id(id)] else {
             let map = Map(environment, body)
             let attribute = Attribute(map)
-            mapItems.append(MapItem(key: id, value: attribute.identifier))
+            insert(attribute.identifier, for: .id(id))
             return attribute
         }
-        return item.value.unsafeCast(to: T.self)
+        return mapItems[index].value.unsafeCast(to: T.self)
+    }
+
+    /* OpenSwiftUI Addition Begin */
+    /// The number of attributes derived from the environment.
+    package var mapCount: Int {
+        mapItems.count
     }
 
+    private mutating func insert(_ value: AnyAttribute, for key: MapKey) {
+        mapIndices[key] = mapItems.count
+        mapItems.append(MapItem(key: key, value: value))
+        let count = mapItems.count
+        // Report each power of two, so that the size a map reaches can be
+        // read from a trace without an event per attribute.
+        if count >= 16, count & (count - 1) == 0 {
+            Signpost.cachedEnvironment.traceEvent(
+                type: .event,
+                object: nil,
+                "CachedEnvironment: map of environment %u reached %ld attributes",
+                [environment.identifier.rawValue, count]
+            )
+        }
+    }
+    /* OpenSwiftUI Addition End */
+
     mutating func resolvedShapeStyles(
         for inputs: _ViewInputs,
         role: ShapeRole,
@@ -74,14 +109,14 @@ package struct CachedEnvironment {
             role: role,
             animationsDisabled: inputs.base.animationsDisabled
         )
-        guard let styles = resolvedShapeStyles[resolved] else {
+        guard let index = mapIndices[.resolvedShapeStyles(resolved)] else {
             let styles = resolved.makeStyles()
             if mode == nil {
-                resolvedShapeStyles[resolved] = styles
+                insert(styles.identifier, for: .resolvedShapeStyles(resolved))
             }
             return styles
         }
-        return styles
+        return mapItems[index].value.unsafeCast(to: ShapeStyle.Pack.self)
     }
 }
 
@@ -0,0 +1,163 @@
+//
+//  ProtobufDecoder+Mapping.swift
+//  OpenSwiftUICore
+//
+//  Status: Complete
+
+/* OpenSwiftUI Addition Begin */
+
+package import Foundation
+
+// MARK: - ProtobufDecoder + Mapping
+
+extension ProtobufDecoder {
+    /// Creates an instance that decodes the contents of a file mapped into
+    /// memory.
+    ///
+    /// Pages of the file are only read when the decoder, or a value borrowed
+    /// from it, touches them, so opening a large archive costs little more
+    /// than the fields that are actually decoded. The mapping lives as long
+    /// as the decoder or any `Bytes` or `ProtobufLazyMessage` made from it.
+    ///
+    /// - Parameter url: The URL of a local file.
+    package init(mappingContentsOf url: URL) throws {
+        #if os(WASI)
+        self.init(try Data(contentsOf: url))
+        #else
+        let descriptor = open(url.path, O_RDONLY)
+        guard descriptor >= 0 else {
+            throw POSIXError(POSIXErrorCode(rawValue: errno) ?? .EIO)
+        }
+        defer { close(descriptor) }
+        var info = stat()
+        guard fstat(descriptor, &info) == 0 else {
+            throw POSIXError(POSIXErrorCode(rawValue: errno) ?? .EIO)
+        }
+        let count = Int(info.st_size)
+        guard count > 0 else {
+            self.init(Data())
+            return
+        }
+        guard let address = mmap(nil, count, PROT_READ, MAP_PRIVATE, descriptor, 0),
+              address != UnsafeMutableRawPointer(bitPattern: -1) else {
+            throw POSIXError(POSIXErrorCode(rawValue: errno) ?? .EIO)
+        }
+        let data = NSData(bytesNoCopy: address, length: count) { address, count in
+            munmap(address, count)
+        }
+        self.init(data, range: 0 ..< count)
+        #endif
+    }
+
+    // MARK: - ProtobufDecoder.Bytes
+
+    /// The bytes of a length-delimited field, borrowed from the data of the
+    /// decoder that read them.
+    ///
+    /// Unlike `dataField(_:)` and `stringField(_:)`, reading a field as bytes
+    /// never copies it. The bytes keep the data of the decoder alive.
+    package struct Bytes: RandomAccessCollection {
+        private let owner: NSData
+
+        private let buffer: UnsafeRawBufferPointer
+
+        fileprivate init(owner: NSData, buffer: UnsafeRawBufferPointer) {
+            self.owner = owner
+            self.buffer = buffer
+        }
+
+        package var startIndex: Int { buffer.startIndex }
+
+        package var endIndex: Int { buffer.endIndex }
+
+        package subscript(position: Int) -> UInt8 {
+            withExtendedLifetime(owner) { buffer[position] }
+        }
+
+        /// Calls `body` with a pointer to the bytes.
+        package func withUnsafeBytes<R>(_ body: (UnsafeRawBufferPointer) throws -> R) rethrows -> R {
+            try withExtendedLifetime(owner) { try body(buffer) }
+        }
+
+        /// The bytes as data sharing the storage of the decoder.
+        package var data: Data {
+            guard let baseAddress = buffer.baseAddress else {
+                return Data()
+            }
+            let startIndex = baseAddress - owner.bytes
+            return (owner as Data)[startIndex ..< startIndex + buffer.count]
+        }
+
+        /// The bytes decoded as a UTF-8 string, or `nil` if they aren't valid
+        /// UTF-8.
+        package var string: String? {
+            withUnsafeBytes { String(bytes: $0, encoding: .utf8) }
+        }
+
+        /// Returns whether the bytes are the UTF-8 encoding of `string`,
+        /// without decoding them.
+        package func isEqual(to string: String) -> Bool {
+            withUnsafeBytes { string.utf8.elementsEqual($0) }
+        }
+    }
+
+    /// Decodes the bytes of a length-delimited field without copying them.
+    ///
+    /// - Parameter field: The field to decode.
+    /// - Returns: The bytes of the field.
+    package mutating func bytesField(_ field: ProtobufDecoder.Field) throws -> Bytes {
+        Bytes(owner: data, buffer: try dataBufferField(field))
+    }
+
+    /// Skips a message field, returning a value that decodes it on demand.
+    ///
+    /// - Parameter field: The field to skip.
+    /// - Returns: The undecoded message.
+    package mutating func lazyMessageField<T>(_ field: ProtobufDecoder.Field) throws -> ProtobufLazyMessage<T> where T: ProtobufDecodableMessage {
+        let buffer = try dataBufferField(field)
+        let startIndex = buffer.baseAddress.map { $0 - data.bytes } ?? 0
+        return ProtobufLazyMessage(
+            data: data,
+            range: startIndex ..< startIndex + buffer.count,
+            userInfo: userInfo
+        )
+    }
+}
+
+// MARK: - ProtobufLazyMessage
+
+/// A message field whose decoding is deferred until its value is needed.
+///
+/// Reading a lazy message only records where its bytes are, so a decoder can
+/// step over large nested messages, such as the payloads of an archive, and
+/// decode only those that are used.
+package struct ProtobufLazyMessage<Message> where Message: ProtobufDecodableMessage {
+    private let data: NSData
+
+    private let range: Range<Int>
+
+    private let userInfo: [CodingUserInfoKey: Any]
+
+    fileprivate init(data: NSData, range: Range<Int>, userInfo: [CodingUserInfoKey: Any]) {
+        self.data = data
+        self.range = range
+        self.userInfo = userInfo
+    }
+
+    /// The size of the encoded message, in bytes.
+    package var byteCount: Int {
+        range.count
+    }
+
+    /// Decodes the message.
+    ///
+    /// Each call decodes the message again, with the user info of the
+    /// decoder it was read from.
+    package func decode() throws -> Message {
+        var decoder = ProtobufDecoder(data, range: range)
+        decoder.userInfo = userInfo
+        return try Message(from: &decoder)
+    }
+}
+
+/* OpenSwiftUI Addition End */
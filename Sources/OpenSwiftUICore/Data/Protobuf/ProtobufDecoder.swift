@@ -51,6 +51,18 @@ package struct ProtobufDecoder {
         self.end = ptr + data.count
         self.packedEnd = ptr
     }
+
+    /* OpenSwiftUI Addition Begin */
+    /// Creates an instance that decodes the bytes of `data` in `range`,
+    /// sharing its storage.
+    init(_ data: NSData, range: Range<Int>) {
+        self.data = data
+        let ptr = data.bytes + range.lowerBound
+        self.ptr = ptr
+        self.end = ptr + range.count
+        self.packedEnd = ptr
+    }
+    /* OpenSwiftUI Addition End */
 }
 
 extension ProtobufDecoder {
@@ -418,6 +430,25 @@ extension ProtobufDecoder {
 extension ProtobufDecoder {
     /// Decodes a varint from the data.
     private mutating func decodeVarint() throws -> UInt {
+        /* OpenSwiftUI Addition Begin */
+        // With 8 bytes available, a varint of up to 8 bytes is decoded from
+        // a single load: the first byte without its continuation bit ends
+        // the varint, and the 7-bit groups before it are packed together
+        // with shifts instead of one byte at a time.
+        if end - ptr >= 8 {
+            let word = UInt64(littleEndian: ptr.loadUnaligned(as: UInt64.self))
+            let terminators = ~word & 0x8080_8080_8080_8080
+            if terminators != 0 {
+                let lowestTerminator = terminators & (0 &- terminators)
+                var bits = word & (lowestTerminator | (lowestTerminator &- 1)) & 0x7F7F_7F7F_7F7F_7F7F
+                bits = (bits & 0x007F_007F_007F_007F) | ((bits & 0x7F00_7F00_7F00_7F00) &>> 1)
+                bits = (bits & 0x0000_3FFF_0000_3FFF) | ((bits & 0x3FFF_0000_3FFF_0000) &>> 2)
+                bits = (bits & 0x0000_0000_0FFF_FFFF) | ((bits & 0x0FFF_FFFF_0000_0000) &>> 4)
+                ptr += terminators.trailingZeroBitCount &>> 3 &+ 1
+                return UInt(truncatingIfNeeded: bits)
+            }
+        }
+        /* OpenSwiftUI Addition End */
         var value: UInt = 0
         var shift: UInt = 0
         while true {
@@ -500,3 +531,139 @@ extension ProtobufDecoder {
         #endif
     }
 }
+
+/* OpenSwiftUI Addition Begin */
+
+// MARK: - ProtobufDecoder + Repeated fields
+
+extension ProtobufDecoder {
+    /// Decodes the values of a repeated float field, appending them to
+    /// `values`.
+    ///
+    /// A packed field is decoded at once, copying all of its values instead
+    /// of returning to `nextField()` for each of them.
+    ///
+    /// - Parameters:
+    ///   - field: The field to decode.
+    ///   - values: The array to append the values to.
+    package mutating func floatsField(_ field: ProtobufDecoder.Field, into values: inout [Float]) throws {
+        guard let buffer = try packedBuffer(field, wireType: .fixed32, stride: 4) else {
+            values.append(try floatField(field))
+            return
+        }
+        values.appendBitPatterns(of: buffer)
+    }
+
+    /// Decodes the values of a repeated double field, appending them to
+    /// `values`.
+    ///
+    /// A packed field is decoded at once, copying all of its values instead
+    /// of returning to `nextField()` for each of them.
+    ///
+    /// - Parameters:
+    ///   - field: The field to decode.
+    ///   - values: The array to append the values to.
+    package mutating func doublesField(_ field: ProtobufDecoder.Field, into values: inout [Double]) throws {
+        guard let buffer = try packedBuffer(field, wireType: .fixed64, stride: 8) else {
+            values.append(try doubleField(field))
+            return
+        }
+        values.appendBitPatterns(of: buffer)
+    }
+
+    /// Decodes the values of a repeated CGFloat field, appending them to
+    /// `values`.
+    ///
+    /// - Parameters:
+    ///   - field: The field to decode.
+    ///   - values: The array to append the values to.
+    package mutating func cgFloatsField(_ field: ProtobufDecoder.Field, into values: inout [CGFloat]) throws {
+        guard MemoryLayout<CGFloat>.size == MemoryLayout<Double>.size,
+              let buffer = try packedBuffer(field, wireType: .fixed64, stride: 8) else {
+            values.append(try cgFloatField(field))
+            return
+        }
+        values.appendBitPatterns(of: buffer)
+    }
+
+    /// Decodes the values of a repeated varint field, appending them to
+    /// `values`.
+    ///
+    /// A packed field is decoded at once. Runs of 8 single-byte values,
+    /// the common case for small enumerations and counts, are decoded from
+    /// a single load.
+    ///
+    /// - Parameters:
+    ///   - field: The field to decode.
+    ///   - values: The array to append the values to.
+    package mutating func uintsField(_ field: ProtobufDecoder.Field, into values: inout [UInt]) throws {
+        guard let buffer = try packedBuffer(field, wireType: .varint, stride: 1),
+              let start = buffer.baseAddress else {
+            values.append(try uintField(field))
+            return
+        }
+        let runEnd = start + buffer.count
+        let oldEnd = end
+        end = runEnd
+        defer { end = oldEnd }
+        ptr = start
+        values.reserveCapacity(values.count + buffer.count)
+        while ptr < runEnd {
+            if runEnd - ptr >= 8 {
+                let word = UInt64(littleEndian: ptr.loadUnaligned(as: UInt64.self))
+                if word & 0x8080_8080_8080_8080 == 0 {
+                    for shift in stride(from: 0, to: 64, by: 8) {
+                        values.append(UInt(truncatingIfNeeded: (word &>> UInt64(shift)) & 0xFF))
+                    }
+                    ptr += 8
+                    continue
+                }
+            }
+            values.append(try decodeVarint())
+        }
+    }
+
+    /// Returns the bytes of the packed values of `field` and skips them, or
+    /// `nil` if `field` holds a single value.
+    ///
+    /// When `field` is the current packed field, the values that remain of
+    /// it are returned.
+    private mutating func packedBuffer(_ field: ProtobufDecoder.Field, wireType: WireType, stride: Int) throws -> UnsafeRawBufferPointer? {
+        let start: UnsafeRawPointer
+        let count: Int
+        switch field.wireType {
+        case .lengthDelimited:
+            count = try Int(decodeVarint())
+            start = ptr
+        case wireType where field == packedField && ptr < packedEnd:
+            count = packedEnd - ptr
+            start = ptr
+        default:
+            return nil
+        }
+        let newPtr = start.advanced(by: count)
+        guard newPtr <= end, count % stride == 0 else {
+            throw DecodingError.failed
+        }
+        ptr = newPtr
+        return UnsafeRawBufferPointer(start: start, count: count)
+    }
+}
+
+extension Array where Element: AdditiveArithmetic {
+    /// Appends the values whose bit patterns are stored, possibly unaligned,
+    /// in `buffer`.
+    fileprivate mutating func appendBitPatterns(of buffer: UnsafeRawBufferPointer) {
+        let count = buffer.count / MemoryLayout<Element>.stride
+        guard count > 0, let source = buffer.baseAddress else { return }
+        let oldCount = self.count
+        append(contentsOf: repeatElement(.zero, count: count))
+        withUnsafeMutableBytes { bytes in
+            bytes.baseAddress!
+                .advanced(by: oldCount * MemoryLayout<Element>.stride)
+                .copyMemory(from: source, byteCount: count * MemoryLayout<Element>.stride)
+        }
+    }
+}
+
+/* OpenSwiftUI Addition End */
@@ -32,6 +32,19 @@ package struct ProtobufEncoder {
     
     /// A stack of pointers for nested messages.
     var stack: [Int] = []
+
+    /* OpenSwiftUI Addition Begin */
+    /// The lengths of the length-delimited fields that need more than the
+    /// one byte reserved for them, with the position of that byte.
+    ///
+    /// The lengths are written when the data is taken, in a single pass
+    /// that moves every byte at most once, instead of moving the body of
+    /// each field as it ends.
+    var deferredLengths: [(position: Int, length: Int)] = []
+
+    /// The number of bytes the deferred lengths add to the encoded data.
+    var deferredByteCount: Int = 0
+    /* OpenSwiftUI Addition End */
     
     /// User-defined information.
     package var userInfo: [CodingUserInfoKey: Any] = [:]
@@ -43,8 +56,10 @@ package struct ProtobufEncoder {
     /// Takes the encoded data.
     ///
     /// - Returns: The encoded data.
-    private func takeData() -> Data {
-        if let buffer {
+    private mutating func takeData() -> Data {
+        // OpenSwiftUI Addition: write the deferred lengths
+        resolveDeferredLengths()
+        return if let buffer {
             Data(bytes: buffer, count: size)
         } else {
             Data()
@@ -109,49 +124,105 @@ package struct ProtobufEncoder {
         return newBuffer + oldSize
     }
     
+    /* OpenSwiftUI Addition Begin */
+    /// Begins a length-delimited field, reserving one byte for its length.
+    @inline(__always)
+    private mutating func beginLengthDelimited() {
+        stack.append(deferredByteCount)
+        stack.append(size)
+        size += 1
+    }
+
     /// Ends a length-delimited field.
+    ///
+    /// A length that doesn't fit in the reserved byte is deferred to
+    /// `resolveDeferredLengths()`, so that nested messages don't move their
+    /// body once per enclosing message.
     private mutating func endLengthDelimited() {
         let lengthPosition = stack.removeLast()
-        let length = size - (lengthPosition &+ 1)
-        if length <= 0x7F, size < capacity {
+        let deferredByteCountAtStart = stack.removeLast()
+        let length = size - (lengthPosition &+ 1) + (deferredByteCount - deferredByteCountAtStart)
+        guard length > 0x7F else {
+            if capacity < size {
+                _ = growBufferSlow(to: size)
+            }
             buffer.advanced(by: lengthPosition).storeBytes(
                 of: UInt8(truncatingIfNeeded: length),
                 as: UInt8.self
             )
             return
         }
+        deferredLengths.append((lengthPosition, length))
+        deferredByteCount += Self.varintByteCount(UInt(length)) - 1
+    }
 
-        let count: Int
-        if length <= 0x7F {
-            count = 1
-        } else {
-            let highBit = 64 - length.leadingZeroBitCount
-            count = (highBit + 6) / 7
-        }
+    /// Writes the deferred lengths, moving the bytes that follow each of them
+    /// to make room for its extra bytes.
+    private mutating func resolveDeferredLengths() {
+        guard !deferredLengths.isEmpty else { return }
+        deferredLengths.sort { $0.position < $1.position }
         let oldSize = size
-        let newSize = size + (count - 1)
-        var pointer: UnsafeMutableRawPointer
+        let newSize = oldSize + deferredByteCount
         if capacity < newSize {
-            pointer = growBufferSlow(to: newSize)
+            _ = growBufferSlow(to: newSize)
         } else {
             size = newSize
-            pointer = buffer.advanced(by: oldSize)
         }
-        let firstLengthBytePointer = pointer.advanced(by: -(length + 1))
-        memmove(
-            firstLengthBytePointer.advanced(by: count),
-            firstLengthBytePointer.advanced(by: 1),
-            length
-        )
-        var currentPointer = firstLengthBytePointer
-        var currentValue = length
+        // Segments are moved from the last to the first, so that each one
+        // is moved before the bytes it overwrites.
+        var segmentEnd = oldSize
+        var shift = deferredByteCount
+        for (position, length) in deferredLengths.reversed() {
+            let segmentStart = position + 1
+            memmove(
+                buffer.advanced(by: segmentStart + shift),
+                buffer.advanced(by: segmentStart),
+                segmentEnd - segmentStart
+            )
+            shift -= Self.varintByteCount(UInt(length)) - 1
+            Self.storeVarint(UInt(length), to: buffer.advanced(by: position + shift))
+            segmentEnd = position
+        }
+        deferredLengths = []
+        deferredByteCount = 0
+    }
+
+    /// Returns the number of bytes of the varint encoding of `value`.
+    @inline(__always)
+    static func varintByteCount(_ value: UInt) -> Int {
+        (UInt.bitWidth - (value | 1).leadingZeroBitCount + 6) / 7
+    }
+
+    /// Stores the varint encoding of `value` at `pointer`, returning the
+    /// pointer past its last byte.
+    @inline(__always)
+    @discardableResult
+    private static func storeVarint(_ value: UInt, to pointer: UnsafeMutableRawPointer) -> UnsafeMutableRawPointer {
+        var pointer = pointer
+        var currentValue = value
         while currentValue >= 0x80 {
-            currentPointer.storeBytes(of: UInt8(currentValue & 0x7F) | 0x80, as: UInt8.self)
-            currentPointer += 1
+            pointer.storeBytes(of: UInt8(currentValue & 0x7F) | 0x80, as: UInt8.self)
+            pointer += 1
             currentValue >>= 7
         }
-        currentPointer.storeBytes(of: UInt8(currentValue), as: UInt8.self)
+        pointer.storeBytes(of: UInt8(currentValue), as: UInt8.self)
+        return pointer + 1
+    }
+
+    /// Reserves `count` bytes at the end of the buffer, returning a pointer
+    /// to the first of them.
+    @inline(__always)
+    private mutating func reserveBytes(_ count: Int) -> UnsafeMutableRawPointer {
+        let oldSize = size
+        let newSize = oldSize + count
+        if capacity < newSize {
+            return growBufferSlow(to: newSize)
+        } else {
+            size = newSize
+            return buffer.advanced(by: oldSize)
+        }
     }
+    /* OpenSwiftUI Addition End */
 }
 
 extension ProtobufEncoder {
@@ -357,8 +428,8 @@ extension ProtobufEncoder {
     package mutating func packedField(_ tag: UInt, _ body: (inout ProtobufEncoder) -> Void) {
         let field = Field(tag, wireType: .lengthDelimited)
         encodeVarint(field.rawValue)
-        stack.append(size)
-        size += 1
+        // OpenSwiftUI Addition: record the deferred byte count with the length position
+        beginLengthDelimited()
         body(&self)
         endLengthDelimited()
     }
@@ -372,8 +443,8 @@ extension ProtobufEncoder {
     package mutating func messageField(_ tag: UInt, _ body: (inout ProtobufEncoder) throws -> Void) rethrows {
         let field = Field(tag, wireType: .lengthDelimited)
         encodeVarint(field.rawValue)
-        stack.append(size)
-        size += 1
+        // OpenSwiftUI Addition: record the deferred byte count with the length position
+        beginLengthDelimited()
         try body(&self)
         endLengthDelimited()
     }
@@ -490,8 +561,8 @@ extension ProtobufEncoder {
     package mutating func emptyField(_ tag: UInt) {
         let field = Field(tag, wireType: .lengthDelimited)
         encodeVarint(field.rawValue)
-        stack.append(size)
-        size += 1
+        // OpenSwiftUI Addition: record the deferred byte count with the length position
+        beginLengthDelimited()
         endLengthDelimited()
     }
 }
@@ -870,9 +941,95 @@ extension ProtobufEncoder {
     /// - Parameters:
     ///   - value: The value to encode.
     package mutating func encodeMessage<T>(_ value: T) throws where T: ProtobufEncodableMessage {
-        stack.append(size)
-        size += 1
+        // OpenSwiftUI Addition: record the deferred byte count with the length position
+        beginLengthDelimited()
         try value.encode(to: &self)
         endLengthDelimited()
     }
 }
+
+/* OpenSwiftUI Addition Begin */
+
+// MARK: - ProtobufEncoder + Repeated fields
+
+extension ProtobufEncoder {
+    /// Encodes a packed repeated float field.
+    ///
+    /// The length of the field is known from the number of values, so it is
+    /// written first and the values are copied after it in one step. Nothing
+    /// is encoded for an empty array.
+    ///
+    /// - Parameters:
+    ///   - tag: The tag of the field.
+    ///   - values: The values to encode.
+    package mutating func floatsField(_ tag: UInt, _ values: [Float]) {
+        values.withUnsafeBytes { packedFixedWidthField(tag, $0) }
+    }
+
+    /// Encodes a packed repeated double field.
+    ///
+    /// The length of the field is known from the number of values, so it is
+    /// written first and the values are copied after it in one step. Nothing
+    /// is encoded for an empty array.
+    ///
+    /// - Parameters:
+    ///   - tag: The tag of the field.
+    ///   - values: The values to encode.
+    package mutating func doublesField(_ tag: UInt, _ values: [Double]) {
+        values.withUnsafeBytes { packedFixedWidthField(tag, $0) }
+    }
+
+    /// Encodes a packed repeated CGFloat field, as doubles.
+    ///
+    /// - Parameters:
+    ///   - tag: The tag of the field.
+    ///   - values: The values to encode.
+    package mutating func cgFloatsField(_ tag: UInt, _ values: [CGFloat]) {
+        if MemoryLayout<CGFloat>.size == MemoryLayout<Double>.size {
+            values.withUnsafeBytes { packedFixedWidthField(tag, $0) }
+        } else {
+            doublesField(tag, values.map { Double($0) })
+        }
+    }
+
+    /// Encodes a packed repeated varint field.
+    ///
+    /// The size of each value is computed before encoding them, so the
+    /// length of the field is written first and the values are stored
+    /// directly after it. Nothing is encoded for an empty array.
+    ///
+    /// - Parameters:
+    ///   - tag: The tag of the field.
+    ///   - values: The values to encode.
+    package mutating func uintsField(_ tag: UInt, _ values: [UInt]) {
+        guard !values.isEmpty else { return }
+        var length = 0
+        for value in values {
+            length &+= Self.varintByteCount(value)
+        }
+        encodeVarint(Field(tag, wireType: .lengthDelimited).rawValue)
+        encodeVarint(UInt(length))
+        var pointer = reserveBytes(length)
+        if length == values.count {
+            for value in values {
+                pointer.storeBytes(of: UInt8(truncatingIfNeeded: value), as: UInt8.self)
+                pointer += 1
+            }
+        } else {
+            for value in values {
+                pointer = Self.storeVarint(value, to: pointer)
+            }
+        }
+    }
+
+    /// Encodes a packed field whose values are the fixed-width values of
+    /// `bytes`.
+    private mutating func packedFixedWidthField(_ tag: UInt, _ bytes: UnsafeRawBufferPointer) {
+        guard let baseAddress = bytes.baseAddress, !bytes.isEmpty else { return }
+        encodeVarint(Field(tag, wireType: .lengthDelimited).rawValue)
+        encodeVarint(UInt(bytes.count))
+        reserveBytes(bytes.count).copyMemory(from: baseAddress, byteCount: bytes.count)
+    }
+}
+
+/* OpenSwiftUI Addition End */
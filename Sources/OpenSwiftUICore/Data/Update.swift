@@ -70,7 +70,6 @@ package enum Update {
         lock()
         depth += 1
         if depth == 1 {
-            #if canImport(Darwin)
             Signpost.viewHost.traceEvent(
                 type: .begin,
                 object: trackHost,
@@ -80,14 +79,12 @@ package enum Update {
                     UInt(bitPattern: Unmanaged.passUnretained(trackHost).toOpaque()),
                 ]
             )
-            #endif
         }
     }
     
     package static func end() {
         if depth == 1 {
             dispatchActions()
-            #if canImport(Darwin)
             Signpost.viewHost.traceEvent(
                 type: .end,
                 object: trackHost,
@@ -97,7 +94,6 @@ package enum Update {
                     UInt(bitPattern: Unmanaged.passUnretained(trackHost).toOpaque()),
                 ]
             )
-            #endif
         }
         depth -= 1
         unlock()
@@ -95,3 +95,108 @@ package struct BloomFilter: Equatable {
         self.value = bit0 | bit1 | bit2
     }
 }
+
+/* OpenSwiftUI Addition Begin */
+
+// MARK: - WideBloomFilter
+
+/// A Bloom filter of 256 bits.
+///
+/// `BloomFilter` fits in a single word, so a union of more than about 16
+/// types sets most of its bits and stops filtering anything. This filter uses
+/// four words, so a union of up to about 64 types has the same false
+/// positive rate.
+package struct WideBloomFilter: Equatable {
+    private var w0: UInt64
+    private var w1: UInt64
+    private var w2: UInt64
+    private var w3: UInt64
+
+    /// Creates an empty Bloom filter.
+    package init() {
+        w0 = 0
+        w1 = 0
+        w2 = 0
+        w3 = 0
+    }
+
+    /// Creates a Bloom filter containing a specific type.
+    ///
+    /// - Parameter type: The type to add to the filter.
+    package init(type: any Any.Type) {
+        let pointer = unsafeBitCast(type, to: OpaquePointer.self)
+        self.init(hashValue: Int(bitPattern: pointer))
+    }
+
+    /// Creates a Bloom filter using a hash value.
+    ///
+    /// The hash value is mixed so that the aligned, mostly equal high bits of
+    /// metadata pointers still select distinct bits, then 3 bits are set.
+    init(hashValue: Int) {
+        self.init()
+        let value = UInt64(truncatingIfNeeded: hashValue) &* 0x9E37_79B9_7F4A_7C15
+        insert(bit: Int(truncatingIfNeeded: value &>> 56))
+        insert(bit: Int(truncatingIfNeeded: value &>> 48) & 0xff)
+        insert(bit: Int(truncatingIfNeeded: value &>> 40) & 0xff)
+    }
+
+    /// A filter that may contain every element.
+    package static var all: WideBloomFilter {
+        var filter = WideBloomFilter()
+        filter.w0 = .max
+        filter.w1 = .max
+        filter.w2 = .max
+        filter.w3 = .max
+        return filter
+    }
+
+    private mutating func insert(bit: Int) {
+        let mask: UInt64 = 1 &<< UInt64(bit & 63)
+        switch bit &>> 6 {
+        case 0: w0 |= mask
+        case 1: w1 |= mask
+        case 2: w2 |= mask
+        default: w3 |= mask
+        }
+    }
+
+    /// Adds the elements of another Bloom filter to this filter.
+    ///
+    /// - Parameter other: Another Bloom filter to combine with this one.
+    package mutating func formUnion(_ other: WideBloomFilter) {
+        w0 |= other.w0
+        w1 |= other.w1
+        w2 |= other.w2
+        w3 |= other.w3
+    }
+
+    /// Returns a new Bloom filter containing the elements of both this filter and another.
+    ///
+    /// - Parameter other: Another Bloom filter to combine with this one.
+    /// - Returns: A new Bloom filter containing the elements of both filters.
+    package func union(_ other: WideBloomFilter) -> WideBloomFilter {
+        var value = self
+        value.formUnion(other)
+        return value
+    }
+
+    /// Tests whether another Bloom filter might be contained in this one.
+    ///
+    /// - Parameter other: Another Bloom filter to test against this one.
+    /// - Returns: `true` if the other filter might be contained in this one, `false` if it definitely is not.
+    package func mayContain(_ other: WideBloomFilter) -> Bool {
+        (other.w0 & ~w0) | (other.w1 & ~w1) | (other.w2 & ~w2) | (other.w3 & ~w3) == 0
+    }
+
+    /// Indicates whether the Bloom filter is empty (contains no elements).
+    package var isEmpty: Bool {
+        w0 | w1 | w2 | w3 == 0
+    }
+
+    /// The number of bits set in the filter.
+    package var bitCount: Int {
+        w0.nonzeroBitCount + w1.nonzeroBitCount + w2.nonzeroBitCount + w3.nonzeroBitCount
+    }
+}
+
+/* OpenSwiftUI Addition End */
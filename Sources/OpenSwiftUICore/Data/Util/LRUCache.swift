@@ -0,0 +1,273 @@
+//
+//  LRUCache.swift
+//  OpenSwiftUICore
+//
+//  Status: Complete
+
+/* OpenSwiftUI Addition Begin */
+
+/// A dictionary that evicts its least recently used values once their total
+/// cost exceeds a limit.
+///
+/// Each value is stored with a cost, such as its size in bytes. Looking a
+/// value up or storing it makes it the most recently used; when the total
+/// cost exceeds `costLimit`, values are evicted from the least recently used
+/// one. Pinned values are never evicted, so the total cost can exceed the
+/// limit while they are pinned.
+///
+/// `LRUCache` isn't thread-safe: wrap it in an `AtomicBox` to share it.
+///
+///     var cache = LRUCache<String, Data>(costLimit: 1 << 20)
+///     cache.setValue(data, forKey: "key", cost: data.count)
+///     let cached = cache.value(forKey: "key")
+///
+package struct LRUCache<Key, Value> where Key: Hashable {
+    /// The total cost past which values are evicted.
+    package var costLimit: Int {
+        didSet {
+            evictIfNeeded()
+        }
+    }
+
+    /// The total cost of the values.
+    package private(set) var totalCost = 0
+
+    /// The total cost of the pinned values.
+    package private(set) var pinnedCost = 0
+
+    /// The counters of the lookups and evictions of the cache.
+    package var statistics = Statistics()
+
+    private var indices: [Key: Int] = [:]
+
+    /// The entries. Unpinned ones are threaded into a doubly linked list from
+    /// the most to the least recently used one, so eviction never walks past
+    /// pinned entries. Removed entries leave a free slot.
+    private var slots: [Slot?] = []
+
+    private var freeSlots: [Int] = []
+
+    private var head = -1
+
+    private var tail = -1
+
+    /// Creates an empty cache.
+    ///
+    /// - Parameter costLimit: The total cost past which values are evicted.
+    package init(costLimit: Int) {
+        self.costLimit = costLimit
+    }
+
+    /// The number of values.
+    package var count: Int {
+        indices.count
+    }
+
+    /// Returns a value, making it the most recently used one.
+    package mutating func value(forKey key: Key) -> Value? {
+        guard let index = indices[key] else {
+            statistics.misses += 1
+            return nil
+        }
+        statistics.hits += 1
+        moveToFront(index)
+        return slots[index]!.value
+    }
+
+    /// Returns a value without changing the order of eviction or the
+    /// counters.
+    package func peekValue(forKey key: Key) -> Value? {
+        indices[key].map { slots[$0]!.value }
+    }
+
+    /// Stores a value as the most recently used one, replacing the value of
+    /// the key, then evicts values past the cost limit.
+    ///
+    /// A replaced value keeps its pins.
+    package mutating func setValue(_ value: Value, forKey key: Key, cost: Int) {
+        let cost = max(cost, 0)
+        if let index = indices[key] {
+            let oldCost = slots[index]!.cost
+            totalCost += cost - oldCost
+            if slots[index]!.pinCount > 0 {
+                pinnedCost += cost - oldCost
+            }
+            slots[index]!.value = value
+            slots[index]!.cost = cost
+            moveToFront(index)
+        } else {
+            let slot = Slot(key: key, value: value, cost: cost, pinCount: 0, previous: -1, next: -1)
+            let index: Int
+            if let freeSlot = freeSlots.popLast() {
+                index = freeSlot
+                slots[index] = slot
+            } else {
+                index = slots.count
+                slots.append(slot)
+            }
+            linkAtFront(index)
+            indices[key] = index
+            totalCost += cost
+        }
+        evictIfNeeded()
+    }
+
+    /// Removes a value, even a pinned one.
+    @discardableResult
+    package mutating func removeValue(forKey key: Key) -> Value? {
+        guard let index = indices[key] else {
+            return nil
+        }
+        return remove(at: index).value
+    }
+
+    /// Removes every value, including pinned ones, keeping the counters.
+    package mutating func removeAll() {
+        indices = [:]
+        slots = []
+        freeSlots = []
+        head = -1
+        tail = -1
+        totalCost = 0
+        pinnedCost = 0
+    }
+
+    /// Protects a value from eviction until it is unpinned as many times as
+    /// it was pinned.
+    ///
+    /// - Returns: Whether the cache has a value for the key.
+    @discardableResult
+    package mutating func pin(_ key: Key) -> Bool {
+        guard let index = indices[key] else {
+            return false
+        }
+        if slots[index]!.pinCount == 0 {
+            pinnedCost += slots[index]!.cost
+            unlink(index)
+        }
+        slots[index]!.pinCount += 1
+        return true
+    }
+
+    /// Balances a call to `pin(_:)`, then evicts values past the cost limit.
+    ///
+    /// A value that is no longer pinned becomes the most recently used one.
+    package mutating func unpin(_ key: Key) {
+        guard let index = indices[key], slots[index]!.pinCount > 0 else {
+            return
+        }
+        slots[index]!.pinCount -= 1
+        if slots[index]!.pinCount == 0 {
+            pinnedCost -= slots[index]!.cost
+            linkAtFront(index)
+            evictIfNeeded()
+        }
+    }
+
+    /// Whether a value is pinned.
+    package func isPinned(_ key: Key) -> Bool {
+        indices[key].map { slots[$0]!.pinCount > 0 } ?? false
+    }
+
+    /// Evicts unpinned values, from the least recently used one, until the
+    /// total cost is at most `cost`.
+    package mutating func trim(toCost cost: Int) {
+        while totalCost > cost, tail >= 0 {
+            remove(at: tail)
+            statistics.evictions += 1
+        }
+    }
+
+    private mutating func evictIfNeeded() {
+        if totalCost > costLimit {
+            trim(toCost: costLimit)
+        }
+    }
+
+    @discardableResult
+    private mutating func remove(at index: Int) -> Slot {
+        let slot = slots[index]!
+        if slot.pinCount == 0 {
+            unlink(index)
+        }
+        slots[index] = nil
+        freeSlots.append(index)
+        indices[slot.key] = nil
+        totalCost -= slot.cost
+        if slot.pinCount > 0 {
+            pinnedCost -= slot.cost
+        }
+        return slot
+    }
+
+    private mutating func moveToFront(_ index: Int) {
+        guard index != head, slots[index]!.pinCount == 0 else {
+            return
+        }
+        unlink(index)
+        linkAtFront(index)
+    }
+
+    private mutating func linkAtFront(_ index: Int) {
+        slots[index]!.previous = -1
+        slots[index]!.next = head
+        if head >= 0 {
+            slots[head]!.previous = index
+        }
+        head = index
+        if tail < 0 {
+            tail = index
+        }
+    }
+
+    private mutating func unlink(_ index: Int) {
+        let previous = slots[index]!.previous
+        let next = slots[index]!.next
+        if previous >= 0 {
+            slots[previous]!.next = next
+        } else {
+            head = next
+        }
+        if next >= 0 {
+            slots[next]!.previous = previous
+        } else {
+            tail = previous
+        }
+    }
+
+    package typealias Statistics = LRUCacheStatistics
+
+    // MARK: - Slot
+
+    private struct Slot {
+        var key: Key
+
+        var value: Value
+
+        var cost: Int
+
+        var pinCount: Int
+
+        var previous: Int
+
+        var next: Int
+    }
+}
+
+// MARK: - LRUCacheStatistics
+
+/// Counters of the lookups and evictions of a cache.
+package struct LRUCacheStatistics: Equatable {
+    /// The number of lookups that found a value.
+    package var hits = 0
+
+    /// The number of lookups that found no value.
+    package var misses = 0
+
+    /// The number of values evicted to stay within the cost limit.
+    package var evictions = 0
+
+    package init() {}
+}
+
+/* OpenSwiftUI Addition End */
@@ -9,6 +9,7 @@
 
 import OpenSwiftUI_SPI
 import OpenAttributeGraphShims
+import Synchronization
 
 // MARK: - PropertyKey
 
@@ -211,9 +212,7 @@ package struct PropertyList: CustomStringConvertible {
         withExtendedLifetime(elements) {
             guard let result = findValueWithSecondaryLookup(
                 elements.map { .passUnretained($0) },
-                secondaryLookupHandler: key,
-                filter: BloomFilter(type: L.Primary.self),
-                secondaryFilter: BloomFilter(type: L.Secondary.self)
+                secondaryLookupHandler: key
             ) else {
                 return L.Primary.defaultValue
             }
@@ -274,7 +273,7 @@ package struct PropertyList: CustomStringConvertible {
         var description = "["
         var index = 0
         if let elements {
-            elements.forEach(filter: BloomFilter()) { element, stop in
+            elements.forEach(filter: WideBloomFilter()) { element, stop in
                 if index != 0 {
                     description.append(", ")
                 }
@@ -295,7 +294,7 @@ package struct PropertyList: CustomStringConvertible {
         guard let elements else {
             return
         }
-        elements.forEach(filter: BloomFilter(type: K.self)) { element, stop in
+        elements.forEach(filter: WideBloomFilter(type: K.self)) { element, stop in
             guard element.takeUnretainedValue().keyType == K.self else {
                 return
             }
@@ -403,13 +402,18 @@ private func find<Key>(
     _ element: Unmanaged<PropertyList.Element>?,
     key: Key.Type
 ) -> Unmanaged<TypedElement<Key>>? where Key: PropertyKey {
-    find1(element, key: key, filter: BloomFilter(type: key))
+    /* OpenSwiftUI Addition Begin */
+    if let index = element?.takeUnretainedValue().indexForLookup() {
+        return index[key].map { .fromOpaque($0.element.toOpaque()) }
+    }
+    /* OpenSwiftUI Addition End */
+    return find1(element, key: key, filter: WideBloomFilter(type: key))
 }
 
 private func find1<Key>(
     _ element: Unmanaged<PropertyList.Element>?,
     key: Key.Type,
-    filter: BloomFilter
+    filter: WideBloomFilter
 ) -> Unmanaged<TypedElement<Key>>? where Key: PropertyKey {
     guard let element else {
         return nil
@@ -437,11 +441,43 @@ private func find1<Key>(
     } while true
 }
 
+/* OpenSwiftUI Addition Begin */
+private func findValueWithSecondaryLookup<Lookup>(
+    _ element: Unmanaged<PropertyList.Element>?,
+    secondaryLookupHandler: Lookup.Type
+) -> Lookup.Primary.Value? where Lookup: PropertyKeyLookup {
+    if let index = element?.takeUnretainedValue().indexForLookup() {
+        let primary = index[Lookup.Primary.self]
+        switch (primary, index[Lookup.Secondary.self]) {
+        case let (_, secondary?) where secondary.position < primary?.position ?? .max:
+            // A secondary value that doesn't resolve falls through to the
+            // elements after it, so only the first one can be answered by
+            // the index.
+            let element: Unmanaged<TypedElement<Lookup.Secondary>> = .fromOpaque(secondary.element.toOpaque())
+            if let value = Lookup.lookup(in: element.takeUnretainedValue().value) {
+                return value
+            }
+        case let (primary?, _):
+            let element: Unmanaged<TypedElement<Lookup.Primary>> = .fromOpaque(primary.element.toOpaque())
+            return element.takeUnretainedValue().value
+        default:
+            return nil
+        }
+    }
+    return findValueWithSecondaryLookup(
+        element,
+        secondaryLookupHandler: secondaryLookupHandler,
+        filter: WideBloomFilter(type: Lookup.Primary.self),
+        secondaryFilter: WideBloomFilter(type: Lookup.Secondary.self)
+    )
+}
+/* OpenSwiftUI Addition End */
+
 private func findValueWithSecondaryLookup<Lookup>(
     _ element: Unmanaged<PropertyList.Element>?,
     secondaryLookupHandler: Lookup.Type,
-    filter: BloomFilter,
-    secondaryFilter: BloomFilter
+    filter: WideBloomFilter,
+    secondaryFilter: WideBloomFilter
 ) -> Lookup.Primary.Value? where Lookup: PropertyKeyLookup {
     guard let element else {
         return nil
@@ -450,7 +486,8 @@ private func findValueWithSecondaryLookup<Lookup>(
     repeat {
         let skipFilter = currentElement.skipFilter
         guard skipFilter.mayContain(filter) || skipFilter.mayContain(secondaryFilter) else {
-            if currentElement.skip != nil {
+            if let skip = currentElement.skip {
+                currentElement = skip.takeUnretainedValue()
                 continue
             } else {
                 return nil
@@ -824,27 +861,35 @@ extension PropertyList {
         fileprivate var skip: Unmanaged<Element>?
         fileprivate let length: UInt32
         fileprivate let skipCount: UInt32
-        fileprivate let skipFilter: BloomFilter
+        fileprivate let skipFilter: WideBloomFilter
         let id = UniqueID()
 
+        /* OpenSwiftUI Addition Begin */
+        private let lookupCount = Atomic<UInt32>(0)
+
+        private let lookupIndex = AtomicLazyReference<PropertyList.LookupIndex>()
+        /* OpenSwiftUI Addition End */
+
         fileprivate init(keyType: any Any.Type, before: Element?, after: Element?) {
             self.keyType = keyType
             self.before = before
             self.after = after
 
-            var filter = BloomFilter(type: keyType)
+            let filter = WideBloomFilter(type: keyType)
             if let before {
                 var length = before.length + 1
                 if let after { length += after.length }
                 self.length = length
                 self.skipCount = 0
-                filter.value = .max
-                self.skipFilter = filter
+                self.skipFilter = .all
                 self.skip = .passUnretained(self)
             } else {
                 if let after {
                     let length = after.length + 1
-                    if after.skipCount > 15 {
+                    // OpenSwiftUI Addition: a 256-bit filter keeps the
+                    // false positive rate of 16 types in 64 bits for up to
+                    // 64 types.
+                    if after.skipCount > 63 {
                         self.length = length
                         self.skipCount = 1
                         self.skipFilter = filter
@@ -872,7 +917,7 @@ extension PropertyList {
         /// - Returns: `false` if iteration was stopped, otherwise `true`.
         @discardableResult
         final func forEach(
-            filter: BloomFilter,
+            filter: WideBloomFilter,
             _ body: (Unmanaged<Element>, inout Bool) -> Void
         ) -> Bool {
             var currentElement = self
@@ -900,6 +945,39 @@ extension PropertyList {
             } while true
         }
 
+        /* OpenSwiftUI Addition Begin */
+
+        /// The length from which a list is indexed.
+        fileprivate static var indexedLength: UInt32 { 32 }
+
+        /// The number of lookups of a list before it is indexed.
+        fileprivate static var lookupsBeforeIndexing: UInt32 { 16 }
+
+        /// Returns the index of the list starting at this element, building
+        /// it once the list has been searched `lookupsBeforeIndexing` times.
+        ///
+        /// Short lists are never indexed, a linear walk filtered by the skip
+        /// lists is as fast as a hash lookup for them.
+        fileprivate final func indexForLookup() -> PropertyList.LookupIndex? {
+            guard length >= Self.indexedLength else {
+                return nil
+            }
+            if let index = lookupIndex.load() {
+                return index
+            }
+            guard lookupCount.add(1, ordering: .relaxed).newValue == Self.lookupsBeforeIndexing else {
+                return nil
+            }
+            return lookupIndex.storeIfNil(PropertyList.LookupIndex(self))
+        }
+
+        /// Whether the list starting at this element has been indexed.
+        fileprivate final var isIndexed: Bool {
+            lookupIndex.load() != nil
+        }
+
+        /* OpenSwiftUI Addition End */
+
         /// A textual representation of the element.
         @usableFromInline
         package var description: String { _openSwiftUIBaseClassAbstractMethod() }
@@ -937,6 +1015,55 @@ extension PropertyList {
 @available(*, unavailable)
 extension PropertyList.Element: Sendable {}
 
+/* OpenSwiftUI Addition Begin */
+
+// MARK: - PropertyList.LookupIndex
+
+extension PropertyList {
+    /// Whether lookups in the list are answered by a hash index instead of
+    /// walking its elements.
+    ///
+    /// Lists of at least 32 elements are indexed once they have been
+    /// searched 16 times.
+    package var isIndexed: Bool {
+        elements?.isIndexed ?? false
+    }
+
+    /// A map from the key types of a list to the elements a lookup finds
+    /// first.
+    ///
+    /// Elements are immutable, so the index of the list starting at an
+    /// element stays valid for the lifetime of the element, which retains
+    /// every element the index refers to.
+    fileprivate final class LookupIndex {
+        struct Entry {
+            var element: Unmanaged<Element>
+
+            /// The position of the element in lookup order.
+            var position: Int
+        }
+
+        private var entries: [ObjectIdentifier: Entry] = [:]
+
+        init(_ element: Element) {
+            var position = 0
+            element.forEach(filter: WideBloomFilter()) { element, _ in
+                let key = ObjectIdentifier(element.takeUnretainedValue().keyType)
+                if entries[key] == nil {
+                    entries[key] = Entry(element: element, position: position)
+                }
+                position += 1
+            }
+        }
+
+        subscript(key: any Any.Type) -> Entry? {
+            entries[ObjectIdentifier(key)]
+        }
+    }
+}
+
+/* OpenSwiftUI Addition End */
+
 // MARK: - TypedElement
 
 private class TypedElement<Key>: PropertyList.Element where Key: PropertyKey {
@@ -0,0 +1,250 @@
+//
+//  ShardedObjectCache.swift
+//  OpenSwiftUICore
+//
+//  Status: Complete
+
+/* OpenSwiftUI Addition Begin */
+
+import Foundation
+
+/// A thread-safe cache that spreads its keys over independently locked
+/// shards.
+///
+/// Each shard is a set-associative cache with the pseudo-LRU eviction of
+/// `ObjectCache`, guarded by its own lock, so threads that look up keys in
+/// different shards don't contend.
+///
+/// A miss calls the constructor outside the shard lock. Concurrent misses on
+/// the same key are coalesced: the first thread constructs the value and the
+/// others wait for it, so the constructor runs once per key and eviction.
+///
+/// For example:
+///
+///     let cache = ShardedObjectCache<String, ExpensiveObject> { key in
+///         ExpensiveObject(key: key)
+///     }
+///
+///     let value = cache["myKey"]
+///
+final package class ShardedObjectCache<Key, Value> where Key: Hashable {
+    /// The constructor function used to create new values for cache misses.
+    let constructor: (Key) -> Value
+
+    /// The number of shards, a power of two.
+    package let shardCount: Int
+
+    /// The number of buckets of each shard, a power of two.
+    package let bucketCount: Int
+
+    /// The number of slots of each bucket.
+    package let waysPerBucket: Int
+
+    private let shards: [AtomicBox<Shard>]
+
+    /// Creates a new cache with the specified layout and constructor function.
+    ///
+    /// - Parameters:
+    ///   - shardCount: The number of independently locked shards, rounded
+    ///     up to a power of two.
+    ///   - bucketCount: The number of buckets of each shard, rounded up to a
+    ///     power of two.
+    ///   - waysPerBucket: The number of slots of each bucket.
+    ///   - constructor: A closure that creates a value for a given key.
+    package init(
+        shardCount: Int = 8,
+        bucketCount: Int = 8,
+        waysPerBucket: Int = 4,
+        constructor: @escaping (Key) -> Value
+    ) {
+        precondition(shardCount > 0 && bucketCount > 0 && waysPerBucket > 0)
+        self.constructor = constructor
+        self.shardCount = Self.roundedUpToPowerOfTwo(shardCount)
+        self.bucketCount = Self.roundedUpToPowerOfTwo(bucketCount)
+        self.waysPerBucket = waysPerBucket
+        let tableSize = self.bucketCount * waysPerBucket
+        self.shards = (0 ..< self.shardCount).map { _ in
+            AtomicBox(wrappedValue: Shard(tableSize: tableSize))
+        }
+    }
+
+    private static func roundedUpToPowerOfTwo(_ value: Int) -> Int {
+        value <= 1 ? 1 : 1 << (Int.bitWidth - (value - 1).leadingZeroBitCount)
+    }
+
+    /// Accesses the value associated with the given key.
+    ///
+    /// - Parameter key: The key to look up.
+    /// - Returns: The value associated with the key, either from cache or
+    ///   newly constructed.
+    final package subscript(key: Key) -> Value {
+        let hash = key.hashValue
+        // The shard and the bucket are chosen from different bits of the
+        // hash, so that the keys of a shard still spread over its buckets.
+        let shard = shards[(hash &>> 16) & (shardCount - 1)]
+        let bucket = (hash & (bucketCount - 1)) * waysPerBucket
+        let waysPerBucket = waysPerBucket
+        let lookup = shard.access { shard -> Lookup in
+            for index in bucket ..< bucket + waysPerBucket {
+                if let itemData = shard.table[index].data,
+                   itemData.hash == hash, itemData.key == key {
+                    shard.clock &+= 1
+                    shard.table[index].used = shard.clock
+                    shard.statistics.hits += 1
+                    return .hit(itemData.value)
+                }
+            }
+            if let pending = shard.pending[key] {
+                shard.statistics.coalescedMisses += 1
+                return .wait(pending)
+            }
+            shard.statistics.misses += 1
+            let pending = Pending()
+            shard.pending[key] = pending
+            return .construct(pending)
+        }
+        switch lookup {
+        case let .hit(value):
+            return value
+        case let .wait(pending):
+            return pending.wait()
+        case let .construct(pending):
+            let value = constructor(key)
+            shard.access { shard in
+                shard.pending[key] = nil
+                shard.insert((key, hash, value), bucket: bucket, waysPerBucket: waysPerBucket)
+            }
+            pending.fulfill(value)
+            return value
+        }
+    }
+
+    /// The sum of the counters of every shard.
+    package var statistics: Statistics {
+        shards.reduce(into: Statistics()) { statistics, shard in
+            statistics.formUnion(shard.access { $0.statistics })
+        }
+    }
+
+    /// The number of cached values.
+    package var count: Int {
+        shards.reduce(0) { count, shard in
+            count + shard.access { $0.table.count(where: { $0.data != nil }) }
+        }
+    }
+
+    /// Removes every cached value and resets the counters.
+    package func reset() {
+        for shard in shards {
+            shard.access { shard in
+                shard = Shard(tableSize: shard.table.count)
+            }
+        }
+    }
+
+    // MARK: - ShardedObjectCache.Statistics
+
+    /// Counters of the lookups of a cache.
+    package struct Statistics: Equatable {
+        /// The number of lookups that found a cached value.
+        package var hits = 0
+
+        /// The number of lookups that called the constructor.
+        package var misses = 0
+
+        /// The number of lookups that waited for the constructor called by
+        /// a concurrent miss on the same key.
+        package var coalescedMisses = 0
+
+        /// The number of cached values replaced by new ones.
+        package var evictions = 0
+
+        package init() {}
+
+        package mutating func formUnion(_ other: Statistics) {
+            hits += other.hits
+            misses += other.misses
+            coalescedMisses += other.coalescedMisses
+            evictions += other.evictions
+        }
+    }
+
+    // MARK: - Shard
+
+    private enum Lookup {
+        case hit(Value)
+        case wait(Pending)
+        case construct(Pending)
+    }
+
+    private struct Item {
+        var data: (key: Key, hash: Int, value: Value)?
+
+        var used: UInt32
+    }
+
+    private struct Shard {
+        var table: [Item]
+
+        var clock: UInt32 = 0
+
+        /// The values being constructed, by key.
+        var pending: [Key: Pending] = [:]
+
+        var statistics = Statistics()
+
+        init(tableSize: Int) {
+            table = Array(repeating: Item(data: nil, used: 0), count: tableSize)
+        }
+
+        /// Stores a value in the least recently used slot of its bucket.
+        mutating func insert(_ data: (key: Key, hash: Int, value: Value), bucket: Int, waysPerBucket: Int) {
+            var target = bucket
+            var diff = Int32.min
+            for index in bucket ..< bucket + waysPerBucket {
+                guard table[index].data != nil else {
+                    target = index
+                    diff = .max
+                    break
+                }
+                let dist = Int32(bitPattern: clock &- table[index].used)
+                if diff < dist {
+                    target = index
+                    diff = dist
+                }
+            }
+            if diff != .max {
+                statistics.evictions += 1
+            }
+            clock &+= 1
+            table[target] = Item(data: data, used: clock)
+        }
+    }
+
+    // MARK: - Pending
+
+    /// A value under construction that other threads can wait for.
+    private final class Pending: @unchecked Sendable {
+        private let condition = NSCondition()
+
+        private var value: Value?
+
+        func wait() -> Value {
+            condition.lock()
+            defer { condition.unlock() }
+            while value == nil {
+                condition.wait()
+            }
+            return value!
+        }
+
+        func fulfill(_ value: Value) {
+            condition.lock()
+            self.value = value
+            condition.broadcast()
+            condition.unlock()
+        }
+    }
+}
+
+/* OpenSwiftUI Addition End */
@@ -44,6 +44,11 @@ open class GraphHost: CustomReflectable {
     private static let sharedGraph: Graph = {
         let graph = Graph()
         // TODO
+        /* OpenSwiftUI Addition Begin */
+        if LayoutTrace.environmentPath != nil {
+            LayoutTrace.register(graph: graph)
+        }
+        /* OpenSwiftUI Addition End */
         return graph
     }()
 
@@ -88,7 +88,7 @@ extension Color.Resolved {
 }
 
 extension Color.Resolved {
-    private static let cache: ObjectCache<Color.Resolved, CGColor> = ObjectCache { resolved in
+    private static let cache: ShardedObjectCache<Color.Resolved, CGColor> = ShardedObjectCache { resolved in
         var components: [CGFloat] = [CGFloat(resolved.red), CGFloat(resolved.green), CGFloat(resolved.blue), CGFloat(resolved.opacity)]
         return CGColor(colorSpace: Self.srgbExtended, components: &components)!
     }
@@ -26,7 +26,7 @@ extension Color.Resolved {
         }
     }
 
-    private static let cache: ObjectCache<Color.Resolved, NSObject> = ObjectCache { resolved in
+    private static let cache: ShardedObjectCache<Color.Resolved, NSObject> = ShardedObjectCache { resolved in
         CoreColor.platformColor(resolvedColor: resolved)!
     }
     
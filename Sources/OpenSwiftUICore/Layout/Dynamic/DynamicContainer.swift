@@ -568,9 +568,24 @@ struct DynamicContainerInfo<Adapter>: StatefulRule, AsyncAttribute, ObservedAttr
                         }
                     }
                 }
+                /* OpenSwiftUI Addition Begin */
+                var reusedItem = item
                 if reusedIndex >= 0 {
                     let infoItem = info.items[reusedIndex].for(Adapter.self)
-                    infoItem.item = item
+                    let reused = adaptor.reuseItemLayout(
+                        infoItem.itemLayout,
+                        uniqueId: infoItem.uniqueId,
+                        replacing: infoItem.item,
+                        with: &reusedItem
+                    )
+                    if !reused {
+                        reusedIndex = -1
+                    }
+                }
+                /* OpenSwiftUI Addition End */
+                if reusedIndex >= 0 {
+                    let infoItem = info.items[reusedIndex].for(Adapter.self)
+                    infoItem.item = reusedItem
                     unremoveItem(at: reusedIndex)
                     if target < reusedIndex {
                         info.items.swapAt(target, reusedIndex)
@@ -31,6 +31,20 @@ package protocol DynamicContainerAdaptor {
     ) -> (_ViewOutputs, ItemLayout)
 
     func removeItemLayout(uniqueId: UInt32, itemLayout: ItemLayout)
+
+    /* OpenSwiftUI Addition Begin */
+    /// Called when an unused item selected by `canBeReused(by:)` is taken
+    /// over by `item`, before `item` replaces `previous` in the container.
+    ///
+    /// Returns `false` when the item layout can't be rebound to `item`; the
+    /// container then makes a new item instead.
+    func reuseItemLayout(
+        _ itemLayout: ItemLayout,
+        uniqueId: UInt32,
+        replacing previous: Item,
+        with item: inout Item
+    ) -> Bool
+    /* OpenSwiftUI Addition End */
 }
 
 extension DynamicContainerAdaptor where Item == Items {
@@ -59,4 +73,15 @@ extension DynamicContainerAdaptor where Item == Items.Element, Items: Collection
 
 extension DynamicContainerAdaptor {
     package static var maxUnusedItems: Int { .zero }
+
+    /* OpenSwiftUI Addition Begin */
+    package func reuseItemLayout(
+        _ itemLayout: ItemLayout,
+        uniqueId: UInt32,
+        replacing previous: Item,
+        with item: inout Item
+    ) -> Bool {
+        true
+    }
+    /* OpenSwiftUI Addition End */
 }
@@ -97,7 +97,7 @@ extension Layout {
 
 // MARK: - DynamicLayoutViewChildGeometry
 
-private struct DynamicLayoutViewChildGeometry: StatefulRule, AsyncAttribute {
+struct DynamicLayoutViewChildGeometry: StatefulRule, AsyncAttribute {
     @Attribute var containerInfo: DynamicContainer.Info
     @Attribute var childGeometries: [ViewGeometry]
     let id: DynamicContainerID
@@ -211,6 +211,24 @@ struct DynamicLayoutViewAdaptor: DynamicContainerAdaptor {
         inputs: _ViewInputs,
         containerInfo: Attribute<DynamicContainer.Info>,
         containerInputs: (inout _ViewInputs) -> ()
+    ) -> (_ViewOutputs, DynamicLayoutViewAdaptor.ItemLayout) {
+        makeItemLayout(
+            item: item,
+            uniqueId: uniqueId,
+            inputs: inputs,
+            containerInfo: containerInfo,
+            indirectMap: nil,
+            containerInputs: containerInputs
+        )
+    }
+
+    func makeItemLayout(
+        item: DynamicViewListItem,
+        uniqueId: UInt32,
+        inputs: _ViewInputs,
+        containerInfo: Attribute<DynamicContainer.Info>,
+        indirectMap: IndirectAttributeMap?,
+        containerInputs: (inout _ViewInputs) -> ()
     ) -> (_ViewOutputs, DynamicLayoutViewAdaptor.ItemLayout) {
         let isArchived = inputs.archivedView.isArchived
         let traits = item.traits
@@ -224,7 +242,7 @@ struct DynamicLayoutViewAdaptor: DynamicContainerAdaptor {
             transition = nil
         }
         var containerID = DynamicContainerID(uniqueId: uniqueId, viewIndex: 0)
-        let outputs = item.elements.makeAllElements(inputs: inputs) { elementInputs, body in
+        let outputs = item.elements.makeAllElements(inputs: inputs, indirectMap: indirectMap) { elementInputs, body in
             var elementInputs = elementInputs
             containerInputs(&elementInputs)
             if elementInputs.needsGeometry {
@@ -273,7 +291,7 @@ struct DynamicLayoutViewAdaptor: DynamicContainerAdaptor {
 
 // MARK: - DynamicLayoutComputer
 
-private struct DynamicLayoutComputer<L>: StatefulRule, AsyncAttribute, CustomStringConvertible where L: Layout {
+struct DynamicLayoutComputer<L>: StatefulRule, AsyncAttribute, CustomStringConvertible where L: Layout {
     @Attribute var layout: L
     @Attribute var environment: EnvironmentValues
     @OptionalAttribute var containerInfo: DynamicContainer.Info?
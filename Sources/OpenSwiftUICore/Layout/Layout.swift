@@ -2046,13 +2046,14 @@ package struct AnyLayoutProperties: Rule, AsyncAttribute {
 /// `ViewSizeCache` provides an efficient way to cache calculated sizes for views,
 /// avoiding redundant size calculations when the same proposed size is requested multiple times.
 package struct ViewSizeCache {
-    private var cache: Cache3<ProposedViewSize, CGSize>
+    private var cache: AdaptiveCache<_ProposedSize, CGSize>
 
     /// Creates a new view size cache.
     ///
-    /// - Parameter cache: An optional pre-configured cache. If not provided, a new cache will be created.
-    package init(cache: Cache3<ProposedViewSize, CGSize> = .init()) {
-        self.cache = cache
+    /// The cache holds three sizes, and grows when the view keeps being
+    /// measured with more distinct proposals than that.
+    package init() {
+        self.cache = AdaptiveCache()
     }
 
     /// Retrieves a cached size for the given proposed size, computing it if not already cached.
@@ -2066,14 +2067,19 @@ package struct ViewSizeCache {
     /// - Returns: The cached or newly computed size.
     @inline(__always)
     package mutating func get(_ k: _ProposedSize, makeValue: () -> CGSize) -> CGSize {
-        let key = ProposedViewSize(k)
-        if let value = cache.find(key) {
+        if let value = cache.find(k) {
             LayoutTrace.traceCacheLookup(k, true)
             return value
         } else {
             LayoutTrace.traceCacheLookup(k, false)
             let value = makeValue()
-            cache.put(key, value: value)
+            /* OpenSwiftUI Addition Begin */
+            let capacity = cache.capacity
+            cache.put(k, value: value)
+            if cache.capacity != capacity {
+                LayoutTrace.traceCacheResize(cache.capacity)
+            }
+            /* OpenSwiftUI Addition End */
             return value
         }
     }
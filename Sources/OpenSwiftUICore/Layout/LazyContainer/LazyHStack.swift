@@ -0,0 +1,105 @@
+//
+//  LazyHStack.swift
+//  OpenSwiftUICore
+//
+//  Status: WIP
+
+/* OpenSwiftUI Addition Begin */
+
+public import Foundation
+
+// MARK: - LazyHStack
+
+/// A view that arranges its children in a line that grows horizontally,
+/// creating items only as needed.
+///
+/// The stack is "lazy," in that the stack view doesn't create items until it
+/// needs to render them onscreen. Items far away from the visible region are
+/// released again and their subgraphs are recycled for the items that come
+/// into view.
+///
+/// The following example shows a lazy horizontal stack of a thousand text views:
+///
+///     var body: some View {
+///         LazyHStack(spacing: 10) {
+///             ForEach(1...1000, id: \.self) {
+///                 Text("Item \($0)")
+///             }
+///         }
+///     }
+@available(OpenSwiftUI_v2_0, *)
+@frozen
+public struct LazyHStack<Content>: View, UnaryView, PrimitiveView where Content: View {
+    @usableFromInline
+    var _tree: _VariadicView.Tree<_LazyHStackLayout, Content>
+
+    /// Creates a lazy horizontal stack view with the given spacing and
+    /// vertical alignment.
+    ///
+    /// - Parameters:
+    ///   - alignment: The guide for aligning the subviews in this stack. All
+    ///     child views have the same vertical screen coordinate.
+    ///   - spacing: The distance between adjacent subviews, or `nil` if you
+    ///     want the stack to choose a default distance for each pair of
+    ///     subviews.
+    ///   - content: A view builder that creates the content of this stack.
+    @inlinable
+    public init(
+        alignment: VerticalAlignment = .center,
+        spacing: CGFloat? = nil,
+        @ViewBuilder content: () -> Content
+    ) {
+        _tree = .init(
+            _LazyHStackLayout(alignment: alignment, spacing: spacing)
+        ) {
+            content()
+        }
+    }
+
+    nonisolated public static func _makeView(
+        view: _GraphValue<Self>,
+        inputs: _ViewInputs
+    ) -> _ViewOutputs {
+        _VariadicView.Tree.makeDebuggableView(
+            view: view[offset: { .of(&$0._tree) }],
+            inputs: inputs
+        )
+    }
+}
+
+@available(*, unavailable)
+extension LazyHStack: Sendable {}
+
+// MARK: - _LazyHStackLayout
+
+/// The root of a LazyHStack.
+@available(OpenSwiftUI_v2_0, *)
+@frozen
+public struct _LazyHStackLayout {
+    /// The vertical alignment of children.
+    public var alignment: VerticalAlignment
+
+    /// The distance between adjacent children, or nil if the stack should
+    /// choose a default distance.
+    public var spacing: CGFloat?
+
+    @inlinable
+    public init(alignment: VerticalAlignment = .center, spacing: CGFloat? = nil) {
+        self.alignment = alignment
+        self.spacing = spacing
+    }
+
+    package static let majorAxis: Axis = .horizontal
+}
+
+extension _LazyHStackLayout: LazyStackRoot {
+    @available(OpenSwiftUI_v2_0, *)
+    public typealias Body = Never
+
+    package typealias MinorAxisAlignment = VerticalAlignment
+}
+
+@available(*, unavailable)
+extension _LazyHStackLayout: Sendable {}
+
+/* OpenSwiftUI Addition End */
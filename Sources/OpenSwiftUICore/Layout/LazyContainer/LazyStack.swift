@@ -0,0 +1,714 @@
+//
+//  LazyStack.swift
+//  OpenSwiftUICore
+//
+//  Status: WIP
+
+/* OpenSwiftUI Addition Begin */
+
+package import Foundation
+package import OpenAttributeGraphShims
+
+// MARK: - LazyStackRoot
+
+/// The root of a ``LazyVStack`` or ``LazyHStack``.
+///
+/// A lazy stack only instantiates the children that intersect its visible
+/// region plus an overscan margin. Children outside of that window are
+/// represented by an estimated extent, so the cost of building the stack
+/// depends on the size of the visible region instead of the size of the data.
+package protocol LazyStackRoot: _VariadicView_UnaryViewRoot where Body == Never {
+    associatedtype MinorAxisAlignment: AlignmentGuide
+
+    var alignment: MinorAxisAlignment { get }
+
+    var spacing: CGFloat? { get }
+
+    static var majorAxis: Axis { get }
+}
+
+extension LazyStackRoot {
+    nonisolated public static func _makeView(
+        root: _GraphValue<Self>,
+        inputs: _ViewInputs,
+        body: (_Graph, _ViewInputs) -> _ViewListOutputs
+    ) -> _ViewOutputs {
+        var inputs = inputs
+        inputs.stackOrientation = majorAxis
+        let state = LazyStackState()
+        let window = Attribute(value: LazyStackWindow())
+        state.window = WeakAttribute(window)
+        let layout = Attribute(
+            LazyStackLayoutRule(
+                root: root.value,
+                visibleRegion: inputs.base[LazyStackVisibleRegionInput.self],
+                containerInfo: .init(),
+                state: state
+            )
+        )
+        var contentInputs = inputs
+        contentInputs.coreConfigureForLazyContainer()
+        contentInputs.base[ForEachEvictionInput.self] = WeakAttribute(Attribute(value: true))
+        let list = body(_Graph(), contentInputs).makeAttribute(viewInputs: contentInputs)
+
+        var childComputer: Attribute<LayoutComputer>?
+        let childGeometry: OptionalAttribute<[ViewGeometry]>
+        if inputs.requestsLayoutComputer || inputs.needsGeometry {
+            let layoutComputer = Attribute(
+                DynamicLayoutComputer(
+                    layout: layout,
+                    environment: inputs.environment,
+                    containerInfo: .init(),
+                    layoutMap: .init()
+                )
+            )
+            childComputer = layoutComputer
+            childGeometry = .init(Attribute(
+                LayoutChildGeometries(
+                    parentSize: inputs.size,
+                    parentPosition: inputs.position,
+                    layoutComputer: layoutComputer
+                )
+            ))
+        } else {
+            childGeometry = .init()
+        }
+        var childInputs = contentInputs
+        childInputs.requestsLayoutComputer = false
+        func mapMutator(thunk: (inout DynamicLayoutMap) -> ()) -> () {
+            guard let childComputer else { return }
+            childComputer.mutateBody(
+                as: DynamicLayoutComputer<LazyStackLayout<Self>>.self,
+                invalidating: true
+            ) { computer in
+                thunk(&computer.layoutMap)
+            }
+        }
+        var (containerInfo, outputs) = DynamicContainer.makeContainer(
+            adaptor: LazyStackViewAdaptor(
+                base: DynamicLayoutViewAdaptor(
+                    items: list,
+                    childGeometries: childGeometry,
+                    mutateLayoutMap: mapMutator(thunk:)
+                ),
+                window: window,
+                state: state
+            ),
+            inputs: childInputs
+        )
+        layout.mutateBody(
+            as: LazyStackLayoutRule<Self>.self,
+            invalidating: true
+        ) { rule in
+            rule.$containerInfo = containerInfo
+        }
+        if let childComputer {
+            childComputer.mutateBody(
+                as: DynamicLayoutComputer<LazyStackLayout<Self>>.self,
+                invalidating: true
+            ) { computer in
+                computer.$containerInfo = containerInfo
+            }
+            if inputs.requestsLayoutComputer {
+                outputs.layoutComputer = childComputer
+            }
+        }
+        return outputs
+    }
+}
+
+// MARK: - LazyStackVisibleRegionInput
+
+/// The visible part of the nearest lazy stack, in the stack's own coordinate
+/// space.
+///
+/// Scrollable containers set this input so that the stack can follow the
+/// scroll offset. Without it, the region proposed to the stack is treated as
+/// visible.
+package struct LazyStackVisibleRegionInput: ViewInput {
+    package static let defaultValue: OptionalAttribute<CGRect> = .init()
+}
+
+// MARK: - LazyStackExtents
+
+/// The major-axis extents of the children of a lazy stack.
+///
+/// Only the children that have been laid out are measured. Every other child
+/// is assumed to have the mean measured extent, so offsets can be computed
+/// without visiting the unmeasured children.
+package struct LazyStackExtents {
+    /// The extent assumed for every child before any child is measured.
+    package static let defaultEstimatedExtent: CGFloat = 44
+
+    package var count: Int {
+        didSet {
+            guard count < oldValue else {
+                return
+            }
+            let end = indices.lowerBound(of: count)
+            guard end != indices.count else {
+                return
+            }
+            indices.removeSubrange(end...)
+            extents.removeSubrange(end...)
+            measuredTotal = extents.reduce(0, +)
+            prefix.removeAll(keepingCapacity: true)
+        }
+    }
+
+    package var spacing: CGFloat
+
+    private let defaultExtent: CGFloat
+
+    private var indices: [Int] = []
+
+    private var extents: [CGFloat] = []
+
+    private var measuredTotal: CGFloat = 0
+
+    /// `prefix[i]` is the sum of `extents[0 ..< i]`, rebuilt lazily after
+    /// each measurement.
+    private var prefix: [CGFloat] = []
+
+    package init(
+        count: Int = 0,
+        spacing: CGFloat = 0,
+        estimatedExtent: CGFloat = LazyStackExtents.defaultEstimatedExtent
+    ) {
+        self.count = count
+        self.spacing = spacing
+        self.defaultExtent = estimatedExtent
+    }
+
+    package var measuredCount: Int {
+        indices.count
+    }
+
+    package var estimatedExtent: CGFloat {
+        indices.isEmpty ? defaultExtent : measuredTotal / CGFloat(indices.count)
+    }
+
+    package func extent(at index: Int) -> CGFloat {
+        let position = indices.lowerBound(of: index)
+        guard position != indices.count, indices[position] == index else {
+            return estimatedExtent
+        }
+        return extents[position]
+    }
+
+    package mutating func record(_ extent: CGFloat, at index: Int) {
+        guard index >= 0, index < count, extent.isFinite, extent >= 0 else {
+            return
+        }
+        let position = indices.lowerBound(of: index)
+        if position != indices.count, indices[position] == index {
+            guard extents[position] != extent else {
+                return
+            }
+            measuredTotal += extent - extents[position]
+            extents[position] = extent
+        } else {
+            indices.insert(index, at: position)
+            extents.insert(extent, at: position)
+            measuredTotal += extent
+        }
+        prefix.removeAll(keepingCapacity: true)
+    }
+
+    package mutating func removeAllMeasurements() {
+        indices.removeAll(keepingCapacity: true)
+        extents.removeAll(keepingCapacity: true)
+        prefix.removeAll(keepingCapacity: true)
+        measuredTotal = 0
+    }
+
+    /// The major-axis offset of the child at `index` from the start of the
+    /// stack.
+    package mutating func offset(of index: Int) -> CGFloat {
+        if prefix.isEmpty {
+            prefix.reserveCapacity(extents.count + 1)
+            prefix.append(0)
+            for extent in extents {
+                prefix.append(prefix[prefix.count - 1] + extent)
+            }
+        }
+        let measured = indices.lowerBound(of: index)
+        return CGFloat(index - measured) * estimatedExtent
+            + prefix[measured]
+            + CGFloat(index) * spacing
+    }
+
+    package mutating func totalLength() -> CGFloat {
+        guard count > 0 else {
+            return 0
+        }
+        return offset(of: count) - spacing
+    }
+
+    /// The indices of the children that intersect `region`.
+    package mutating func indices(in region: ClosedRange<CGFloat>) -> Range<Int> {
+        var first = 0
+        var upper = count
+        while first < upper {
+            let middle = (first + upper) / 2
+            if offset(of: middle) + extent(at: middle) <= region.lowerBound {
+                first = middle + 1
+            } else {
+                upper = middle
+            }
+        }
+        var end = first
+        upper = count
+        while end < upper {
+            let middle = (end + upper) / 2
+            if offset(of: middle) < region.upperBound {
+                end = middle + 1
+            } else {
+                upper = middle
+            }
+        }
+        return first ..< end
+    }
+}
+
+// MARK: - LazyStackWindow
+
+struct LazyStackWindow: Equatable {
+    var range: Range<Int> = 0 ..< 0
+    var seed: UInt32 = 0
+}
+
+// MARK: - LazyStackState
+
+/// The state shared by the layout and the view adaptor of a lazy stack.
+///
+/// The layout decides which children should exist and publishes that window
+/// through the `window` attribute in a follow-up transaction. The adaptor
+/// then instantiates the children in the window and reports the range it
+/// actually created.
+package final class LazyStackState {
+    /// The fraction of the visible length kept alive on each side of the
+    /// visible region.
+    package static let overscanFraction: CGFloat = 0.5
+
+    /// The number of estimated extents treated as visible when nothing
+    /// bounds the visible region, such as for an ideal-size proposal.
+    package static let unboundedPageCount = 20
+
+    package var extents = LazyStackExtents()
+
+    /// The view indices of the children that currently exist.
+    package var instantiatedRange: Range<Int> = 0 ..< 0
+
+    var window: WeakAttribute<LazyStackWindow> = .init()
+
+    var slots: [ViewList.ID: LazyStackItem.Slot] = [:]
+
+    /// The view index of the first view of each instantiated item.
+    var itemIndices: [ViewList.ID: Int] = [:]
+
+    /// The major-axis offsets the items were last placed at, which are kept
+    /// for the items animating their removal.
+    private var placedOffsets: [ViewList.ID: CGFloat] = [:]
+
+    private var requestedWindow: LazyStackWindow?
+
+    private var minorLength: CGFloat?
+
+    private var reportedLength: CGFloat?
+
+    package init() {}
+
+    /// Discards measured extents when the minor-axis length changes, since
+    /// children usually reflow.
+    func prepare(spacing: CGFloat, minorLength: CGFloat?) {
+        extents.spacing = spacing
+        if self.minorLength != minorLength {
+            self.minorLength = minorLength
+            extents.removeAllMeasurements()
+        }
+    }
+
+    func totalLength() -> CGFloat {
+        let length = extents.totalLength()
+        reportedLength = length
+        return length
+    }
+
+    var hasRequestedWindow: Bool {
+        requestedWindow != nil
+    }
+
+    /// The item of the subview at `position`, and the view index of the
+    /// subview if its item is in the window.
+    ///
+    /// Subviews follow the container's items rather than the window, since
+    /// items animating their removal stay in the container.
+    func subview(
+        at position: Int,
+        in info: DynamicContainer.Info
+    ) -> (id: ViewList.ID?, index: Int?) {
+        var itemIndex = position
+        if !info.allUnary {
+            itemIndex = 0
+            while position >= Int(info[itemIndex].count) {
+                itemIndex &+= 1
+            }
+        }
+        let item = info[itemIndex]
+        guard let id = item.id else {
+            return (nil, nil)
+        }
+        let first = itemIndices[id]
+        return (id, first.map { $0 + position - Int(item.precedingViewCount) })
+    }
+
+    func placedOffset(of id: ViewList.ID) -> CGFloat? {
+        placedOffsets[id]
+    }
+
+    func setPlacedOffsets(_ offsets: [ViewList.ID: CGFloat]) {
+        placedOffsets = offsets
+    }
+
+    /// Requests the children that intersect `region`.
+    ///
+    /// The window is only moved once the visible children are no longer
+    /// covered by it, and it then includes the overscan margin, so small
+    /// scroll offsets and measurement updates don't rebuild the children.
+    func requestWindow(for region: ClosedRange<CGFloat>) {
+        let visible = extents.indices(in: region)
+        var window = requestedWindow ?? LazyStackWindow()
+        let length = extents.totalLength()
+        let lengthChanged = reportedLength.map { abs($0 - length) >= 0.5 } ?? false
+        let covered = requestedWindow != nil
+            && window.range.upperBound <= extents.count
+            && (visible.isEmpty || window.range.contains(visible.lowerBound))
+            && visible.upperBound <= window.range.upperBound
+        guard !covered || lengthChanged else {
+            return
+        }
+        if !covered {
+            let visibleLength = region.upperBound - region.lowerBound
+            let overscan = visibleLength.isFinite
+                ? max(visibleLength * Self.overscanFraction, extents.estimatedExtent)
+                : 0
+            window.range = extents.indices(
+                in: (region.lowerBound - overscan) ... (region.upperBound + overscan)
+            )
+        }
+        if lengthChanged {
+            window.seed &+= 1
+            reportedLength = length
+        }
+        requestedWindow = window
+        let weakWindow = self.window
+        GraphHost.currentHost.continueTransaction {
+            guard let attribute = weakWindow.attribute else {
+                return
+            }
+            _ = attribute.setValue(window)
+        }
+    }
+}
+
+// MARK: - LazyStackLayout
+
+package struct LazyStackLayout<Root>: Layout where Root: LazyStackRoot {
+    package typealias Cache = Void
+
+    package typealias AnimatableData = EmptyAnimatableData
+
+    var root: Root
+
+    var visibleRegion: CGRect?
+
+    var containerInfo: DynamicContainer.Info?
+
+    let state: LazyStackState
+
+    package static var layoutProperties: LayoutProperties {
+        var properties = LayoutProperties()
+        properties.stackOrientation = Root.majorAxis
+        properties.isDefaultEmptyLayout = false
+        return properties
+    }
+
+    package func sizeThatFits(
+        proposal: ProposedViewSize,
+        subviews: Subviews,
+        cache: inout Void
+    ) -> CGSize {
+        let axis = Root.majorAxis
+        let minorProposal = proposal[axis.otherAxis]
+        var minorLength: CGFloat = 0
+        for subview in subviews {
+            let size = subview.sizeThatFits(ProposedViewSize(nil, in: axis, by: minorProposal))
+            minorLength = max(minorLength, size[axis.otherAxis])
+        }
+        if !state.hasRequestedWindow {
+            state.prepare(spacing: spacing, minorLength: minorProposal)
+            state.requestWindow(for: visibleRange(proposal: proposal))
+        }
+        return CGSize(state.totalLength(), in: axis, by: minorLength)
+    }
+
+    package func placeSubviews(
+        in bounds: CGRect,
+        proposal: ProposedViewSize,
+        subviews: Subviews,
+        cache: inout Void
+    ) {
+        let axis = Root.majorAxis
+        let minorLength = bounds.size[axis.otherAxis]
+        state.prepare(spacing: spacing, minorLength: minorLength)
+        let childProposal = ProposedViewSize(nil, in: axis, by: minorLength)
+        let dimensions = subviews.map { $0.dimensions(in: childProposal) }
+        let first = state.instantiatedRange.lowerBound
+        let mapped: [(id: ViewList.ID?, index: Int?)] = (0 ..< subviews.count).map { position in
+            guard let containerInfo else {
+                return (nil, first + position)
+            }
+            return state.subview(at: position, in: containerInfo)
+        }
+        for (position, dimension) in dimensions.enumerated() {
+            guard let index = mapped[position].index else {
+                continue
+            }
+            state.extents.record(dimension.size.value[axis], at: index)
+        }
+        let guide = minorLength * root.alignment.fraction
+        var placedOffsets: [ViewList.ID: CGFloat] = [:]
+        for (position, subview) in subviews.enumerated() {
+            let dimension = dimensions[position]
+            let (id, index) = mapped[position]
+            let major: CGFloat
+            if let index {
+                major = state.extents.offset(of: index)
+            } else {
+                // Removed items keep their place while they transition out.
+                major = id.flatMap { state.placedOffset(of: $0) } ?? 0
+            }
+            if let id {
+                placedOffsets[id] = major
+            }
+            let minor = guide - dimension[root.alignment.key]
+            subview.place(
+                at: CGPoint(
+                    bounds.origin[axis] + major,
+                    in: axis,
+                    by: bounds.origin[axis.otherAxis] + minor
+                ),
+                dimensions: dimension
+            )
+        }
+        state.setPlacedOffsets(placedOffsets)
+        state.requestWindow(for: visibleRange(proposal: proposal))
+    }
+
+    private var spacing: CGFloat {
+        root.spacing ?? defaultSpacingValue[Root.majorAxis]
+    }
+
+    private func visibleRange(proposal: ProposedViewSize) -> ClosedRange<CGFloat> {
+        let axis = Root.majorAxis
+        if let visibleRegion {
+            return visibleRegion[axis]
+        }
+        if let length = proposal[axis], length.isFinite {
+            return 0 ... max(length, 0)
+        }
+        let extent = state.extents.estimatedExtent + state.extents.spacing
+        return 0 ... CGFloat(LazyStackState.unboundedPageCount) * extent
+    }
+}
+
+private struct LazyStackLayoutRule<Root>: Rule, AsyncAttribute where Root: LazyStackRoot {
+    @Attribute var root: Root
+    @OptionalAttribute var visibleRegion: CGRect?
+    @OptionalAttribute var containerInfo: DynamicContainer.Info?
+    let state: LazyStackState
+
+    var value: LazyStackLayout<Root> {
+        LazyStackLayout(
+            root: root,
+            visibleRegion: visibleRegion,
+            containerInfo: containerInfo,
+            state: state
+        )
+    }
+}
+
+// MARK: - LazyStackItem
+
+struct LazyStackItem: DynamicContainerItem {
+    /// The element state of one child subgraph, kept across reuse.
+    final class Slot {
+        var id: ViewList.ID
+        var map: IndirectAttributeMap?
+        var release: ViewList.Elements.Release?
+
+        init(id: ViewList.ID) {
+            self.id = id
+        }
+    }
+
+    var base: DynamicViewListItem
+    var slot: Slot
+
+    var count: Int { base.count }
+
+    var needsTransitions: Bool { base.needsTransitions }
+
+    var zIndex: Double { base.zIndex }
+
+    func matchesIdentity(of other: LazyStackItem) -> Bool {
+        base.matchesIdentity(of: other.base)
+    }
+
+    static var supportsReuse: Bool { true }
+
+    func canBeReused(by other: LazyStackItem) -> Bool {
+        guard count == 1, other.count == 1,
+              base.list == other.base.list,
+              let map = slot.map else {
+            return false
+        }
+        return base.elements.tryToReuseElement(
+            at: 0,
+            by: other.base.elements,
+            at: 0,
+            indirectMap: map,
+            testOnly: true
+        )
+    }
+
+    var list: Attribute<any ViewList>? { base.list }
+
+    var viewID: ViewList.ID? { base.id }
+}
+
+// MARK: - LazyStackViewAdaptor
+
+/// A dynamic container adaptor that only creates the items in the window
+/// requested by the lazy stack layout.
+///
+/// Items leaving the window are parked in the container's unused pool and
+/// rebound to the elements of items entering it, so scrolling recycles child
+/// subgraphs instead of rebuilding them.
+struct LazyStackViewAdaptor: DynamicContainerAdaptor {
+    typealias Item = LazyStackItem
+
+    typealias Items = [LazyStackItem]
+
+    struct ItemLayout {
+        var slot: LazyStackItem.Slot
+    }
+
+    static var maxUnusedItems: Int { 32 }
+
+    var base: DynamicLayoutViewAdaptor
+    @Attribute var window: LazyStackWindow
+    let state: LazyStackState
+
+    mutating func updatedItems() -> [LazyStackItem]? {
+        let (list, listChanged) = base.$items.changedValue()
+        let (window, windowChanged) = $window.changedValue()
+        guard listChanged || windowChanged else {
+            return nil
+        }
+        let count = list.estimatedCount
+        state.extents.count = count
+        let range = window.range.clamped(to: 0 ..< count)
+        var items: [LazyStackItem] = []
+        var first: Int?
+        var viewCount = 0
+        state.itemIndices.removeAll(keepingCapacity: true)
+        if !range.isEmpty {
+            items.reserveCapacity(range.count)
+            var start = range.lowerBound
+            list.applySublists(from: &start, list: base.$items) { sublist in
+                let lowerBound = first ?? range.lowerBound - sublist.start
+                first = lowerBound
+                state.itemIndices[sublist.id] = lowerBound + viewCount
+                items.append(LazyStackItem(
+                    base: DynamicViewListItem(
+                        id: sublist.id,
+                        elements: sublist.elements,
+                        traits: sublist.traits,
+                        list: sublist.list
+                    ),
+                    slot: state.slots[sublist.id] ?? .init(id: sublist.id)
+                ))
+                viewCount += sublist.count
+                return lowerBound + viewCount < range.upperBound
+            }
+        }
+        let lowerBound = first ?? range.lowerBound
+        state.instantiatedRange = lowerBound ..< lowerBound + viewCount
+        return items
+    }
+
+    func makeItemLayout(
+        item: LazyStackItem,
+        uniqueId: UInt32,
+        inputs: _ViewInputs,
+        containerInfo: Attribute<DynamicContainer.Info>,
+        containerInputs: (inout _ViewInputs) -> Void
+    ) -> (_ViewOutputs, ItemLayout) {
+        let indirectMap = IndirectAttributeMap(subgraph: .current!)
+        let (outputs, _) = base.makeItemLayout(
+            item: item.base,
+            uniqueId: uniqueId,
+            inputs: inputs,
+            containerInfo: containerInfo,
+            indirectMap: indirectMap,
+            containerInputs: containerInputs
+        )
+        let slot = item.slot
+        slot.map = indirectMap
+        slot.release = item.base.elements.retain()
+        state.slots[slot.id] = slot
+        return (outputs, ItemLayout(slot: slot))
+    }
+
+    func reuseItemLayout(
+        _ itemLayout: ItemLayout,
+        uniqueId: UInt32,
+        replacing previous: LazyStackItem,
+        with item: inout LazyStackItem
+    ) -> Bool {
+        let slot = itemLayout.slot
+        guard let map = slot.map,
+              previous.base.elements.tryToReuseElement(
+                  at: 0,
+                  by: item.base.elements,
+                  at: 0,
+                  indirectMap: map,
+                  testOnly: false
+              ) else {
+            // The subgraph may be partly rebound, so never offer it again.
+            slot.map = nil
+            return false
+        }
+        if state.slots[slot.id] === slot {
+            state.slots[slot.id] = nil
+        }
+        slot.id = item.base.id
+        slot.release = item.base.elements.retain()
+        state.slots[slot.id] = slot
+        item.slot = slot
+        return true
+    }
+
+    func removeItemLayout(uniqueId: UInt32, itemLayout: ItemLayout) {
+        let slot = itemLayout.slot
+        if state.slots[slot.id] === slot {
+            state.slots[slot.id] = nil
+        }
+        slot.release = nil
+        base.removeItemLayout(uniqueId: uniqueId, itemLayout: .init(release: nil))
+    }
+}
+
+/* OpenSwiftUI Addition End */
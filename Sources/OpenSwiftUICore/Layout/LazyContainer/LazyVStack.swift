@@ -0,0 +1,105 @@
+//
+//  LazyVStack.swift
+//  OpenSwiftUICore
+//
+//  Status: WIP
+
+/* OpenSwiftUI Addition Begin */
+
+public import Foundation
+
+// MARK: - LazyVStack
+
+/// A view that arranges its children in a line that grows vertically,
+/// creating items only as needed.
+///
+/// The stack is "lazy," in that the stack view doesn't create items until it
+/// needs to render them onscreen. Items far away from the visible region are
+/// released again and their subgraphs are recycled for the items that come
+/// into view.
+///
+/// The following example shows a lazy vertical stack of a thousand text views:
+///
+///     var body: some View {
+///         LazyVStack(spacing: 10) {
+///             ForEach(1...1000, id: \.self) {
+///                 Text("Item \($0)")
+///             }
+///         }
+///     }
+@available(OpenSwiftUI_v2_0, *)
+@frozen
+public struct LazyVStack<Content>: View, UnaryView, PrimitiveView where Content: View {
+    @usableFromInline
+    var _tree: _VariadicView.Tree<_LazyVStackLayout, Content>
+
+    /// Creates a lazy vertical stack view with the given spacing and
+    /// horizontal alignment.
+    ///
+    /// - Parameters:
+    ///   - alignment: The guide for aligning the subviews in this stack. All
+    ///     child views have the same horizontal screen coordinate.
+    ///   - spacing: The distance between adjacent subviews, or `nil` if you
+    ///     want the stack to choose a default distance for each pair of
+    ///     subviews.
+    ///   - content: A view builder that creates the content of this stack.
+    @inlinable
+    public init(
+        alignment: HorizontalAlignment = .center,
+        spacing: CGFloat? = nil,
+        @ViewBuilder content: () -> Content
+    ) {
+        _tree = .init(
+            _LazyVStackLayout(alignment: alignment, spacing: spacing)
+        ) {
+            content()
+        }
+    }
+
+    nonisolated public static func _makeView(
+        view: _GraphValue<Self>,
+        inputs: _ViewInputs
+    ) -> _ViewOutputs {
+        _VariadicView.Tree.makeDebuggableView(
+            view: view[offset: { .of(&$0._tree) }],
+            inputs: inputs
+        )
+    }
+}
+
+@available(*, unavailable)
+extension LazyVStack: Sendable {}
+
+// MARK: - _LazyVStackLayout
+
+/// The root of a LazyVStack.
+@available(OpenSwiftUI_v2_0, *)
+@frozen
+public struct _LazyVStackLayout {
+    /// The horizontal alignment of children.
+    public var alignment: HorizontalAlignment
+
+    /// The distance between adjacent children, or nil if the stack should
+    /// choose a default distance.
+    public var spacing: CGFloat?
+
+    @inlinable
+    public init(alignment: HorizontalAlignment = .center, spacing: CGFloat? = nil) {
+        self.alignment = alignment
+        self.spacing = spacing
+    }
+
+    package static let majorAxis: Axis = .vertical
+}
+
+extension _LazyVStackLayout: LazyStackRoot {
+    @available(OpenSwiftUI_v2_0, *)
+    public typealias Body = Never
+
+    package typealias MinorAxisAlignment = HorizontalAlignment
+}
+
+@available(*, unavailable)
+extension _LazyVStackLayout: Sendable {}
+
+/* OpenSwiftUI Addition End */
@@ -0,0 +1,408 @@
+//
+//  SignpostTrace.swift
+//  OpenSwiftUICore
+//
+//  Status: WIP
+
+/* OpenSwiftUI Addition Begin */
+
+import Dispatch
+package import Foundation
+import Synchronization
+
+// MARK: - SignpostTrace
+
+/// An in-process trace recorder for platforms without os_signpost and
+/// kdebug.
+///
+/// Each thread appends events to its own fixed-size ring buffer, so
+/// recording never takes a lock after a thread's first event. When a buffer
+/// is full the oldest events of that thread are overwritten. The recorded
+/// events can be exported as Chrome trace-event JSON, which can be opened
+/// in Perfetto or `chrome://tracing`.
+///
+/// Recording starts automatically when `OPENSWIFTUI_TRACE_FILE` is set, and
+/// the trace is written to that path when the process exits.
+package enum SignpostTrace {
+    package enum Phase: UInt8 {
+        case begin
+        case end
+        case instant
+        case asyncBegin
+        case asyncEnd
+    }
+
+    package struct Event {
+        package var timestamp: UInt64
+        package var phase: Phase
+        package var category: StaticString
+        package var name: StaticString
+        package var message: StaticString?
+        package var id: UInt64
+        package var arguments: (UInt64, UInt64, UInt64)
+        package var argumentCount: Int
+
+        package init(
+            timestamp: UInt64,
+            phase: Phase,
+            category: StaticString,
+            name: StaticString,
+            message: StaticString? = nil,
+            id: UInt64 = 0,
+            arguments: (UInt64, UInt64, UInt64) = (0, 0, 0),
+            argumentCount: Int = 0
+        ) {
+            self.timestamp = timestamp
+            self.phase = phase
+            self.category = category
+            self.name = name
+            self.message = message
+            self.id = id
+            self.arguments = arguments
+            self.argumentCount = min(max(argumentCount, 0), 3)
+        }
+    }
+
+    /// The number of events kept for each thread.
+    package static let bufferCapacity = 1 << 14
+
+    private static let recording = Atomic<Bool>(environmentPath != nil)
+
+    private static let environmentPath: String? = {
+        guard let path = ProcessInfo.processInfo.environment["OPENSWIFTUI_TRACE_FILE"],
+              !path.isEmpty else {
+            return nil
+        }
+        atexit {
+            SignpostTrace.writeEnvironmentTrace()
+        }
+        return path
+    }()
+
+    private static let threadBuffer = ThreadSpecific<Buffer?>(nil)
+
+    @AtomicBox
+    private static var buffers: [Buffer] = []
+
+    package static var isRecording: Bool {
+        recording.load(ordering: .relaxed)
+    }
+
+    package static func start() {
+        recording.store(true, ordering: .relaxed)
+    }
+
+    package static func stop() {
+        recording.store(false, ordering: .relaxed)
+    }
+
+    /// Discards all recorded events. Call only while no thread is recording.
+    package static func reset() {
+        for buffer in buffers {
+            buffer.reset()
+        }
+    }
+
+    @inline(__always)
+    package static func id(for object: AnyObject?) -> UInt64 {
+        guard let object else {
+            return 0
+        }
+        return UInt64(UInt(bitPattern: Unmanaged.passUnretained(object).toOpaque()))
+    }
+
+    /// Records an event with up to three arguments.
+    ///
+    /// The arguments are passed individually rather than as an array, so
+    /// recording an event doesn't allocate.
+    package static func record(
+        _ phase: Phase,
+        category: StaticString = "OpenSwiftUI",
+        name: StaticString,
+        message: StaticString? = nil,
+        id: UInt64 = 0,
+        arguments arg0: (any CVarArg)? = nil,
+        _ arg1: (any CVarArg)? = nil,
+        _ arg2: (any CVarArg)? = nil
+    ) {
+        guard isRecording else {
+            return
+        }
+        var event = Event(
+            timestamp: DispatchTime.now().uptimeNanoseconds,
+            phase: phase,
+            category: category,
+            name: name,
+            message: message,
+            id: id
+        )
+        if let arg0 {
+            event.arguments.0 = traceValue(arg0)
+            event.argumentCount = 1
+            if let arg1 {
+                event.arguments.1 = traceValue(arg1)
+                event.argumentCount = 2
+                if let arg2 {
+                    event.arguments.2 = traceValue(arg2)
+                    event.argumentCount = 3
+                }
+            }
+        }
+        currentBuffer.append(event)
+    }
+
+    /// Returns the recorded events of every thread, oldest first within
+    /// each thread.
+    package static func events() -> [(thread: Int, event: Event)] {
+        var events: [(thread: Int, event: Event)] = []
+        for buffer in buffers {
+            buffer.forEach { events.append((buffer.thread, $0)) }
+        }
+        return events
+    }
+
+    /// Returns the recorded events in the Chrome trace-event JSON format.
+    package static func chromeTraceJSON() -> String {
+        String(decoding: chromeTraceData(), as: UTF8.self)
+    }
+
+    /// Encodes the recorded events as Chrome trace-event JSON into a single
+    /// growing byte buffer, without intermediate strings per event.
+    private static func chromeTraceData() -> [UInt8] {
+        var encoder = ChromeTraceEncoder(processID: UInt64(ProcessInfo.processInfo.processIdentifier))
+        for buffer in buffers {
+            buffer.forEach { encoder.encode($0, thread: UInt64(buffer.thread)) }
+        }
+        return encoder.finish()
+    }
+
+    package static func write(to url: URL) throws {
+        try Data(chromeTraceData()).write(to: url)
+    }
+
+    private static func writeEnvironmentTrace() {
+        guard let environmentPath else {
+            return
+        }
+        do {
+            try write(to: URL(fileURLWithPath: environmentPath))
+        } catch {
+            Log.internalError("Failed to write trace to \(environmentPath): \(error)")
+        }
+    }
+
+    private static var currentBuffer: Buffer {
+        if let buffer = threadBuffer.value {
+            return buffer
+        }
+        let buffer = $buffers.access { buffers in
+            let buffer = Buffer(thread: buffers.count + 1, capacity: bufferCapacity)
+            buffers.append(buffer)
+            return buffer
+        }
+        threadBuffer.value = buffer
+        return buffer
+    }
+
+    @inline(__always)
+    private static func traceValue(_ argument: any CVarArg) -> UInt64 {
+        switch argument {
+        case let value as Int: UInt64(bitPattern: Int64(value))
+        case let value as UInt: UInt64(value)
+        case let value as Int32: UInt64(bitPattern: Int64(value))
+        case let value as UInt32: UInt64(value)
+        case let value as Int64: UInt64(bitPattern: value)
+        case let value as UInt64: value
+        default:
+            argument._cVarArgEncoding.first.map { UInt64(bitPattern: Int64($0)) } ?? 0
+        }
+    }
+
+    // MARK: - SignpostTrace.ChromeTraceEncoder
+
+    /// Writes trace events as Chrome trace-event JSON objects into one
+    /// reusable byte buffer.
+    private struct ChromeTraceEncoder {
+        private var output: [UInt8] = []
+        private let processID: UInt64
+        private var isFirst = true
+
+        init(processID: UInt64) {
+            self.processID = processID
+            output.reserveCapacity(1 << 16)
+            append("{\"traceEvents\":[\n")
+        }
+
+        mutating func encode(_ event: Event, thread: UInt64) {
+            if !isFirst {
+                append(",\n")
+            }
+            isFirst = false
+            append("{\"name\":")
+            appendString(event.name)
+            append(",\"cat\":")
+            appendString(event.category)
+            append(",\"ph\":\"")
+            append(event.phase.chromePhase)
+            append("\",\"ts\":")
+            appendDecimal(event.timestamp / 1000)
+            output.append(UInt8(ascii: "."))
+            let fraction = event.timestamp % 1000
+            output.append(UInt8(ascii: "0") + UInt8(fraction / 100))
+            output.append(UInt8(ascii: "0") + UInt8(fraction / 10 % 10))
+            output.append(UInt8(ascii: "0") + UInt8(fraction % 10))
+            append(",\"pid\":")
+            appendDecimal(processID)
+            append(",\"tid\":")
+            appendDecimal(thread)
+            switch event.phase {
+            case .asyncBegin, .asyncEnd:
+                append(",\"id\":\"0x")
+                appendHexadecimal(event.id)
+                output.append(UInt8(ascii: "\""))
+            case .instant:
+                append(",\"s\":\"t\"")
+            case .begin, .end:
+                break
+            }
+            guard event.id != 0 || event.message != nil || event.argumentCount > 0 else {
+                output.append(UInt8(ascii: "}"))
+                return
+            }
+            append(",\"args\":{")
+            var separator = false
+            if event.id != 0 {
+                append("\"object\":\"0x")
+                appendHexadecimal(event.id)
+                output.append(UInt8(ascii: "\""))
+                separator = true
+            }
+            if let message = event.message {
+                append(separator ? ",\"message\":" : "\"message\":")
+                appendString(message)
+                separator = true
+            }
+            for index in 0 ..< event.argumentCount {
+                append(separator ? ",\"arg" : "\"arg")
+                appendDecimal(UInt64(index))
+                append("\":")
+                switch index {
+                case 0: appendDecimal(event.arguments.0)
+                case 1: appendDecimal(event.arguments.1)
+                default: appendDecimal(event.arguments.2)
+                }
+                separator = true
+            }
+            append("}}")
+        }
+
+        consuming func finish() -> [UInt8] {
+            append("\n],\"displayTimeUnit\":\"ns\"}\n")
+            return output
+        }
+
+        private mutating func append(_ string: StaticString) {
+            string.withUTF8Buffer { output.append(contentsOf: $0) }
+        }
+
+        private mutating func appendString(_ string: StaticString) {
+            output.append(UInt8(ascii: "\""))
+            string.withUTF8Buffer { bytes in
+                for byte in bytes {
+                    switch byte {
+                    case UInt8(ascii: "\""), UInt8(ascii: "\\"):
+                        output.append(UInt8(ascii: "\\"))
+                        output.append(byte)
+                    case UInt8(ascii: "\n"):
+                        output.append(UInt8(ascii: "\\"))
+                        output.append(UInt8(ascii: "n"))
+                    case ..<0x20:
+                        append("\\u00")
+                        output.append(hexDigit(byte >> 4))
+                        output.append(hexDigit(byte & 0xF))
+                    default:
+                        output.append(byte)
+                    }
+                }
+            }
+            output.append(UInt8(ascii: "\""))
+        }
+
+        private mutating func appendDecimal(_ value: UInt64) {
+            guard value >= 10 else {
+                output.append(UInt8(ascii: "0") + UInt8(value))
+                return
+            }
+            appendDecimal(value / 10)
+            output.append(UInt8(ascii: "0") + UInt8(value % 10))
+        }
+
+        private mutating func appendHexadecimal(_ value: UInt64) {
+            if value >= 16 {
+                appendHexadecimal(value >> 4)
+            }
+            output.append(hexDigit(UInt8(value & 0xF)))
+        }
+
+        private func hexDigit(_ value: UInt8) -> UInt8 {
+            value < 10 ? UInt8(ascii: "0") + value : UInt8(ascii: "a") + value - 10
+        }
+    }
+
+    // MARK: - SignpostTrace.Buffer
+
+    /// A single-producer ring buffer owned by one thread.
+    private final class Buffer {
+        let thread: Int
+        let capacity: Int
+        private let storage: UnsafeMutablePointer<Event>
+        private let count = Atomic<Int>(0)
+
+        init(thread: Int, capacity: Int) {
+            self.thread = thread
+            self.capacity = capacity
+            storage = .allocate(capacity: capacity)
+            storage.initialize(
+                repeating: Event(timestamp: 0, phase: .instant, category: "", name: ""),
+                count: capacity
+            )
+        }
+
+        deinit {
+            storage.deinitialize(count: capacity)
+            storage.deallocate()
+        }
+
+        @inline(__always)
+        func append(_ event: Event) {
+            let index = count.load(ordering: .relaxed)
+            storage[index % capacity] = event
+            count.store(index + 1, ordering: .releasing)
+        }
+
+        func forEach(_ body: (Event) -> Void) {
+            let end = count.load(ordering: .acquiring)
+            for index in max(0, end - capacity) ..< end {
+                body(storage[index % capacity])
+            }
+        }
+
+        func reset() {
+            count.store(0, ordering: .releasing)
+        }
+    }
+}
+
+extension SignpostTrace.Phase {
+    fileprivate var chromePhase: StaticString {
+        switch self {
+        case .begin: "B"
+        case .end: "E"
+        case .instant: "i"
+        case .asyncBegin: "b"
+        case .asyncEnd: "e"
+        }
+    }
+}
+
+/* OpenSwiftUI Addition End */
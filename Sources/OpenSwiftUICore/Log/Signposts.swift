@@ -45,6 +45,9 @@ extension Signpost {
     package static let platformUpdate = Signpost.os_log(11, "PlatformViewUpdate").published
     package static let animationState = Signpost.os_log(12, "AnimationState").published
     package static let eventHandling = Signpost.os_log(13, "EventHandling").published
+    /* OpenSwiftUI Addition Begin */
+    package static let cachedEnvironment = Signpost.os_log(14, "CachedEnvironment").published
+    /* OpenSwiftUI Addition End */
 }
 
 #if canImport(Darwin)
@@ -62,7 +65,7 @@ package struct Signpost {
     @inlinable
     package static func os_log(_ code: UInt8, _ name: StaticString) -> Signpost {
         #if OPENSWIFTUI_SIGNPOST_KDEBUG
-        Signpost(style: .kdebug(code), stability: .debug)
+        Signpost(style: .kdebug(code), stability: .debug, name: name)
         #else
         Signpost(style: .os_log(name), stability: .debug)
         #endif
@@ -73,7 +76,7 @@ package struct Signpost {
         #if OPENSWIFTUI_SIGNPOST_OS_LOG
         Signpost(style: .os_log(name), stability: .debug)
         #else
-        Signpost(style: .kdebug(code), stability: .debug)
+        Signpost(style: .kdebug(code), stability: .debug, name: name)
         #endif
     }
 
@@ -104,20 +107,46 @@ package struct Signpost {
     
     private let style: Style
     private let stability: Stability
+    /* OpenSwiftUI Addition Begin */
+    private let name: StaticString?
+
+    private init(style: Style, stability: Stability, name: StaticString? = nil) {
+        self.style = style
+        self.stability = stability
+        self.name = name
+    }
+
+    #if !canImport(Darwin)
+    @inline(__always)
+    private var traceName: StaticString {
+        switch style {
+        case .kdebug: name ?? "Signpost"
+        case let .os_log(name): name
+        }
+    }
+
+    /// The argument at `index`, if any. The argument array is only built
+    /// by the caller's autoclosure once recording is known to be on.
+    @inline(__always)
+    private func traceArgument(_ args: [any CVarArg], _ index: Int) -> (any CVarArg)? {
+        index < args.count ? args[index] : nil
+    }
+    #endif
+    /* OpenSwiftUI Addition End */
     
     @inlinable
     package var disabled: Signpost {
-        Signpost(style: style, stability: .disabled)
+        Signpost(style: style, stability: .disabled, name: name)
     }
     
     @inlinable
     package var verbose: Signpost {
-        Signpost(style: style, stability: .verbose)
+        Signpost(style: style, stability: .verbose, name: name)
     }
     
     @inlinable
     package var published: Signpost {
-        Signpost(style: style, stability: .published)
+        Signpost(style: style, stability: .published, name: name)
     }
     
     package var isEnabled: Bool {
@@ -135,7 +164,7 @@ package struct Signpost {
                 return _signpostLog.signpostsEnabled
             }
         #else
-        return false
+        return SignpostTrace.isRecording
         #endif
     }
     
@@ -165,6 +194,9 @@ package struct Signpost {
                 return closure()
         }
         #else
+        let id = SignpostTrace.id(for: object)
+        SignpostTrace.record(.begin, name: traceName, message: message, id: id)
+        defer { SignpostTrace.record(.end, name: traceName, id: id) }
         return closure()
         #endif
     }
@@ -193,6 +225,18 @@ package struct Signpost {
                 return closure()
         }
         #else
+        let id = SignpostTrace.id(for: object)
+        let args = args()
+        SignpostTrace.record(
+            .begin,
+            name: traceName,
+            message: message,
+            id: id,
+            arguments: traceArgument(args, 0),
+            traceArgument(args, 1),
+            traceArgument(args, 2)
+        )
+        defer { SignpostTrace.record(.end, name: traceName, id: id) }
         return closure()
         #endif
     }
@@ -216,6 +260,22 @@ package struct Signpost {
             case let .os_log(name):
                 os_signpost(type, log: _signpostLog, name: name, signpostID: id, message, args)
         }
+        #else
+        let phase: SignpostTrace.Phase = switch type {
+        case .begin: .begin
+        case .end: .end
+        default: .instant
+        }
+        let args = args()
+        SignpostTrace.record(
+            phase,
+            name: traceName,
+            message: message,
+            id: SignpostTrace.id(for: object),
+            arguments: traceArgument(args, 0),
+            traceArgument(args, 1),
+            traceArgument(args, 2)
+        )
         #endif
     }
     
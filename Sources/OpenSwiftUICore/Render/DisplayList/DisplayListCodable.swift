@@ -0,0 +1,532 @@
+//
+//  DisplayListCodable.swift
+//  OpenSwiftUICore
+//
+//  Status: WIP
+
+package import Foundation
+
+/* OpenSwiftUI Addition Begin */
+
+// MARK: - DisplayList + ProtobufMessage
+
+extension DisplayList: ProtobufMessage {
+    package func encode(to encoder: inout ProtobufEncoder) throws {
+        for item in items {
+            try encoder.messageField(1, item)
+        }
+    }
+
+    package init(from decoder: inout ProtobufDecoder) throws {
+        var items: [Item] = []
+        while let field = try decoder.nextField() {
+            switch field.tag {
+            case 1: items.append(try decoder.messageField(field))
+            default: try decoder.skipField(field)
+            }
+        }
+        self.init(items)
+    }
+}
+
+// MARK: - DisplayList.Item + ProtobufMessage
+
+extension DisplayList.Item: ProtobufMessage {
+    package func encode(to encoder: inout ProtobufEncoder) throws {
+        try encoder.messageField(1, frame, defaultValue: .zero)
+        encoder.uintField(2, UInt(identity.value))
+        encoder.intField(3, version.value)
+        if identity != .none, let frameState = encoder.displayListFrameState {
+            guard frameState.versions[identity] != version else {
+                encoder.boolField(8, true)
+                return
+            }
+            frameState.versions[identity] = version
+        }
+        switch value {
+        case .empty:
+            break
+        case let .content(content):
+            try encoder.messageField(4, content)
+        case let .effect(effect, list):
+            try encoder.messageField(5, effect)
+            try encoder.messageField(6, list)
+        case let .states(states):
+            for (hash, list) in states {
+                try encoder.messageField(7) { encoder in
+                    try encoder.messageField(1, hash)
+                    try encoder.messageField(2, list)
+                }
+            }
+        }
+    }
+
+    package init(from decoder: inout ProtobufDecoder) throws {
+        var frame: CGRect = .zero
+        var identity: DisplayList.Identity = .none
+        var version = DisplayList.Version()
+        var content: DisplayList.Content?
+        var effect: DisplayList.Effect?
+        var list = DisplayList()
+        var states: [(StrongHash, DisplayList)] = []
+        var isReused = false
+        while let field = try decoder.nextField() {
+            switch field.tag {
+            case 1: frame = try decoder.messageField(field)
+            case 2: identity = .init(decodedValue: try decoder.uint32Field(field))
+            case 3: version = .init(decodedValue: try decoder.intField(field))
+            case 4: content = try decoder.messageField(field) { try DisplayList.Content(archivedFrom: &$0) }
+            case 5: effect = try decoder.messageField(field)
+            case 6: list = try decoder.messageField(field)
+            case 7:
+                let state = try decoder.messageField(field) { decoder in
+                    var hash = StrongHash()
+                    var list = DisplayList()
+                    while let field = try decoder.nextField() {
+                        switch field.tag {
+                        case 1: hash = try decoder.messageField(field)
+                        case 2: list = try decoder.messageField(field)
+                        default: try decoder.skipField(field)
+                        }
+                    }
+                    return (hash, list)
+                }
+                states.append(state)
+            case 8: isReused = try decoder.boolField(field)
+            default: try decoder.skipField(field)
+            }
+        }
+        let frameState = decoder.displayListFrameState
+        if isReused {
+            guard let item = frameState?.items[identity] else {
+                throw ProtobufDecoder.DecodingError.failed
+            }
+            self = item
+            self.frame = frame
+            return
+        }
+        let value: Value
+        if let effect {
+            value = .effect(effect, list)
+        } else if let content {
+            value = .content(content)
+        } else if !states.isEmpty {
+            value = .states(states)
+        } else {
+            value = .empty
+        }
+        self.init(value, frame: frame, identity: identity, version: version)
+        if identity != .none, let frameState {
+            frameState.items[identity] = self
+        }
+    }
+}
+
+// MARK: - DisplayList.Content + ProtobufEncodableMessage
+
+/// Contents backed by platform objects or by text that has no archived form
+/// (views, layers, images, drawings, text and backdrops) are not encoded, and
+/// decode as empty items with the same frame, identity and version.
+extension DisplayList.Content: ProtobufEncodableMessage {
+    package func encode(to encoder: inout ProtobufEncoder) throws {
+        encoder.uintField(1, UInt(seed.value))
+        switch value {
+        case let .color(color):
+            try encoder.messageField(2, color)
+        case let .chameleonColor(fallback, _):
+            try encoder.messageField(2, fallback)
+        case let .shape(path, paint, style):
+            try encoder.messageField(3) { encoder in
+                try encoder.messageField(1, path)
+                try encoder.messageField(2, CodableResolvedPaint(paint))
+                try encoder.messageField(3, style)
+            }
+        case let .shadow(path, style):
+            try encoder.messageField(4) { encoder in
+                try encoder.messageField(1, path)
+                try encoder.messageField(2, style)
+            }
+        case let .flattened(list, origin, options):
+            try encoder.messageField(5) { encoder in
+                try encoder.messageField(1, list)
+                try encoder.messageField(2, origin, defaultValue: .zero)
+                try encoder.messageField(3, options)
+            }
+        case let .placeholder(id):
+            encoder.uintField(6, UInt(id.value), defaultValue: nil)
+        case .backdrop, .image, .platformView, .platformLayer, .text, .drawing, .view:
+            break
+        }
+    }
+
+    /// Decodes content encoded by `encode(to:)`, returning `nil` for content
+    /// that wasn't archived.
+    package init?(archivedFrom decoder: inout ProtobufDecoder) throws {
+        var seed = DisplayList.Seed()
+        var value: Value?
+        while let field = try decoder.nextField() {
+            switch field.tag {
+            case 1:
+                seed = .init(decodedValue: try decoder.uint16Field(field))
+            case 2:
+                value = .color(try decoder.messageField(field))
+            case 3:
+                value = try decoder.messageField(field) { decoder in
+                    var path = Path()
+                    var paint: AnyResolvedPaint?
+                    var style = FillStyle()
+                    while let field = try decoder.nextField() {
+                        switch field.tag {
+                        case 1: path = try decoder.messageField(field)
+                        case 2: paint = Self.decodePaint(try decoder.dataField(field))
+                        case 3: style = try decoder.messageField(field)
+                        default: try decoder.skipField(field)
+                        }
+                    }
+                    return paint.map { .shape(path, $0, style) }
+                }
+            case 4:
+                value = try decoder.messageField(field) { decoder in
+                    var path = Path()
+                    var style = ResolvedShadowStyle(color: .black, radius: 0, offset: .zero)
+                    while let field = try decoder.nextField() {
+                        switch field.tag {
+                        case 1: path = try decoder.messageField(field)
+                        case 2: style = try decoder.messageField(field)
+                        default: try decoder.skipField(field)
+                        }
+                    }
+                    return .shadow(path, style)
+                }
+            case 5:
+                value = try decoder.messageField(field) { decoder in
+                    var list = DisplayList()
+                    var origin: CGPoint = .zero
+                    var options = RasterizationOptions()
+                    while let field = try decoder.nextField() {
+                        switch field.tag {
+                        case 1: list = try decoder.messageField(field)
+                        case 2: origin = try decoder.messageField(field)
+                        case 3: options = try decoder.messageField(field)
+                        default: try decoder.skipField(field)
+                        }
+                    }
+                    return .flattened(list, origin, options)
+                }
+            case 6:
+                value = .placeholder(id: .init(decodedValue: try decoder.uint32Field(field)))
+            default:
+                try decoder.skipField(field)
+            }
+        }
+        guard let value else {
+            return nil
+        }
+        self.init(value, seed: seed)
+    }
+
+    // Paints other than colors can be encoded but not decoded yet. The paint
+    // is decoded from its own buffer so that a failure leaves the enclosing
+    // message readable.
+    private static func decodePaint(_ data: Data) -> AnyResolvedPaint? {
+        var decoder = ProtobufDecoder(data)
+        return try? CodableResolvedPaint(from: &decoder).base
+    }
+}
+
+// MARK: - DisplayList.Effect + ProtobufMessage
+
+/// Effects backed by platform objects or by values without an archived form
+/// encode as `.identity`, keeping the items they apply to.
+extension DisplayList.Effect: ProtobufMessage {
+    package func encode(to encoder: inout ProtobufEncoder) throws {
+        switch self {
+        case .geometryGroup:
+            encoder.emptyField(2)
+        case .compositingGroup:
+            encoder.emptyField(3)
+        case let .backdropGroup(value):
+            encoder.boolField(4, value, defaultValue: nil)
+        case let .properties(properties):
+            encoder.uintField(5, UInt(properties.rawValue), defaultValue: nil)
+        case let .opacity(value):
+            encoder.floatField(6, value, defaultValue: nil)
+        case let .blendMode(.blendMode(mode)):
+            encoder.intField(7, Int(mode.rawValue), defaultValue: nil)
+        case let .clip(path, style, options):
+            try encoder.messageField(8) { encoder in
+                try encoder.messageField(1, path)
+                try encoder.messageField(2, style)
+                encoder.uintField(3, UInt(options.rawValue))
+            }
+        case let .mask(list, options):
+            try encoder.messageField(9) { encoder in
+                try encoder.messageField(1, list)
+                encoder.uintField(2, UInt(options.rawValue))
+            }
+        case let .transform(transform):
+            try encoder.messageField(10) { encoder in
+                switch transform {
+                case let .affine(transform): try encoder.messageField(1, transform)
+                case let .projection(transform): try encoder.messageField(2, transform)
+                case let .rotation(data): try encoder.messageField(3, data)
+                case let .rotation3D(data): try encoder.messageField(4, data)
+                }
+            }
+        case let .animation(animation):
+            try encoder.messageField(11, CodableEffectAnimation(base: animation))
+        case let .platform(effect):
+            try encoder.messageField(12, effect)
+        case let .state(hash):
+            try encoder.messageField(13, hash)
+        case .identity, .archive, .platformGroup, .blendMode, .filter, .contentTransition,
+             .view, .accessibility, .interpolatorRoot, .interpolatorLayer, .interpolatorAnimation:
+            encoder.emptyField(1)
+        }
+    }
+
+    package init(from decoder: inout ProtobufDecoder) throws {
+        var effect: DisplayList.Effect = .identity
+        while let field = try decoder.nextField() {
+            switch field.tag {
+            case 1:
+                try decoder.skipField(field)
+                effect = .identity
+            case 2:
+                try decoder.skipField(field)
+                effect = .geometryGroup
+            case 3:
+                try decoder.skipField(field)
+                effect = .compositingGroup
+            case 4:
+                effect = .backdropGroup(try decoder.boolField(field))
+            case 5:
+                effect = .properties(.init(rawValue: try decoder.uint8Field(field)))
+            case 6:
+                effect = .opacity(try decoder.floatField(field))
+            case 7:
+                let mode = GraphicsContext.BlendMode(rawValue: Int32(truncatingIfNeeded: try decoder.intField(field)))
+                effect = .blendMode(.blendMode(mode))
+            case 8:
+                effect = try decoder.messageField(field) { decoder in
+                    var path = Path()
+                    var style = FillStyle()
+                    var options = GraphicsContext.ClipOptions()
+                    while let field = try decoder.nextField() {
+                        switch field.tag {
+                        case 1: path = try decoder.messageField(field)
+                        case 2: style = try decoder.messageField(field)
+                        case 3: options = .init(rawValue: try decoder.uint32Field(field))
+                        default: try decoder.skipField(field)
+                        }
+                    }
+                    return .clip(path, style, options)
+                }
+            case 9:
+                effect = try decoder.messageField(field) { decoder in
+                    var list = DisplayList()
+                    var options = GraphicsContext.ClipOptions()
+                    while let field = try decoder.nextField() {
+                        switch field.tag {
+                        case 1: list = try decoder.messageField(field)
+                        case 2: options = .init(rawValue: try decoder.uint32Field(field))
+                        default: try decoder.skipField(field)
+                        }
+                    }
+                    return .mask(list, options)
+                }
+            case 10:
+                effect = try decoder.messageField(field) { decoder in
+                    var transform: DisplayList.Transform = .affine(.identity)
+                    while let field = try decoder.nextField() {
+                        switch field.tag {
+                        case 1: transform = .affine(try decoder.messageField(field))
+                        case 2: transform = .projection(try decoder.messageField(field))
+                        case 3: transform = .rotation(try decoder.messageField(field))
+                        case 4: transform = .rotation3D(try decoder.messageField(field))
+                        default: try decoder.skipField(field)
+                        }
+                    }
+                    return .transform(transform)
+                }
+            case 11:
+                let animation: CodableEffectAnimation = try decoder.messageField(field)
+                effect = .animation(animation.base)
+            case 12:
+                effect = .platform(try decoder.messageField(field))
+            case 13:
+                effect = .state(try decoder.messageField(field))
+            default:
+                try decoder.skipField(field)
+            }
+        }
+        self = effect
+    }
+}
+
+// MARK: - DisplayList.FrameState
+
+extension DisplayList {
+    /// The items shared by the frames of a recording since its last keyframe.
+    ///
+    /// While encoding, an item with an identity is written in full the first
+    /// time its version is seen, and as a reference afterwards. Versions
+    /// increase whenever an item changes, so the decoder can substitute the
+    /// item it decoded earlier for the same identity. Only the frame of a
+    /// referenced item is written again, since translating a list doesn't
+    /// always bump the version of its items.
+    final class FrameState {
+        var versions: [Identity: Version] = [:]
+        var items: [Identity: Item] = [:]
+
+        func removeAll() {
+            versions.removeAll(keepingCapacity: true)
+            items.removeAll(keepingCapacity: true)
+        }
+
+        static let userInfoKey = CodingUserInfoKey(rawValue: "org.OpenSwiftUIProject.OpenSwiftUI.DisplayListFrameState")!
+    }
+}
+
+extension ProtobufEncoder {
+    var displayListFrameState: DisplayList.FrameState? {
+        userInfo[DisplayList.FrameState.userInfoKey] as? DisplayList.FrameState
+    }
+}
+
+extension ProtobufDecoder {
+    var displayListFrameState: DisplayList.FrameState? {
+        userInfo[DisplayList.FrameState.userInfoKey] as? DisplayList.FrameState
+    }
+}
+
+// MARK: - DisplayList.Recording
+
+extension DisplayList {
+    /// A frame of a display list recording.
+    package struct RecordedFrame {
+        package var list: DisplayList
+
+        package var time: Time
+
+        package var isKeyframe: Bool
+
+        package init(list: DisplayList, time: Time, isKeyframe: Bool) {
+            self.list = list
+            self.time = time
+            self.isKeyframe = isKeyframe
+        }
+    }
+
+    /// Encodes successive display lists as a stream of frames.
+    ///
+    /// A recording is a protobuf message whose fields are frames, keyframes
+    /// with tag 1 and delta frames with tag 2. The data returned for each frame
+    /// can be appended to a file as it's produced, and the concatenation is
+    /// read back by a `DisplayList.Player`.
+    ///
+    /// Keyframes are self-contained. Delta frames only encode the items whose
+    /// version changed since the last keyframe, and refer to the others by
+    /// identity. A keyframe is written every `keyframeInterval` frames so that
+    /// a replay can start part way through a recording.
+    package struct Recorder {
+        package var keyframeInterval: Int
+
+        private let state = FrameState()
+
+        private var framesSinceKeyframe: Int?
+
+        package init(keyframeInterval: Int = 60) {
+            self.keyframeInterval = keyframeInterval
+        }
+
+        /// Makes the next frame a keyframe.
+        package mutating func reset() {
+            framesSinceKeyframe = nil
+        }
+
+        package mutating func encodeFrame(_ list: DisplayList, time: Time) throws -> Data {
+            let isKeyframe: Bool
+            if let framesSinceKeyframe, framesSinceKeyframe < keyframeInterval - 1 {
+                isKeyframe = false
+                self.framesSinceKeyframe = framesSinceKeyframe + 1
+            } else {
+                isKeyframe = true
+                framesSinceKeyframe = 0
+                state.removeAll()
+            }
+            do {
+                return try ProtobufEncoder.encoding { [state] encoder in
+                    encoder.userInfo[FrameState.userInfoKey] = state
+                    try encoder.messageField(isKeyframe ? 1 : 2) { encoder in
+                        encoder.doubleField(1, time.seconds)
+                        try encoder.messageField(2, list)
+                    }
+                }
+            } catch {
+                // The items recorded before the failure were never written.
+                reset()
+                throw error
+            }
+        }
+    }
+
+    /// Decodes the frames written by a `DisplayList.Recorder`.
+    ///
+    /// Delta frames read before the first keyframe are skipped, so the data
+    /// passed to the player may start at any frame boundary.
+    package struct Player {
+        private let state = FrameState()
+
+        private var hasKeyframe = false
+
+        package init() {}
+
+        package mutating func decodeFrames(_ data: Data) throws -> [RecordedFrame] {
+            var decoder = ProtobufDecoder(data)
+            return try decodeFrames(from: &decoder)
+        }
+
+        /// Decodes the frames of a recording file, mapping it into memory
+        /// instead of reading it.
+        package mutating func decodeFrames(contentsOf url: URL) throws -> [RecordedFrame] {
+            var decoder = try ProtobufDecoder(mappingContentsOf: url)
+            return try decodeFrames(from: &decoder)
+        }
+
+        private mutating func decodeFrames(from decoder: inout ProtobufDecoder) throws -> [RecordedFrame] {
+            decoder.userInfo[FrameState.userInfoKey] = state
+            var frames: [RecordedFrame] = []
+            while let field = try decoder.nextField() {
+                let isKeyframe: Bool
+                switch field.tag {
+                case 1:
+                    isKeyframe = true
+                    hasKeyframe = true
+                    state.removeAll()
+                case 2 where hasKeyframe:
+                    isKeyframe = false
+                default:
+                    try decoder.skipField(field)
+                    continue
+                }
+                let frame = try decoder.messageField(field) { decoder in
+                    var time = Time.zero
+                    var list = DisplayList()
+                    while let field = try decoder.nextField() {
+                        switch field.tag {
+                        case 1: time = Time(seconds: try decoder.doubleField(field))
+                        case 2: list = try decoder.messageField(field)
+                        default: try decoder.skipField(field)
+                        }
+                    }
+                    return RecordedFrame(list: list, time: time, isKeyframe: isKeyframe)
+                }
+                frames.append(frame)
+            }
+            return frames
+        }
+    }
+}
+
+/* OpenSwiftUI Addition End */
@@ -0,0 +1,828 @@
+//
+//  DisplayListSoftwareRenderer.swift
+//  OpenSwiftUICore
+//
+//  Status: WIP
+
+package import Foundation
+package import OpenCoreGraphicsShims
+import Dispatch
+
+// MARK: - DisplayList + software rendering
+
+extension DisplayList {
+    package func softwareBitmap(
+        size: CGSize,
+        scale: CGFloat = 1.0,
+        pixelFormat: _RendererConfiguration.SoftwareOptions.PixelFormat = .rgba8,
+        tileSize: Int = SoftwareRasterizer.defaultTileSize
+    ) -> _RendererConfiguration.SoftwareOptions.Bitmap {
+        SoftwareRasterizer(
+            size: size,
+            scale: scale,
+            pixelFormat: pixelFormat,
+            tileSize: tileSize
+        ).render(self)
+    }
+
+    // MARK: - DisplayList.SoftwareRasterizer
+
+    /// A CPU scanline rasterizer which renders a display list into a bitmap
+    /// without RenderBox or a GPU.
+    ///
+    /// Color and shape fills, clips, opacity and affine transform effects are
+    /// supported; other content is skipped. The surface is split into square
+    /// tiles which are composited concurrently.
+    package struct SoftwareRasterizer {
+        package typealias PixelFormat = _RendererConfiguration.SoftwareOptions.PixelFormat
+
+        package typealias Bitmap = _RendererConfiguration.SoftwareOptions.Bitmap
+
+        package static let defaultTileSize = 64
+
+        package var size: CGSize
+
+        package var scale: CGFloat
+
+        package var pixelFormat: PixelFormat
+
+        package var tileSize: Int
+
+        package init(
+            size: CGSize,
+            scale: CGFloat = 1.0,
+            pixelFormat: PixelFormat = .rgba8,
+            tileSize: Int = defaultTileSize
+        ) {
+            self.size = size
+            self.scale = scale
+            self.pixelFormat = pixelFormat
+            self.tileSize = tileSize
+        }
+
+        package var pixelWidth: Int {
+            max(0, Int((size.width * scale).rounded(.up)))
+        }
+
+        package var pixelHeight: Int {
+            max(0, Int((size.height * scale).rounded(.up)))
+        }
+
+        package func render(_ list: DisplayList) -> Bitmap {
+            let width = pixelWidth
+            let height = pixelHeight
+            let pixelFormat = pixelFormat
+            var data = [UInt8](repeating: 0, count: width * height * pixelFormat.bytesPerPixel)
+            guard width > 0, height > 0 else {
+                return Bitmap(width: width, height: height, pixelFormat: pixelFormat, data: data)
+            }
+
+            var builder = SoftwareCommandBuilder(isLinear: pixelFormat.isLinear)
+            builder.append(
+                list: list,
+                state: .init(transform: CGAffineTransform(scaleX: scale, y: scale))
+            )
+            let commands = builder.commands
+
+            // Bin commands into tiles, keeping paint order within each tile.
+            let tileSize = max(8, tileSize)
+            let columns = (width + tileSize - 1) / tileSize
+            let rows = (height + tileSize - 1) / tileSize
+            var bins = [[Int]](repeating: [], count: columns * rows)
+            for (index, command) in commands.enumerated() {
+                guard let bounds = command.pixelBounds(width: width, height: height) else {
+                    continue
+                }
+                for row in bounds.minY / tileSize ... (bounds.maxY - 1) / tileSize {
+                    for column in bounds.minX / tileSize ... (bounds.maxX - 1) / tileSize {
+                        bins[row * columns + column].append(index)
+                    }
+                }
+            }
+
+            let binnedCommands = bins
+            data.withUnsafeMutableBytes { pixels in
+                DispatchQueue.concurrentPerform(iterations: columns * rows) { tileIndex in
+                    let minX = (tileIndex % columns) * tileSize
+                    let minY = (tileIndex / columns) * tileSize
+                    var tile = SoftwareTile(
+                        minX: minX,
+                        minY: minY,
+                        maxX: min(width, minX + tileSize),
+                        maxY: min(height, minY + tileSize)
+                    )
+                    for index in binnedCommands[tileIndex] {
+                        tile.composite(commands[index], width: width, height: height)
+                    }
+                    tile.encode(into: pixels, width: width, pixelFormat: pixelFormat)
+                }
+            }
+            return Bitmap(width: width, height: height, pixelFormat: pixelFormat, data: data)
+        }
+    }
+}
+
+// MARK: - SoftwareRect
+
+private struct SoftwareRect {
+    var minX: Float
+    var minY: Float
+    var maxX: Float
+    var maxY: Float
+
+    static let null = SoftwareRect(minX: .infinity, minY: .infinity, maxX: -.infinity, maxY: -.infinity)
+
+    init(minX: Float, minY: Float, maxX: Float, maxY: Float) {
+        self.minX = minX
+        self.minY = minY
+        self.maxX = maxX
+        self.maxY = maxY
+    }
+
+    init(_ rect: CGRect) {
+        let rect = rect.standardized
+        self.init(
+            minX: Float(rect.minX),
+            minY: Float(rect.minY),
+            maxX: Float(rect.maxX),
+            maxY: Float(rect.maxY)
+        )
+    }
+
+    var isEmpty: Bool {
+        !(minX < maxX && minY < maxY)
+    }
+
+    mutating func formUnion(_ point: CGPoint) {
+        minX = min(minX, Float(point.x))
+        minY = min(minY, Float(point.y))
+        maxX = max(maxX, Float(point.x))
+        maxY = max(maxY, Float(point.y))
+    }
+
+    func intersection(_ other: SoftwareRect) -> SoftwareRect {
+        SoftwareRect(
+            minX: max(minX, other.minX),
+            minY: max(minY, other.minY),
+            maxX: min(maxX, other.maxX),
+            maxY: min(maxY, other.maxY)
+        )
+    }
+}
+
+// MARK: - SoftwareEdge
+
+private struct SoftwareEdge {
+    var minY: Float
+    var maxY: Float
+    var x: Float
+    var slope: Float
+    var winding: Int32
+
+    init?(from p0: CGPoint, to p1: CGPoint) {
+        guard p0.y != p1.y else {
+            return nil
+        }
+        let (top, bottom) = p0.y < p1.y ? (p0, p1) : (p1, p0)
+        minY = Float(top.y)
+        maxY = Float(bottom.y)
+        x = Float(top.x)
+        slope = Float((bottom.x - top.x) / (bottom.y - top.y))
+        winding = p0.y < p1.y ? 1 : -1
+    }
+
+    @inline(__always)
+    func x(at y: Float) -> Float {
+        x + (y - minY) * slope
+    }
+}
+
+private struct SoftwareCrossing {
+    var x: Float
+    var winding: Int32
+}
+
+// MARK: - SoftwareShape
+
+/// A filled region in device space, stored as a flattened edge list with an
+/// axis-aligned rectangle fast path.
+private struct SoftwareShape {
+    var edges: [SoftwareEdge]
+    var rect: SoftwareRect?
+    var bounds: SoftwareRect
+    var isEOFilled: Bool
+    var isAntialiased: Bool
+    /// Whether the coverage is inverted, as for an inverse clip.
+    var isInverse: Bool
+
+    init(path: Path, style: FillStyle, transform: CGAffineTransform, isInverse: Bool = false) {
+        isEOFilled = style.isEOFilled
+        isAntialiased = style.isAntialiased
+        self.isInverse = isInverse
+        if case let .rect(rect) = path.storage, transform.isRectilinear {
+            let deviceRect = SoftwareRect(rect.applying(transform))
+            edges = []
+            self.rect = deviceRect
+            bounds = deviceRect
+        } else {
+            var flattener = SoftwarePathFlattener(transform: transform)
+            flattener.append(path)
+            flattener.closeSubpath()
+            edges = flattener.edges.sorted { $0.minY < $1.minY }
+            rect = nil
+            bounds = flattener.bounds
+        }
+    }
+
+    /// Writes the coverage of pixel row `y` in `x0 ..< x1` into `coverage`.
+    func coverage(
+        row y: Int,
+        x0: Int,
+        x1: Int,
+        into coverage: inout [Float],
+        crossings: inout [SoftwareCrossing]
+    ) {
+        fillCoverage(row: y, x0: x0, x1: x1, into: &coverage, crossings: &crossings)
+        if isInverse {
+            for index in 0 ..< x1 - x0 {
+                coverage[index] = 1 - min(coverage[index], 1)
+            }
+        }
+    }
+
+    private func fillCoverage(
+        row y: Int,
+        x0: Int,
+        x1: Int,
+        into coverage: inout [Float],
+        crossings: inout [SoftwareCrossing]
+    ) {
+        let count = x1 - x0
+        for index in 0 ..< count {
+            coverage[index] = 0
+        }
+        if let rect {
+            var rect = rect
+            if !isAntialiased {
+                rect = SoftwareRect(
+                    minX: rect.minX.rounded(),
+                    minY: rect.minY.rounded(),
+                    maxX: rect.maxX.rounded(),
+                    maxY: rect.maxY.rounded()
+                )
+            }
+            let top = Float(y)
+            let rowCoverage = max(0, min(top + 1, rect.maxY) - max(top, rect.minY))
+            guard rowCoverage > 0 else {
+                return
+            }
+            addSpan(from: rect.minX, to: rect.maxX, weight: rowCoverage, x0: x0, count: count, into: &coverage)
+            return
+        }
+        let samples = isAntialiased ? 4 : 1
+        let weight = 1 / Float(samples)
+        for sample in 0 ..< samples {
+            let sampleY = Float(y) + (Float(sample) + 0.5) * weight
+            crossings.removeAll(keepingCapacity: true)
+            for edge in edges {
+                guard edge.minY <= sampleY else {
+                    break
+                }
+                guard sampleY < edge.maxY else {
+                    continue
+                }
+                crossings.append(SoftwareCrossing(x: edge.x(at: sampleY), winding: edge.winding))
+            }
+            guard !crossings.isEmpty else {
+                continue
+            }
+            crossings.sort { $0.x < $1.x }
+            var winding: Int32 = 0
+            var spanStart: Float = 0
+            for crossing in crossings {
+                let wasInside = isInside(winding: winding)
+                winding += crossing.winding
+                let nowInside = isInside(winding: winding)
+                if !wasInside, nowInside {
+                    spanStart = crossing.x
+                } else if wasInside, !nowInside {
+                    addSpan(from: spanStart, to: crossing.x, weight: weight, x0: x0, count: count, into: &coverage)
+                }
+            }
+        }
+    }
+
+    @inline(__always)
+    private func isInside(winding: Int32) -> Bool {
+        isEOFilled ? winding & 1 != 0 : winding != 0
+    }
+
+    private func addSpan(
+        from start: Float,
+        to end: Float,
+        weight: Float,
+        x0: Int,
+        count: Int,
+        into coverage: inout [Float]
+    ) {
+        var start = start - Float(x0)
+        var end = end - Float(x0)
+        if !isAntialiased {
+            start = start.rounded()
+            end = end.rounded()
+        }
+        start = max(start, 0)
+        end = min(end, Float(count))
+        guard start < end else {
+            return
+        }
+        let first = Int(start)
+        let last = Int(end)
+        guard first != last else {
+            coverage[first] += (end - start) * weight
+            return
+        }
+        coverage[first] += (Float(first + 1) - start) * weight
+        var index = first + 1
+        while index < last {
+            coverage[index] += weight
+            index += 1
+        }
+        if last < count {
+            coverage[last] += (end - Float(last)) * weight
+        }
+    }
+}
+
+// MARK: - SoftwarePathFlattener
+
+private struct SoftwarePathFlattener {
+    /// The maximum distance in device pixels between a curve and its
+    /// flattened polyline.
+    static let tolerance: CGFloat = 0.25
+
+    let transform: CGAffineTransform
+    private(set) var edges: [SoftwareEdge] = []
+    private(set) var bounds: SoftwareRect = .null
+    private var subpathStart: CGPoint = .zero
+    private var current: CGPoint = .zero
+    private var hasCurrentPoint = false
+
+    init(transform: CGAffineTransform) {
+        self.transform = transform
+    }
+
+    mutating func append(_ path: Path) {
+        path.forEach { element in
+            switch element {
+            case let .move(to: point):
+                move(to: point)
+            case let .line(to: point):
+                addLine(to: point)
+            case let .quadCurve(to: end, control: control):
+                addQuadCurve(to: end, control: control)
+            case let .curve(to: end, control1: control1, control2: control2):
+                addCurve(to: end, control1: control1, control2: control2)
+            case .closeSubpath:
+                closeSubpath()
+            }
+        }
+    }
+
+    mutating func move(to point: CGPoint) {
+        closeSubpath()
+        let point = point.applying(transform)
+        subpathStart = point
+        current = point
+        hasCurrentPoint = true
+        bounds.formUnion(point)
+    }
+
+    mutating func addLine(to point: CGPoint) {
+        lineTo(point.applying(transform))
+    }
+
+    mutating func addQuadCurve(to end: CGPoint, control: CGPoint) {
+        guard hasCurrentPoint else {
+            move(to: end)
+            return
+        }
+        let p0 = current
+        let p1 = control.applying(transform)
+        let p2 = end.applying(transform)
+        let dx = p0.x - 2 * p1.x + p2.x
+        let dy = p0.y - 2 * p1.y + p2.y
+        let count = Self.segmentCount(sqrt(dx * dx + dy * dy) * 0.25)
+        for step in 1 ... count {
+            let t = CGFloat(step) / CGFloat(count)
+            let u = 1 - t
+            lineTo(CGPoint(
+                x: u * u * p0.x + 2 * u * t * p1.x + t * t * p2.x,
+                y: u * u * p0.y + 2 * u * t * p1.y + t * t * p2.y
+            ))
+        }
+    }
+
+    mutating func addCurve(to end: CGPoint, control1: CGPoint, control2: CGPoint) {
+        guard hasCurrentPoint else {
+            move(to: end)
+            return
+        }
+        let p0 = current
+        let p1 = control1.applying(transform)
+        let p2 = control2.applying(transform)
+        let p3 = end.applying(transform)
+        let ax = p0.x - 2 * p1.x + p2.x
+        let ay = p0.y - 2 * p1.y + p2.y
+        let bx = p1.x - 2 * p2.x + p3.x
+        let by = p1.y - 2 * p2.y + p3.y
+        let deviation = max(sqrt(ax * ax + ay * ay), sqrt(bx * bx + by * by))
+        let count = Self.segmentCount(deviation * 0.75)
+        for step in 1 ... count {
+            let t = CGFloat(step) / CGFloat(count)
+            let u = 1 - t
+            let a = u * u * u
+            let b = 3 * u * u * t
+            let c = 3 * u * t * t
+            let d = t * t * t
+            lineTo(CGPoint(
+                x: a * p0.x + b * p1.x + c * p2.x + d * p3.x,
+                y: a * p0.y + b * p1.y + c * p2.y + d * p3.y
+            ))
+        }
+    }
+
+    mutating func closeSubpath() {
+        guard hasCurrentPoint else {
+            return
+        }
+        appendEdge(from: current, to: subpathStart)
+        current = subpathStart
+    }
+
+    private mutating func lineTo(_ point: CGPoint) {
+        guard hasCurrentPoint else {
+            subpathStart = point
+            current = point
+            hasCurrentPoint = true
+            bounds.formUnion(point)
+            return
+        }
+        appendEdge(from: current, to: point)
+        current = point
+    }
+
+    private mutating func appendEdge(from p0: CGPoint, to p1: CGPoint) {
+        bounds.formUnion(p1)
+        if let edge = SoftwareEdge(from: p0, to: p1) {
+            edges.append(edge)
+        }
+    }
+
+    private static func segmentCount(_ deviation: CGFloat) -> Int {
+        guard deviation.isFinite, deviation > 0 else {
+            return 1
+        }
+        return min(max(Int(sqrt(deviation / tolerance).rounded(.up)), 1), 256)
+    }
+}
+
+// MARK: - SoftwareFillCommand
+
+private struct SoftwareFillCommand {
+    var shape: SoftwareShape
+    var clips: [SoftwareShape]
+    var color: SIMD4<Float>
+    var bounds: SoftwareRect
+
+    func pixelBounds(width: Int, height: Int) -> (minX: Int, minY: Int, maxX: Int, maxY: Int)? {
+        guard !bounds.isEmpty else {
+            return nil
+        }
+        func clamp(_ value: Float, _ limit: Int) -> Int {
+            Int(min(max(value, 0), Float(limit)))
+        }
+        let minX = clamp(bounds.minX.rounded(.down), width)
+        let minY = clamp(bounds.minY.rounded(.down), height)
+        let maxX = clamp(bounds.maxX.rounded(.up), width)
+        let maxY = clamp(bounds.maxY.rounded(.up), height)
+        guard minX < maxX, minY < maxY else {
+            return nil
+        }
+        return (minX, minY, maxX, maxY)
+    }
+}
+
+// MARK: - SoftwareCommandBuilder
+
+private struct SoftwareCommandBuilder {
+    struct State {
+        var transform: CGAffineTransform
+        var opacity: Float = 1.0
+        var clips: [SoftwareShape] = []
+    }
+
+    let isLinear: Bool
+    var commands: [SoftwareFillCommand] = []
+
+    init(isLinear: Bool) {
+        self.isLinear = isLinear
+    }
+
+    mutating func append(list: DisplayList, state: State) {
+        for item in list.items {
+            append(item: item, state: state)
+        }
+    }
+
+    private mutating func append(item: DisplayList.Item, state: State) {
+        let transform = CGAffineTransform(
+            translationX: item.frame.minX,
+            y: item.frame.minY
+        ).concatenating(state.transform)
+        switch item.value {
+        case let .content(content):
+            append(content: content, size: item.frame.size, transform: transform, state: state)
+        case let .effect(effect, list):
+            append(effect: effect, list: list, transform: transform, state: state)
+        case let .states(states):
+            var state = state
+            state.transform = transform
+            for (_, list) in states {
+                append(list: list, state: state)
+            }
+        case .empty:
+            break
+        }
+    }
+
+    private mutating func append(
+        content: DisplayList.Content,
+        size: CGSize,
+        transform: CGAffineTransform,
+        state: State
+    ) {
+        switch content.value {
+        case let .color(color):
+            fill(
+                Path(CGRect(origin: .zero, size: size)),
+                style: FillStyle(),
+                color: color,
+                transform: transform,
+                state: state
+            )
+        case let .shape(path, paint, style):
+            guard let color = paint.as(type: Color.Resolved.self) else {
+                return
+            }
+            fill(path, style: style, color: color, transform: transform, state: state)
+        case let .flattened(list, offset, _):
+            var state = state
+            state.transform = CGAffineTransform(
+                translationX: offset.x,
+                y: offset.y
+            ).concatenating(transform)
+            append(list: list, state: state)
+        default:
+            break
+        }
+    }
+
+    private mutating func append(
+        effect: DisplayList.Effect,
+        list: DisplayList,
+        transform: CGAffineTransform,
+        state: State
+    ) {
+        var state = state
+        state.transform = transform
+        switch effect {
+        case let .opacity(alpha):
+            state.opacity *= alpha
+        case let .transform(.affine(affine)):
+            state.transform = affine.concatenating(transform)
+        case let .clip(path, style, options):
+            state.clips.append(SoftwareShape(
+                path: path,
+                style: style,
+                transform: transform,
+                isInverse: options.contains(.inverse)
+            ))
+        default:
+            break
+        }
+        guard state.opacity > 0 else {
+            return
+        }
+        append(list: list, state: state)
+    }
+
+    private mutating func fill(
+        _ path: Path,
+        style: FillStyle,
+        color: Color.Resolved,
+        transform: CGAffineTransform,
+        state: State
+    ) {
+        let opacity = color.opacity * state.opacity
+        guard opacity > 0 else {
+            return
+        }
+        let shape = SoftwareShape(path: path, style: style, transform: transform)
+        var bounds = shape.bounds
+        for clip in state.clips where !clip.isInverse {
+            bounds = bounds.intersection(clip.bounds)
+        }
+        guard !bounds.isEmpty else {
+            return
+        }
+        let components = isLinear
+            ? SIMD4(color.linearRed, color.linearGreen, color.linearBlue, 1)
+            : SIMD4(color.red, color.green, color.blue, 1)
+        commands.append(SoftwareFillCommand(
+            shape: shape,
+            clips: state.clips,
+            color: components * opacity,
+            bounds: bounds
+        ))
+    }
+}
+
+// MARK: - SoftwareTile
+
+private struct SoftwareTile {
+    let minX: Int
+    let minY: Int
+    let maxX: Int
+    let maxY: Int
+    private var colors: [SIMD4<Float>]
+    private var coverage: [Float]
+    private var clipCoverage: [Float]
+    private var crossings: [SoftwareCrossing] = []
+
+    init(minX: Int, minY: Int, maxX: Int, maxY: Int) {
+        self.minX = minX
+        self.minY = minY
+        self.maxX = maxX
+        self.maxY = maxY
+        colors = Array(repeating: .zero, count: (maxX - minX) * (maxY - minY))
+        coverage = Array(repeating: 0, count: maxX - minX)
+        clipCoverage = Array(repeating: 0, count: maxX - minX)
+    }
+
+    /// Composites `command` source-over into the premultiplied tile buffer.
+    mutating func composite(_ command: SoftwareFillCommand, width: Int, height: Int) {
+        guard let bounds = command.pixelBounds(width: width, height: height) else {
+            return
+        }
+        let x0 = max(minX, bounds.minX)
+        let x1 = min(maxX, bounds.maxX)
+        let y0 = max(minY, bounds.minY)
+        let y1 = min(maxY, bounds.maxY)
+        guard x0 < x1, y0 < y1 else {
+            return
+        }
+        let tileWidth = maxX - minX
+        for y in y0 ..< y1 {
+            command.shape.coverage(row: y, x0: x0, x1: x1, into: &coverage, crossings: &crossings)
+            for clip in command.clips {
+                clip.coverage(row: y, x0: x0, x1: x1, into: &clipCoverage, crossings: &crossings)
+                for index in 0 ..< x1 - x0 {
+                    coverage[index] *= clipCoverage[index]
+                }
+            }
+            let rowOffset = (y - minY) * tileWidth - minX
+            for x in x0 ..< x1 {
+                let alpha = min(coverage[x - x0], 1)
+                guard alpha > 0 else {
+                    continue
+                }
+                let source = command.color * alpha
+                let index = rowOffset + x
+                colors[index] = source + colors[index] * (1 - source.w)
+            }
+        }
+    }
+
+    func encode(
+        into pixels: UnsafeMutableRawBufferPointer,
+        width: Int,
+        pixelFormat: _RendererConfiguration.SoftwareOptions.PixelFormat
+    ) {
+        let tileWidth = maxX - minX
+        let bytesPerPixel = pixelFormat.bytesPerPixel
+        for y in minY ..< maxY {
+            for x in minX ..< maxX {
+                let color = colors[(y - minY) * tileWidth + (x - minX)]
+                let offset = (y * width + x) * bytesPerPixel
+                switch pixelFormat {
+                case .rgba8:
+                    let value = (color.clamped(lowerBound: .zero, upperBound: .one) * 255).rounded(.toNearestOrAwayFromZero)
+                    pixels[offset] = UInt8(value.x)
+                    pixels[offset + 1] = UInt8(value.y)
+                    pixels[offset + 2] = UInt8(value.z)
+                    pixels[offset + 3] = UInt8(value.w)
+                case .rgba16Float:
+                    for component in 0 ..< 4 {
+                        pixels.storeBytes(
+                            of: softwareHalfFloatBits(color[component]).littleEndian,
+                            toByteOffset: offset + component * 2,
+                            as: UInt16.self
+                        )
+                    }
+                }
+            }
+        }
+    }
+}
+
+/// Converts `value` to the bit pattern of an IEEE 754 half-precision float,
+/// rounding to nearest.
+package func softwareHalfFloatBits(_ value: Float) -> UInt16 {
+    let bits = value.bitPattern
+    let sign = UInt16(truncatingIfNeeded: (bits >> 16) & 0x8000)
+    guard !value.isNaN else {
+        return sign | 0x7E00
+    }
+    let exponent = Int((bits >> 23) & 0xFF) - 127 + 15
+    let mantissa = bits & 0x7F_FFFF
+    if exponent >= 0x1F {
+        return sign | 0x7C00
+    }
+    if exponent <= 0 {
+        guard exponent >= -10 else {
+            return sign
+        }
+        let subnormal = (mantissa | 0x80_0000) >> UInt32(1 - exponent)
+        return sign | UInt16(truncatingIfNeeded: (subnormal + 0x1000) >> 13)
+    }
+    let rounded = (UInt32(exponent) << 10 | mantissa >> 13) + ((mantissa >> 12) & 1)
+    return sign | UInt16(truncatingIfNeeded: rounded)
+}
+
+// MARK: - SoftwareRenderer
+
+final class SoftwareRenderer: ViewRendererBase {
+    let platform: DisplayList.ViewUpdater.Platform
+    weak var host: (any ViewRendererHost)?
+    var options: _RendererConfiguration.SoftwareOptions
+    private var seed: DisplayList.Seed = .init()
+    private var hasRendered = false
+
+    init(
+        platform: DisplayList.ViewUpdater.Platform,
+        host: (any ViewRendererHost)?,
+        options: _RendererConfiguration.SoftwareOptions
+    ) {
+        self.platform = platform
+        self.host = host
+        self.options = options
+    }
+
+    var exportedObject: AnyObject? {
+        nil
+    }
+
+    func render(
+        rootView: AnyObject,
+        from list: DisplayList,
+        time: Time,
+        version: DisplayList.Version,
+        maxVersion: DisplayList.Version,
+        environment: DisplayList.ViewRenderer.Environment
+    ) -> Time {
+        let nextSeed = DisplayList.Seed(version)
+        guard !hasRendered || nextSeed != seed else {
+            return .infinity
+        }
+        hasRendered = true
+        seed = nextSeed
+        let bitmap = list.softwareBitmap(
+            size: options.surface,
+            scale: options.scale,
+            pixelFormat: options.pixelFormat,
+            tileSize: options.tileSize
+        )
+        options.frameHandler?(bitmap)
+        if let host, let observer = host.as(ViewGraphRenderObserver.self) {
+            observer.didRender()
+        }
+        return .infinity
+    }
+
+    func renderAsync(
+        to list: DisplayList,
+        time: Time,
+        targetTimestamp: Time?,
+        version: DisplayList.Version,
+        maxVersion: DisplayList.Version
+    ) -> Time? {
+        nil
+    }
+
+    func destroy(rootView: AnyObject) {}
+
+    var viewCacheIsEmpty: Bool {
+        true
+    }
+}
@@ -19,6 +19,17 @@ extension DisplayList {
     package func stdoutDescription(
         surface: CGSize,
         version: DisplayList.Version
+    ) -> String {
+        var flatList = FlatDisplayList()
+        return stdoutDescription(surface: surface, version: version, flatList: &flatList)
+    }
+
+    /// Describes the display list, flattening it into `flatList` so that a
+    /// renderer can reuse the same storage for every frame.
+    package func stdoutDescription(
+        surface: CGSize,
+        version: DisplayList.Version,
+        flatList: inout FlatDisplayList
     ) -> String {
         var lines = [
             "OpenSwiftUI backend: stdout",
@@ -26,7 +37,7 @@ extension DisplayList {
             "display-list-version: \(version.value)",
             "rendered:",
         ]
-        for command in stdoutRenderCommands() {
+        for command in stdoutRenderCommands(flatList: &flatList) {
             lines.append("  - \(command.description)")
         }
         return lines.joined(separator: "\n")
@@ -37,6 +48,23 @@ extension DisplayList {
         version: DisplayList.Version,
         terminalSize: _RendererConfiguration.StdoutOptions.TerminalSize,
         colorMode: _RendererConfiguration.StdoutOptions.ColorMode
+    ) -> String {
+        var flatList = FlatDisplayList()
+        return stdoutTerminalDescription(
+            surface: surface,
+            version: version,
+            terminalSize: terminalSize,
+            colorMode: colorMode,
+            flatList: &flatList
+        )
+    }
+
+    package func stdoutTerminalDescription(
+        surface: CGSize,
+        version: DisplayList.Version,
+        terminalSize: _RendererConfiguration.StdoutOptions.TerminalSize,
+        colorMode: _RendererConfiguration.StdoutOptions.ColorMode,
+        flatList: inout FlatDisplayList
     ) -> String {
         let resolvedColorMode = StdoutTerminalSupport.resolvedColorMode(
             colorMode,
@@ -47,7 +75,7 @@ extension DisplayList {
             surface: surface,
             terminalSize: terminalSize
         )
-        canvas.draw(stdoutRenderCommands())
+        canvas.draw(stdoutRenderCommands(flatList: &flatList))
         return [
             "OpenSwiftUI backend: stdout",
             "surface: \(stdoutFormat(surface.width))x\(stdoutFormat(surface.height))",
@@ -58,9 +86,86 @@ extension DisplayList {
         ].joined(separator: "\n")
     }
 
-    private func stdoutRenderCommands() -> [StdoutRenderCommand] {
-        var visitor = StdoutRenderCommandVisitor()
-        visitor.append(list: self)
+    /// Renders the display list into a terminal-cell canvas and returns the
+    /// ANSI output needed to bring a terminal showing `previousFrame` up to
+    /// date.
+    ///
+    /// When `previousFrame` is `nil`, or its terminal size or color mode
+    /// differs, the screen is cleared and every cell is written. Otherwise
+    /// only the damaged cell rectangles are rewritten, each row prefixed by
+    /// a cursor-move sequence. If the display list seed is unchanged the
+    /// result is empty and the canvas is not rebuilt.
+    package func stdoutTerminalUpdate(
+        from previousFrame: inout StdoutTerminalFrame?,
+        surface: CGSize,
+        version: DisplayList.Version,
+        terminalSize: _RendererConfiguration.StdoutOptions.TerminalSize,
+        colorMode: _RendererConfiguration.StdoutOptions.ColorMode
+    ) -> String {
+        var flatList = FlatDisplayList()
+        return stdoutTerminalUpdate(
+            from: &previousFrame,
+            surface: surface,
+            version: version,
+            terminalSize: terminalSize,
+            colorMode: colorMode,
+            flatList: &flatList
+        )
+    }
+
+    package func stdoutTerminalUpdate(
+        from previousFrame: inout StdoutTerminalFrame?,
+        surface: CGSize,
+        version: DisplayList.Version,
+        terminalSize: _RendererConfiguration.StdoutOptions.TerminalSize,
+        colorMode: _RendererConfiguration.StdoutOptions.ColorMode,
+        flatList: inout FlatDisplayList
+    ) -> String {
+        let resolvedColorMode = StdoutTerminalSupport.resolvedColorMode(
+            colorMode,
+            environment: ProcessInfo.processInfo.environment,
+            isTerminal: StdoutTerminalSupport.stdoutIsTerminal
+        )
+        let seed = DisplayList.Seed(version)
+        var canvas = StdoutTerminalCanvas(
+            surface: surface,
+            terminalSize: terminalSize
+        )
+        if let previous = previousFrame,
+           previous.canvas.isCompatible(with: canvas),
+           previous.colorMode == resolvedColorMode {
+            guard previous.seed != seed else {
+                return ""
+            }
+            canvas.draw(stdoutRenderCommands(flatList: &flatList))
+            let damage = canvas.damage(since: previous.canvas)
+            let output = canvas.damageDescription(damage, colorMode: resolvedColorMode)
+            previousFrame = StdoutTerminalFrame(
+                canvas: canvas,
+                seed: seed,
+                colorMode: resolvedColorMode,
+                damage: damage
+            )
+            return output
+        }
+        canvas.draw(stdoutRenderCommands(flatList: &flatList))
+        let damage = [canvas.bounds]
+        let output = "\u{001B}[H\u{001B}[2J" + canvas.damageDescription(damage, colorMode: resolvedColorMode)
+        previousFrame = StdoutTerminalFrame(
+            canvas: canvas,
+            seed: seed,
+            colorMode: resolvedColorMode,
+            damage: damage
+        )
+        return output
+    }
+
+    private func stdoutRenderCommands(flatList: inout FlatDisplayList) -> [StdoutRenderCommand] {
+        /* OpenSwiftUI Addition Begin */
+        flatList.assign(self)
+        var visitor = StdoutRenderCommandVisitor(flatList: flatList)
+        visitor.append(span: flatList.roots)
+        /* OpenSwiftUI Addition End */
         return visitor.commands
     }
 }
@@ -101,36 +206,47 @@ private struct StdoutTextRun {
 }
 
 private struct StdoutRenderCommandVisitor {
+    let flatList: FlatDisplayList
     var commands: [StdoutRenderCommand] = []
 
+    init(flatList: FlatDisplayList) {
+        self.flatList = flatList
+    }
+
     mutating func append(
-        list: DisplayList,
+        span: FlatDisplayList.Span,
         transform: CGAffineTransform = .identity,
         opacity: Float = 1.0
     ) {
-        for item in list.items {
-            append(item: item, transform: transform, opacity: opacity)
+        for index in span {
+            append(node: flatList.nodes[index], transform: transform, opacity: opacity)
         }
     }
 
     private mutating func append(
-        item: DisplayList.Item,
+        node: FlatDisplayList.Node,
         transform: CGAffineTransform,
         opacity: Float
     ) {
-        switch item.value {
-        case let .content(content):
+        switch node.value {
+        case let .content(index):
+            append(
+                content: flatList.contents[Int(index)],
+                children: node.children,
+                frame: node.frame.applying(transform),
+                transform: transform,
+                opacity: opacity
+            )
+        case let .effect(index, _):
             append(
-                content: content,
-                frame: item.frame.applying(transform),
+                effect: flatList.effects[Int(index)],
+                children: node.children,
                 transform: transform,
                 opacity: opacity
             )
-        case let .effect(effect, list):
-            append(effect: effect, list: list, transform: transform, opacity: opacity)
-        case let .states(states):
-            for (_, list) in states {
-                append(list: list, transform: transform, opacity: opacity)
+        case let .states(span):
+            for state in span {
+                append(span: flatList.states[state].children, transform: transform, opacity: opacity)
             }
         case .empty:
             break
@@ -139,6 +255,7 @@ private struct StdoutRenderCommandVisitor {
 
     private mutating func append(
         content: DisplayList.Content,
+        children: FlatDisplayList.Span,
         frame: CGRect,
         transform: CGAffineTransform,
         opacity: Float
@@ -151,7 +268,7 @@ private struct StdoutRenderCommandVisitor {
                 commands.append(.fill(frame: frame, color: color.multiplyingOpacity(by: opacity)))
             }
         case let .text(text, _):
-            #if os(macOS)
+            #if os(macOS) || !canImport(Darwin)
             let runs = text.stdoutTextRuns.map { $0.multiplyingOpacity(by: opacity) }
             commands.append(.text(
                 frame: frame,
@@ -162,9 +279,9 @@ private struct StdoutRenderCommandVisitor {
             #else
             break
             #endif
-        case let .flattened(list, offset, _):
+        case let .flattened(_, offset, _):
             append(
-                list: list,
+                span: children,
                 transform: transform.concatenating(
                     CGAffineTransform(translationX: frame.minX + offset.x, y: frame.minY + offset.y)
                 ),
@@ -177,17 +294,17 @@ private struct StdoutRenderCommandVisitor {
 
     private mutating func append(
         effect: DisplayList.Effect,
-        list: DisplayList,
+        children: FlatDisplayList.Span,
         transform: CGAffineTransform,
         opacity: Float
     ) {
         switch effect {
         case let .opacity(alpha):
-            append(list: list, transform: transform, opacity: opacity * alpha)
+            append(span: children, transform: transform, opacity: opacity * alpha)
         case let .transform(.affine(affine)):
-            append(list: list, transform: transform.concatenating(affine), opacity: opacity)
+            append(span: children, transform: transform.concatenating(affine), opacity: opacity)
         default:
-            append(list: list, transform: transform, opacity: opacity)
+            append(span: children, transform: transform, opacity: opacity)
         }
     }
 }
@@ -208,7 +325,7 @@ private extension AnyResolvedPaint {
     }
 }
 
-#if os(macOS)
+#if os(macOS) || !canImport(Darwin)
 private extension StyledTextContentView {
     var stdoutTextRuns: [StdoutTextRun] {
         guard let storage = text.storage, storage.length > 0 else {
@@ -234,7 +351,11 @@ private func stdoutResolvedColor(_ value: Any) -> Color.Resolved? {
     if let color = value as? Color.Resolved {
         return color
     }
+    #if canImport(Darwin)
     return Color.Resolved(platformColor: value as AnyObject)
+    #else
+    return nil
+    #endif
 }
 #endif
 
@@ -279,6 +400,18 @@ package enum StdoutTerminalSupport {
         return terminal.isEmpty ? .monochrome : .ansi16
     }
 
+    /// Writes `output` to standard output without a trailing newline and
+    /// flushes it, so cursor-addressed updates reach the terminal at once.
+    package static func write(_ output: String) {
+        guard !output.isEmpty else {
+            return
+        }
+        print(output, terminator: "")
+        #if canImport(Darwin) || canImport(Glibc)
+        fflush(stdout)
+        #endif
+    }
+
     package static func terminalSize(
         environment: [String: String] = ProcessInfo.processInfo.environment
     ) -> _RendererConfiguration.StdoutOptions.TerminalSize {
@@ -311,13 +444,54 @@ private extension _RendererConfiguration.StdoutOptions.ColorMode {
     }
 }
 
+// MARK: - Terminal damage tracking
+
+/// A rectangle of terminal cells which changed between two frames.
+package struct StdoutTerminalDamage: Equatable {
+    package var columns: Range<Int>
+    package var rows: Range<Int>
+
+    package init(columns: Range<Int>, rows: Range<Int>) {
+        self.columns = columns
+        self.rows = rows
+    }
+}
+
+/// The terminal contents written by the previous incremental terminal
+/// update, used to compute the damage of the next one.
+package struct StdoutTerminalFrame {
+    fileprivate var canvas: StdoutTerminalCanvas
+    fileprivate var seed: DisplayList.Seed
+    fileprivate var colorMode: _RendererConfiguration.StdoutOptions.ColorMode
+
+    /// The cell rectangles rewritten by the update which produced this frame.
+    package var damage: [StdoutTerminalDamage]
+
+    fileprivate init(
+        canvas: StdoutTerminalCanvas,
+        seed: DisplayList.Seed,
+        colorMode: _RendererConfiguration.StdoutOptions.ColorMode,
+        damage: [StdoutTerminalDamage]
+    ) {
+        self.canvas = canvas
+        self.seed = seed
+        self.colorMode = colorMode
+        self.damage = damage
+    }
+}
+
 private struct StdoutTerminalCanvas {
-    private struct Cell {
+    private struct Cell: Equatable {
         var character: Character?
         var foreground: Color.Resolved?
         var background: Color.Resolved?
     }
 
+    /// The number of unchanged cells which may be rewritten to join two
+    /// damaged spans on the same row. A cursor move costs at least six
+    /// bytes, so rewriting a few clean cells is cheaper.
+    private static let maximumCleanGap = 4
+
     let surface: CGSize
     let columns: Int
     let rows: Int
@@ -356,35 +530,116 @@ private struct StdoutTerminalCanvas {
         colorMode: _RendererConfiguration.StdoutOptions.ColorMode
     ) -> String {
         (0..<rows).map { row in
-            var result = ""
-            var activeForeground: Color.Resolved?
-            var activeBackground: Color.Resolved?
-            for column in 0..<columns {
-                let cell = cells[index(column: column, row: row)]
-                if colorMode != .monochrome,
-                   cell.foreground != activeForeground || cell.background != activeBackground {
-                    result += stdoutANSISequence(
-                        foreground: cell.foreground,
-                        background: cell.background,
-                        colorMode: colorMode
-                    )
-                    activeForeground = cell.foreground
-                    activeBackground = cell.background
-                }
-                if let character = cell.character {
-                    result.append(character)
-                } else if colorMode == .monochrome, cell.background != nil {
-                    result.append("█")
+            description(row: row, columns: 0..<columns, colorMode: colorMode)
+        }.joined(separator: "\n")
+    }
+
+    var bounds: StdoutTerminalDamage {
+        StdoutTerminalDamage(columns: 0..<columns, rows: 0..<rows)
+    }
+
+    func isCompatible(with other: StdoutTerminalCanvas) -> Bool {
+        columns == other.columns && rows == other.rows && surface == other.surface
+    }
+
+    /// Returns the rectangles of cells which differ from `previous`.
+    ///
+    /// Changed cells on a row are grouped into spans, and spans covering the
+    /// same columns on consecutive rows are merged into a single rectangle.
+    func damage(since previous: StdoutTerminalCanvas) -> [StdoutTerminalDamage] {
+        var damage: [StdoutTerminalDamage] = []
+        var openRects: [Int] = []
+        for row in 0..<rows {
+            var nextOpenRects: [Int] = []
+            for span in damagedSpans(row: row, since: previous) {
+                if let index = openRects.first(where: { damage[$0].columns == span }) {
+                    damage[index].rows = damage[index].rows.lowerBound..<(row + 1)
+                    nextOpenRects.append(index)
                 } else {
-                    result.append(" ")
+                    nextOpenRects.append(damage.count)
+                    damage.append(StdoutTerminalDamage(columns: span, rows: row..<(row + 1)))
+                }
+            }
+            openRects = nextOpenRects
+        }
+        return damage
+    }
+
+    private func damagedSpans(row: Int, since previous: StdoutTerminalCanvas) -> [Range<Int>] {
+        func isDamaged(_ column: Int) -> Bool {
+            let index = index(column: column, row: row)
+            return cells[index] != previous.cells[index]
+        }
+        var spans: [Range<Int>] = []
+        var column = 0
+        while column < columns {
+            guard isDamaged(column) else {
+                column += 1
+                continue
+            }
+            var end = column + 1
+            var scan = end
+            while scan < columns, scan - end <= Self.maximumCleanGap {
+                if isDamaged(scan) {
+                    end = scan + 1
                 }
+                scan += 1
+            }
+            spans.append(column..<end)
+            column = scan
+        }
+        return spans
+    }
+
+    /// Returns the output which rewrites the cells in `damage`, moving the
+    /// cursor to the start of each damaged row span.
+    func damageDescription(
+        _ damage: [StdoutTerminalDamage],
+        colorMode: _RendererConfiguration.StdoutOptions.ColorMode
+    ) -> String {
+        var result = ""
+        for rect in damage {
+            for row in rect.rows {
+                result += "\u{001B}[\(row + 1);\(rect.columns.lowerBound + 1)H"
+                result += description(row: row, columns: rect.columns, colorMode: colorMode)
             }
+        }
+        return result
+    }
+
+    private func description(
+        row: Int,
+        columns: Range<Int>,
+        colorMode: _RendererConfiguration.StdoutOptions.ColorMode
+    ) -> String {
+        var result = ""
+        var activeForeground: Color.Resolved?
+        var activeBackground: Color.Resolved?
+        for column in columns {
+            let cell = cells[index(column: column, row: row)]
             if colorMode != .monochrome,
-               activeForeground != nil || activeBackground != nil {
-                result += "\u{001B}[0m"
+               cell.foreground != activeForeground || cell.background != activeBackground {
+                result += stdoutANSISequence(
+                    foreground: cell.foreground,
+                    background: cell.background,
+                    colorMode: colorMode
+                )
+                activeForeground = cell.foreground
+                activeBackground = cell.background
             }
-            return result
-        }.joined(separator: "\n")
+            if let character = cell.character {
+                result.append(character)
+            } else if colorMode == .monochrome, cell.background != nil {
+                result.append("█")
+            } else {
+                result.append(" ")
+            }
+        }
+        if colorMode != .monochrome,
+           activeForeground != nil || activeBackground != nil {
+            result += "\u{001B}[0m"
+        }
+        return result
     }
 
     private mutating func fill(frame: CGRect, color: Color.Resolved) {
@@ -647,14 +902,22 @@ private func stdoutColorDistance(
 // MARK: - Stdout output formatting
 
 private protocol StdoutOutputFormatter {
-    func format(_ list: DisplayList, version: DisplayList.Version) -> String
+    func format(
+        _ list: DisplayList,
+        version: DisplayList.Version,
+        flatList: inout FlatDisplayList
+    ) -> String
 }
 
 private struct StdoutDisplayListFormatter: StdoutOutputFormatter {
     let surface: CGSize
 
-    func format(_ list: DisplayList, version: DisplayList.Version) -> String {
-        list.stdoutDescription(surface: surface, version: version)
+    func format(
+        _ list: DisplayList,
+        version: DisplayList.Version,
+        flatList: inout FlatDisplayList
+    ) -> String {
+        list.stdoutDescription(surface: surface, version: version, flatList: &flatList)
     }
 }
 
@@ -663,12 +926,17 @@ private struct StdoutTerminalFormatter: StdoutOutputFormatter {
     let terminalSize: _RendererConfiguration.StdoutOptions.TerminalSize
     let colorMode: _RendererConfiguration.StdoutOptions.ColorMode
 
-    func format(_ list: DisplayList, version: DisplayList.Version) -> String {
+    func format(
+        _ list: DisplayList,
+        version: DisplayList.Version,
+        flatList: inout FlatDisplayList
+    ) -> String {
         list.stdoutTerminalDescription(
             surface: surface,
             version: version,
             terminalSize: terminalSize,
-            colorMode: colorMode
+            colorMode: colorMode,
+            flatList: &flatList
         )
     }
 }
@@ -678,7 +946,7 @@ private extension _RendererConfiguration.StdoutOptions {
         switch viewMode {
         case .displayList:
             StdoutDisplayListFormatter(surface: surface)
-        case .terminal:
+        case .terminal, .incrementalTerminal:
             StdoutTerminalFormatter(
                 surface: surface,
                 terminalSize: terminalSize ?? StdoutTerminalSupport.terminalSize(),
@@ -696,6 +964,10 @@ final class StdoutRenderer: ViewRendererBase {
     var options: _RendererConfiguration.StdoutOptions
     private var seed: DisplayList.Seed = .init()
     private var hasRendered = false
+    private var terminalFrame: StdoutTerminalFrame?
+    /// The flattened display list, reassigned for every frame so that its
+    /// storage is allocated once.
+    private var flatList = FlatDisplayList()
 
     init(
         platform: DisplayList.ViewUpdater.Platform,
@@ -725,7 +997,19 @@ final class StdoutRenderer: ViewRendererBase {
         }
         hasRendered = true
         seed = nextSeed
-        print(options.outputFormatter.format(list, version: version))
+        if options.viewMode == .incrementalTerminal {
+            StdoutTerminalSupport.write(list.stdoutTerminalUpdate(
+                from: &terminalFrame,
+                surface: options.surface,
+                version: version,
+                terminalSize: options.terminalSize ?? StdoutTerminalSupport.terminalSize(),
+                colorMode: options.colorMode,
+                flatList: &flatList
+            ))
+        } else {
+            terminalFrame = nil
+            print(options.outputFormatter.format(list, version: version, flatList: &flatList))
+        }
         if let host, let observer = host.as(ViewGraphRenderObserver.self) {
             observer.didRender()
         }
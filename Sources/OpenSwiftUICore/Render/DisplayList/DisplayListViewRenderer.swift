@@ -82,6 +82,7 @@ extension DisplayList {
             /* OpenSwiftUI Addition Begin */
             #if !OPENSWIFTUI_SWIFTUI_RENDERER
             case stdout
+            case software
             #endif
             /* OpenSwiftUI Addition End */
         }
@@ -107,6 +108,7 @@ extension DisplayList {
             /* OpenSwiftUI Addition Begin */
             #if !OPENSWIFTUI_SWIFTUI_RENDERER
             case .stdout: state == .stdout
+            case .software: state == .software
             #endif
             /* OpenSwiftUI Addition End */
             }
@@ -131,6 +133,10 @@ extension DisplayList {
                     let stdoutRenderer = renderer as! StdoutRenderer
                     stdoutRenderer.options = options
                     stdoutRenderer.host = host
+                case let .software(options):
+                    let softwareRenderer = renderer as! SoftwareRenderer
+                    softwareRenderer.options = options
+                    softwareRenderer.host = host
                 #endif
                 /* OpenSwiftUI Addition End */
                 }
@@ -158,6 +164,13 @@ extension DisplayList {
                         options: options
                     )
                     state = .stdout
+                case let .software(options):
+                    renderer = SoftwareRenderer(
+                        platform: platform,
+                        host: host,
+                        options: options
+                    )
+                    state = .software
                 #endif
                 /* OpenSwiftUI Addition End */
                 }
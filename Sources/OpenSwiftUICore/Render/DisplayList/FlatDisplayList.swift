@@ -0,0 +1,554 @@
+//
+//  FlatDisplayList.swift
+//  OpenSwiftUICore
+//
+//  Status: Complete
+
+/* OpenSwiftUI Addition Begin */
+
+package import Foundation
+import Dispatch
+
+// MARK: - FlatDisplayList
+
+/// A display list whose items are laid out contiguously in a single arena.
+///
+/// `DisplayList` is a tree: every effect owns a nested `DisplayList`, and
+/// every content and effect payload is an indirect enum case, so a frame is
+/// made of many small heap objects. `FlatDisplayList` stores the same items
+/// as nodes in one array. The items of every list are adjacent, and a node
+/// refers to its children with a span of indices. Content and effect payloads
+/// are kept in their own arrays and referenced by index.
+///
+/// Walking, canonicalizing and enumerating the identities of a flat list
+/// don't allocate. Calling `assign(_:)` with a new frame reuses the storage
+/// of the previous one, so a renderer that keeps a flat list around only
+/// allocates when a frame is larger than every frame before it.
+package struct FlatDisplayList {
+    // MARK: - FlatDisplayList.Span
+
+    /// A contiguous range of indices into one of the arrays of a flat list.
+    package struct Span: RandomAccessCollection, Equatable {
+        private var start: Int32
+
+        private var end: Int32
+
+        package init(_ range: Range<Int>) {
+            start = Int32(range.lowerBound)
+            end = Int32(range.upperBound)
+        }
+
+        package static var empty: Span { Span(0 ..< 0) }
+
+        package var startIndex: Int { Int(start) }
+
+        package var endIndex: Int { Int(end) }
+
+        package subscript(position: Int) -> Int { position }
+    }
+
+    // MARK: - FlatDisplayList.Node
+
+    /// A single display list item.
+    package struct Node {
+        package enum Value {
+            case empty
+
+            /// Content at the given index of `contents`. The items of
+            /// flattened content are the children of the node.
+            case content(Int32)
+
+            /// An effect at the given index of `effects`, applied to the
+            /// children of the node. The items of a mask are in `mask`.
+            case effect(Int32, mask: Span)
+
+            /// State variants at the given span of `states`.
+            case states(Span)
+        }
+
+        package var frame: CGRect
+
+        package var version: DisplayList.Version
+
+        package var identity: DisplayList.Identity
+
+        package var value: Value
+
+        package var children: Span
+
+        /// The features of the item the node was made from.
+        package var features: DisplayList.Features
+    }
+
+    /// The nodes of every list, each list stored contiguously.
+    package private(set) var nodes: ContiguousArray<Node> = []
+
+    /// The content payloads of the nodes.
+    ///
+    /// The list of flattened content is replaced by an empty list; its items
+    /// are the children of the node.
+    package private(set) var contents: ContiguousArray<DisplayList.Content> = []
+
+    /// The effect payloads of the nodes.
+    ///
+    /// The list of a mask is replaced by an empty list; its items are the
+    /// `mask` span of the node.
+    package private(set) var effects: ContiguousArray<DisplayList.Effect> = []
+
+    /// The state variants of the nodes.
+    package private(set) var states: ContiguousArray<(hash: StrongHash, children: Span)> = []
+
+    /// The nodes of the top-level list.
+    package private(set) var roots: Span = .empty
+
+    package init() {}
+
+    package init(_ list: DisplayList) {
+        assign(list)
+    }
+
+    /// Replaces the contents of the flat list with `list`, keeping the
+    /// storage of the previous contents.
+    package mutating func assign(_ list: DisplayList) {
+        nodes.removeAll(keepingCapacity: true)
+        contents.removeAll(keepingCapacity: true)
+        effects.removeAll(keepingCapacity: true)
+        states.removeAll(keepingCapacity: true)
+        roots = append(list)
+    }
+
+    private mutating func append(_ list: DisplayList) -> Span {
+        let start = nodes.count
+        let items = list.items
+        guard !items.isEmpty else {
+            return .empty
+        }
+        for item in items {
+            nodes.append(Node(
+                frame: item.frame,
+                version: item.version,
+                identity: item.identity,
+                value: .empty,
+                children: .empty,
+                features: item.features
+            ))
+        }
+        for (offset, item) in items.enumerated() {
+            let index = start + offset
+            switch item.value {
+            case .empty:
+                break
+            case var .content(content):
+                if case let .flattened(list, origin, options) = content.value {
+                    content.value = .flattened(DisplayList(), origin, options)
+                    nodes[index].children = append(list)
+                }
+                nodes[index].value = .content(Int32(contents.count))
+                contents.append(content)
+            case .effect(var effect, let list):
+                var mask = Span.empty
+                if case let .mask(maskList, options) = effect {
+                    effect = .mask(DisplayList(), options)
+                    mask = append(maskList)
+                }
+                nodes[index].value = .effect(Int32(effects.count), mask: mask)
+                effects.append(effect)
+                nodes[index].children = append(list)
+            case let .states(variants):
+                let stateStart = states.count
+                for (hash, _) in variants {
+                    states.append((hash, .empty))
+                }
+                for (offset, (_, list)) in variants.enumerated() {
+                    states[stateStart + offset].children = append(list)
+                }
+                nodes[index].value = .states(Span(stateStart ..< states.count))
+            }
+        }
+        return Span(start ..< start + items.count)
+    }
+
+    /// Returns the display list of the nodes in `span`.
+    package func list(_ span: Span) -> DisplayList {
+        DisplayList(span.map(item(at:)))
+    }
+
+    /// Returns the display list item of the node at `index`.
+    package func item(at index: Int) -> DisplayList.Item {
+        let node = nodes[index]
+        let value: DisplayList.Item.Value
+        switch node.value {
+        case .empty:
+            value = .empty
+        case let .content(contentIndex):
+            var content = contents[Int(contentIndex)]
+            if case let .flattened(_, origin, options) = content.value {
+                content.value = .flattened(list(node.children), origin, options)
+            }
+            value = .content(content)
+        case let .effect(effectIndex, mask):
+            var effect = effects[Int(effectIndex)]
+            if case let .mask(_, options) = effect {
+                effect = .mask(list(mask), options)
+            }
+            value = .effect(effect, list(node.children))
+        case let .states(span):
+            value = .states(span.map { (states[$0].hash, list(states[$0].children)) })
+        }
+        return DisplayList.Item(value, frame: node.frame, identity: node.identity, version: node.version)
+    }
+
+    /// The features of the nodes in `span`.
+    package func features(of span: Span) -> DisplayList.Features {
+        var features: DisplayList.Features = []
+        for index in span {
+            features.formUnion(nodes[index].features)
+        }
+        return features
+    }
+
+    // MARK: - Traversal
+
+    /// Calls `body` with the identity of every node that has one, in the
+    /// same order as `DisplayList.forEachIdentity(_:)`.
+    @discardableResult
+    package func forEachIdentity(_ body: (DisplayList.Identity, inout Bool) -> Void) -> Bool {
+        forEachIdentity(in: roots, body)
+    }
+
+    private func forEachIdentity(in span: Span, _ body: (DisplayList.Identity, inout Bool) -> Void) -> Bool {
+        for index in span {
+            let node = nodes[index]
+            if node.identity != .none {
+                var stop = false
+                body(node.identity, &stop)
+                guard !stop else {
+                    return false
+                }
+            }
+            switch node.value {
+            case .empty:
+                break
+            case .content:
+                guard forEachIdentity(in: node.children, body) else {
+                    return false
+                }
+            case let .effect(_, mask):
+                guard forEachIdentity(in: mask, body),
+                      forEachIdentity(in: node.children, body) else {
+                    return false
+                }
+            case let .states(span):
+                for state in span {
+                    guard forEachIdentity(in: states[state].children, body) else {
+                        return false
+                    }
+                }
+            }
+        }
+        return true
+    }
+
+    // MARK: - Canonicalization
+
+    /// The number of nodes above which `canonicalize(options:)` splits the
+    /// list between threads.
+    package static var parallelThreshold: Int { 8192 }
+
+    /// Canonicalizes every node, children before their parents.
+    ///
+    /// This performs the rewrites of `DisplayList.Item.canonicalize(options:)`
+    /// that only remove or collapse nodes: empty content and effects become
+    /// empty nodes, and identity effects over a single item are replaced by
+    /// that item. Rewrites that create new content, such as turning a clip of
+    /// a color into a shape, are left to `DisplayList`.
+    ///
+    /// Lists of more than `parallelThreshold` nodes are split into
+    /// independent subtrees that are canonicalized concurrently.
+    package mutating func canonicalize(
+        options: DisplayList.Options = .init(),
+        parallel: Bool = true
+    ) {
+        guard !options.contains(.disableCanonicalization) else {
+            return
+        }
+        let isParallel = parallel && nodes.count > Self.parallelThreshold
+        let roots = roots
+        let states = states
+        contents.withUnsafeBufferPointer { contents in
+            nodes.withUnsafeMutableBufferPointer { nodes in
+                effects.withUnsafeMutableBufferPointer { effects in
+                    let canonicalizer = Canonicalizer(nodes: nodes, contents: contents, effects: effects)
+                    if isParallel {
+                        canonicalizer.canonicalizeConcurrently(roots: roots, states: states)
+                    } else {
+                        // Children always come after their parents in the arena.
+                        for index in nodes.indices.reversed() {
+                            canonicalizer.canonicalizeNode(at: index)
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // MARK: - Identity index
+
+    /// Returns the index of the node of every identity reachable from the
+    /// top-level list.
+    ///
+    /// Lists of more than `parallelThreshold` nodes are indexed
+    /// concurrently.
+    package func identityIndex(parallel: Bool = true) -> IdentityIndex {
+        let roots = roots
+        let chunkCount = parallel && nodes.count > Self.parallelThreshold
+            ? min(roots.count, ProcessInfo.processInfo.activeProcessorCount * 4)
+            : 1
+        return nodes.withUnsafeBufferPointer { nodes in
+            states.withUnsafeBufferPointer { states in
+                let collector = IdentityCollector(nodes: nodes, states: states)
+                guard chunkCount > 1 else {
+                    var entries: [(DisplayList.Identity, Int)] = []
+                    entries.reserveCapacity(nodes.count)
+                    collector.appendIdentities(in: roots, to: &entries)
+                    return IdentityIndex(entries)
+                }
+                let chunks = UnsafeMutableBufferPointer<[(DisplayList.Identity, Int)]>.allocate(capacity: chunkCount)
+                chunks.initialize(repeating: [])
+                defer {
+                    chunks.deinitialize()
+                    chunks.deallocate()
+                }
+                DispatchQueue.concurrentPerform(iterations: chunkCount) { chunk in
+                    let lower = roots.startIndex + roots.count * chunk / chunkCount
+                    let upper = roots.startIndex + roots.count * (chunk + 1) / chunkCount
+                    var entries: [(DisplayList.Identity, Int)] = []
+                    collector.appendIdentities(in: Span(lower ..< upper), to: &entries)
+                    chunks[chunk] = entries
+                }
+                return IdentityIndex(chunks.joined())
+            }
+        }
+    }
+
+    // MARK: - FlatDisplayList.IdentityIndex
+
+    /// A map from the identities of a flat list to the indices of their
+    /// nodes.
+    ///
+    /// When several nodes share an identity, the first one in traversal
+    /// order wins, matching a linear search with `forEachIdentity(_:)`.
+    package struct IdentityIndex {
+        private var indices: [DisplayList.Identity: Int]
+
+        init<S>(_ entries: S) where S: Sequence, S.Element == (DisplayList.Identity, Int) {
+            indices = Dictionary(entries, uniquingKeysWith: { first, _ in first })
+        }
+
+        package var count: Int { indices.count }
+
+        package subscript(identity: DisplayList.Identity) -> Int? {
+            indices[identity]
+        }
+    }
+}
+
+// MARK: - IdentityCollector
+
+/// Collects the identities of the nodes reachable from a span of a flat list.
+private struct IdentityCollector: @unchecked Sendable {
+    let nodes: UnsafeBufferPointer<FlatDisplayList.Node>
+    let states: UnsafeBufferPointer<(hash: StrongHash, children: FlatDisplayList.Span)>
+
+    func appendIdentities(in span: FlatDisplayList.Span, to entries: inout [(DisplayList.Identity, Int)]) {
+        for index in span {
+            let node = nodes[index]
+            if node.identity != .none {
+                entries.append((node.identity, index))
+            }
+            switch node.value {
+            case .empty:
+                break
+            case .content:
+                appendIdentities(in: node.children, to: &entries)
+            case let .effect(_, mask):
+                appendIdentities(in: mask, to: &entries)
+                appendIdentities(in: node.children, to: &entries)
+            case let .states(span):
+                for state in span {
+                    appendIdentities(in: states[state].children, to: &entries)
+                }
+            }
+        }
+    }
+}
+
+// MARK: - Canonicalizer
+
+/// Canonicalizes the nodes of a flat list in place.
+///
+/// A node's canonicalization reads its children and writes only the node and
+/// its own effect, so disjoint subtrees can be canonicalized concurrently.
+private struct Canonicalizer: @unchecked Sendable {
+    let nodes: UnsafeMutableBufferPointer<FlatDisplayList.Node>
+    let contents: UnsafeBufferPointer<DisplayList.Content>
+    let effects: UnsafeMutableBufferPointer<DisplayList.Effect>
+
+    func canonicalizeConcurrently(
+        roots: FlatDisplayList.Span,
+        states: ContiguousArray<(hash: StrongHash, children: FlatDisplayList.Span)>
+    ) {
+        // Expand the top levels of the tree breadth-first until there are
+        // enough independent subtrees to keep every thread busy. The parents
+        // passed over are canonicalized afterwards, deepest level first.
+        let targetCount = ProcessInfo.processInfo.activeProcessorCount * 16
+        var frontier = Array(roots)
+        var parentLevels: [[Int]] = []
+        while frontier.count < targetCount {
+            var next: [Int] = []
+            for index in frontier {
+                forEachChildSpan(of: index, states: states) { next.append(contentsOf: $0) }
+            }
+            guard !next.isEmpty else {
+                break
+            }
+            parentLevels.append(frontier)
+            frontier = next
+        }
+        // Hand out small chunks so that threads that finish early pick up
+        // the remaining subtrees.
+        let chunkCount = min(frontier.count, targetCount)
+        let subtrees = frontier
+        DispatchQueue.concurrentPerform(iterations: chunkCount) { chunk in
+            let lower = subtrees.count * chunk / chunkCount
+            let upper = subtrees.count * (chunk + 1) / chunkCount
+            for index in subtrees[lower ..< upper] {
+                canonicalizeSubtree(at: index, states: states)
+            }
+        }
+        for level in parentLevels.reversed() {
+            for index in level {
+                canonicalizeNode(at: index)
+            }
+        }
+    }
+
+    private func canonicalizeSubtree(
+        at index: Int,
+        states: ContiguousArray<(hash: StrongHash, children: FlatDisplayList.Span)>
+    ) {
+        forEachChildSpan(of: index, states: states) { span in
+            for child in span {
+                canonicalizeSubtree(at: child, states: states)
+            }
+        }
+        canonicalizeNode(at: index)
+    }
+
+    private func forEachChildSpan(
+        of index: Int,
+        states: ContiguousArray<(hash: StrongHash, children: FlatDisplayList.Span)>,
+        _ body: (FlatDisplayList.Span) -> Void
+    ) {
+        let node = nodes[index]
+        switch node.value {
+        case .empty:
+            break
+        case .content:
+            body(node.children)
+        case let .effect(_, mask):
+            body(mask)
+            body(node.children)
+        case let .states(span):
+            for state in span {
+                body(states[state].children)
+            }
+        }
+    }
+
+    func canonicalizeNode(at index: Int) {
+        let node = nodes[index]
+        switch node.value {
+        case .empty, .states:
+            return
+        case let .content(contentIndex):
+            if node.frame.isEmpty && !node.features.contains(.required) {
+                nodes[index].value = .empty
+                return
+            }
+            let isEmpty = switch contents[Int(contentIndex)].value {
+            case let .color(color): color == .clear
+            case let .shape(path, _, _): path.isEmpty
+            case let .shadow(path, shadow): path.isEmpty || shadow.color.opacity == 0
+            case let .text(text, _): text.text.isEmpty
+            case .flattened: node.children.isEmpty
+            default: false
+            }
+            if isEmpty {
+                nodes[index].value = .empty
+            }
+        case let .effect(effectIndex, mask):
+            let effect = effects[Int(effectIndex)]
+            // An effect over an empty list only carries its own features.
+            guard !node.children.isEmpty || node.features.contains(.required) else {
+                nodes[index].value = .empty
+                return
+            }
+            let isIdentity = switch effect {
+            case let .opacity(opacity): opacity >= 1
+            case let .transform(.affine(transform)): transform == .identity
+            case let .filter(filter): filter.isIdentity
+            case .identity: true
+            default: false
+            }
+            if isIdentity {
+                effects[Int(effectIndex)] = .identity
+                collapseIdentityEffect(at: index)
+            }
+            var childFeatures: DisplayList.Features = []
+            for child in node.children {
+                childFeatures.formUnion(nodes[child].features)
+            }
+            guard !childFeatures.contains(.required) else {
+                return
+            }
+            let isEmpty = switch effect {
+            case let .opacity(opacity): opacity <= 0
+            case let .clip(path, _, _): path.isEmpty
+            case .mask: mask.isEmpty
+            default: false
+            }
+            if isEmpty {
+                nodes[index].value = .empty
+            }
+        }
+    }
+
+    private func collapseIdentityEffect(at index: Int) {
+        let children = nodes[index].children
+        guard children.count == 1 else {
+            return
+        }
+        let child = nodes[children.startIndex]
+        nodes[index].frame = child.frame.offset(by: CGSize(nodes[index].frame.origin))
+        nodes[index].version.combine(with: child.version)
+        nodes[index].value = child.value
+        nodes[index].children = child.children
+        nodes[index].features = child.features
+        if child.identity != .none {
+            nodes[index].identity = child.identity
+        }
+    }
+}
+
+@available(*, unavailable)
+extension FlatDisplayList: Sendable {}
+
+extension DisplayList {
+    /// Creates a display list from the top-level nodes of a flat list.
+    package init(_ flatList: FlatDisplayList) {
+        self = flatList.list(flatList.roots)
+    }
+}
+
+/* OpenSwiftUI Addition End */
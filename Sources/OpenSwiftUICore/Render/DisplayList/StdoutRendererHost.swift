@@ -12,9 +12,20 @@ final package class StdoutRendererHost<Content>: ViewRendererHost, ViewGraphRend
 
     package let viewGraph: ViewGraph
     package let renderer: DisplayList.ViewRenderer
-    package let rootView: Content
+    package var rootView: Content {
+        didSet {
+            invalidateProperties(.rootView)
+        }
+    }
+
     package let environment: EnvironmentValues
-    package let options: _RendererConfiguration.StdoutOptions
+
+    package var options: _RendererConfiguration.StdoutOptions {
+        didSet {
+            renderer.configuration = .stdout(options)
+            invalidateProperties([.size, .containerSize])
+        }
+    }
 
     package var currentTimestamp: Time = .zero
     package var propertiesNeedingUpdate: ViewRendererHostProperties = .all
@@ -103,5 +114,13 @@ final package class StdoutRendererHost<Content>: ViewRendererHost, ViewGraphRend
     }
 }
 
+// MARK: - StdoutRendererHost + _BenchmarkHost
+
+extension StdoutRendererHost: _BenchmarkHost {
+    package func _renderForTest(interval: Double) {
+        render(interval: interval, targetTimestamp: nil)
+    }
+}
+
 private final class StdoutPlatformViewDefinition: PlatformViewDefinition, @unchecked Sendable {}
 #endif
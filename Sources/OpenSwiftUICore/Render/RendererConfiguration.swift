@@ -28,6 +28,11 @@ public struct _RendererConfiguration {
         /// to standard output.
         @_spi(StdoutRenderer)
         indirect case stdout(_ options: _RendererConfiguration.StdoutOptions = .init())
+
+        /// A renderer that rasterizes the display list on the CPU into an
+        /// in-memory bitmap.
+        @_spi(SoftwareRenderer)
+        indirect case software(_ options: _RendererConfiguration.SoftwareOptions = .init())
         #endif
         /* OpenSwiftUI Addition End */
     }
@@ -59,6 +64,12 @@ public struct _RendererConfiguration {
     public static func stdout(_ options: _RendererConfiguration.StdoutOptions = .init()) -> _RendererConfiguration {
         _RendererConfiguration(renderer: .stdout(options))
     }
+
+    /// Returns a configuration to rasterize the display list on the CPU.
+    @_spi(SoftwareRenderer)
+    public static func software(_ options: _RendererConfiguration.SoftwareOptions = .init()) -> _RendererConfiguration {
+        _RendererConfiguration(renderer: .software(options))
+    }
     #endif
 
     /* OpenSwiftUI Addition End */
@@ -77,6 +88,11 @@ public struct _RendererConfiguration {
 
             /// Renders the display list into a terminal-cell canvas.
             case terminal
+
+            /// Renders the display list into a terminal-cell canvas, and on
+            /// later frames rewrites only the cells that changed since the
+            /// previous frame using cursor-addressed ANSI sequences.
+            case incrementalTerminal
         }
 
         /// The terminal color capability used by terminal view mode.
@@ -132,6 +148,88 @@ public struct _RendererConfiguration {
         public init() {}
     }
 
+    // MARK: - _RendererConfiguration.SoftwareOptions
+
+    /// Options for the `software` renderer.
+    @_spi(SoftwareRenderer)
+    public struct SoftwareOptions {
+        /// The pixel layout of bitmaps produced by the software renderer.
+        public enum PixelFormat: Equatable {
+            /// Four 8-bit unsigned components per pixel with premultiplied
+            /// alpha, in the non-linear sRGB color space.
+            case rgba8
+
+            /// Four 16-bit floating-point components per pixel with
+            /// premultiplied alpha, in the extended linear sRGB color space.
+            case rgba16Float
+
+            /// The number of bytes used by a single pixel.
+            public var bytesPerPixel: Int {
+                switch self {
+                case .rgba8: 4
+                case .rgba16Float: 8
+                }
+            }
+
+            package var isLinear: Bool {
+                self == .rgba16Float
+            }
+        }
+
+        /// A bitmap produced by the software renderer.
+        public struct Bitmap {
+            /// The width of the bitmap in pixels.
+            public var width: Int
+
+            /// The height of the bitmap in pixels.
+            public var height: Int
+
+            /// The pixel layout of `data`.
+            public var pixelFormat: PixelFormat
+
+            /// The pixel data in row-major order, with no padding between
+            /// rows. Multi-byte components are little-endian.
+            public var data: [UInt8]
+
+            /// The number of bytes in a single row of pixels.
+            public var bytesPerRow: Int {
+                width * pixelFormat.bytesPerPixel
+            }
+
+            public init(width: Int, height: Int, pixelFormat: PixelFormat, data: [UInt8]) {
+                self.width = width
+                self.height = height
+                self.pixelFormat = pixelFormat
+                self.data = data
+            }
+        }
+
+        /// The size of the rendered surface, in points.
+        ///
+        /// Software rendering draws into memory rather than into a window, so
+        /// there is no host surface to size it from: it defaults to 640 by
+        /// 480 points, the default surface of the stdout renderer.
+        public var surface: CGSize = defaultSurfaceSize
+
+        /// The number of pixels per point.
+        public var scale: CGFloat = 1.0
+
+        /// The pixel layout of the rendered bitmap.
+        public var pixelFormat: PixelFormat = .rgba8
+
+        /// The edge length, in pixels, of the square tiles which are
+        /// rasterized concurrently.
+        public var tileSize: Int = 64
+
+        /// Called with the rendered bitmap every time the display list
+        /// changes.
+        public var frameHandler: ((Bitmap) -> Void)?
+
+        private static let defaultSurfaceSize = CGSize(width: 640.0, height: 480.0)
+
+        public init() {}
+    }
+
     /* OpenSwiftUI Addition End */
 
     // MARK: - _RendererConfiguration.RasterizationOptions
@@ -188,6 +286,10 @@ extension _RendererConfiguration.RasterizationOptions: Sendable {}
 @_spi(StdoutRenderer)
 @available(*, unavailable)
 extension _RendererConfiguration.StdoutOptions: Sendable {}
+
+@_spi(SoftwareRenderer)
+@available(*, unavailable)
+extension _RendererConfiguration.SoftwareOptions: Sendable {}
 /* OpenSwiftUI Addition End */
 
 // MARK: - RasterizationOptions + _RendererConfiguration.RasterizationOptions
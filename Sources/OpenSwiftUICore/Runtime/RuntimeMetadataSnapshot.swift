@@ -0,0 +1,372 @@
+//
+//  RuntimeMetadataSnapshot.swift
+//  OpenSwiftUICore
+//
+//  Status: Complete
+
+/* OpenSwiftUI Addition Begin */
+
+#if canImport(Darwin)
+import Darwin
+#if canImport(MachO)
+import MachO
+#endif
+#elseif canImport(Glibc)
+import Glibc
+#elseif os(WASI)
+import WASILibc
+#endif
+import Foundation
+import OpenAttributeGraphShims
+import Synchronization
+
+// MARK: - RuntimeMetadataSnapshot
+
+/// A record of the runtime metadata queries of a launch, replayed in the
+/// background at the next launch of the same binary.
+///
+/// Looking up protocol conformances and walking the fields of view types
+/// dominates the reflection work of a cold start. While recording, the
+/// types queried through `ProtocolDescriptor.conformance(of:)` and
+/// `DynamicPropertyCache.fields(of:)` are collected by mangled name. At the
+/// next launch the snapshot is validated against the identifier of the
+/// executable and the same queries are performed on a background queue, so
+/// that the runtime caches are warm by the time the first frame needs them.
+///
+/// The snapshot only decides which queries are performed early: results
+/// are always computed by the runtime, so a stale snapshot costs time but
+/// never changes behavior. Setting `OPENSWIFTUI_RUNTIME_METADATA_SNAPSHOT`
+/// to `0` disables it.
+package struct RuntimeMetadataSnapshot: Equatable {
+    /// The version of the snapshot format.
+    package static let currentVersion: UInt = 1
+
+    /// The identifier of the executable the snapshot was recorded by.
+    package var binaryIdentifier: String
+
+    /// The conformance queries, as the mangled names of the protocol
+    /// descriptor and of the queried type.
+    package var conformances: [Conformance]
+
+    /// The mangled names of the types whose fields were walked.
+    package var fieldLayoutTypes: [String]
+
+    package init(binaryIdentifier: String, conformances: [Conformance] = [], fieldLayoutTypes: [String] = []) {
+        self.binaryIdentifier = binaryIdentifier
+        self.conformances = conformances
+        self.fieldLayoutTypes = fieldLayoutTypes
+    }
+
+    package struct Conformance: Hashable {
+        package var protocolDescriptor: String
+
+        package var type: String
+
+        package init(protocolDescriptor: String, type: String) {
+            self.protocolDescriptor = protocolDescriptor
+            self.type = type
+        }
+    }
+
+    /// Performs the recorded queries, warming the conformance cache and the
+    /// dynamic property field cache.
+    ///
+    /// Names that no longer resolve to a type are skipped. The field
+    /// metadata of the types is walked without the update lock, which then
+    /// is taken once to fill the field cache from the warmed metadata.
+    package func prewarm() {
+        for conformance in conformances {
+            guard let descriptor = _typeByName(conformance.protocolDescriptor) as? any ProtocolDescriptor.Type,
+                  let type = _typeByName(conformance.type) else {
+                continue
+            }
+            _ = Self.conformance(of: type, to: descriptor)
+        }
+        let types = fieldLayoutTypes.compactMap { _typeByName($0) }
+        guard !types.isEmpty else {
+            return
+        }
+        for type in types {
+            Self.warmFieldMetadata(of: type)
+        }
+        Update.locked {
+            for type in types {
+                _ = DynamicPropertyCache.fields(of: type)
+            }
+        }
+    }
+
+    private static func conformance<P>(of type: any Any.Type, to _: P.Type) -> TypeConformance<P>? where P: ProtocolDescriptor {
+        P.conformance(of: type)
+    }
+
+    /// Walks the fields of a type as `DynamicPropertyCache.fields(of:)`
+    /// does, resolving their metadata and `DynamicProperty` conformances
+    /// in the runtime caches.
+    private static func warmFieldMetadata(of type: any Any.Type) {
+        let metadata = Metadata(type)
+        switch metadata.kind {
+        case .enum, .optional:
+            _ = metadata.forEachField(options: [.continueAfterUnknownField, .enumerateEnumCases]) { _, _, fieldType in
+                let tupleType = TupleType(fieldType)
+                for index in tupleType.indices {
+                    _ = tupleType.type(at: index) is DynamicProperty.Type
+                }
+                return true
+            }
+        case .struct, .tuple:
+            _ = metadata.forEachField(options: [.continueAfterUnknownField]) { _, _, fieldType in
+                _ = fieldType is DynamicProperty.Type
+                return true
+            }
+        default:
+            break
+        }
+    }
+}
+
+// MARK: - RuntimeMetadataSnapshot + Recording
+
+extension RuntimeMetadataSnapshot {
+    private struct Recorder {
+        var conformances: [(descriptor: any ProtocolDescriptor.Type, type: any Any.Type)] = []
+
+        var conformanceKeys: Set<[ObjectIdentifier]> = []
+
+        var fieldLayoutTypes: [any Any.Type] = []
+
+        var fieldLayoutKeys: Set<ObjectIdentifier> = []
+
+        var loadedCount = 0
+    }
+
+    private static let recorder = AtomicBox(wrappedValue: Recorder())
+
+    /// Checked before the recorder is locked, so that queries made while
+    /// not recording, such as every negative conformance lookup, don't
+    /// contend on its lock.
+    private static let recording = Atomic<Bool>(false)
+
+    /// Whether queries are being recorded.
+    package static var isRecording: Bool {
+        get { recording.load(ordering: .relaxed) }
+        set { recording.store(newValue, ordering: .relaxed) }
+    }
+
+    static func recordConformance<P>(of type: any Any.Type, to descriptor: P.Type) where P: ProtocolDescriptor {
+        guard isRecording else {
+            return
+        }
+        recorder.access { recorder in
+            guard recorder.conformanceKeys.insert([ObjectIdentifier(P.self), ObjectIdentifier(type)]).inserted else {
+                return
+            }
+            recorder.conformances.append((descriptor, type))
+        }
+    }
+
+    static func recordFieldLayout(of type: any Any.Type) {
+        guard isRecording else {
+            return
+        }
+        recorder.access { recorder in
+            guard recorder.fieldLayoutKeys.insert(ObjectIdentifier(type)).inserted else {
+                return
+            }
+            recorder.fieldLayoutTypes.append(type)
+        }
+    }
+
+    /// Returns a snapshot of the queries recorded so far.
+    ///
+    /// Types without a mangled name, such as some local types, are left
+    /// out.
+    package static func recorded(binaryIdentifier: String) -> RuntimeMetadataSnapshot {
+        let (conformances, fieldLayoutTypes) = recorder.access { ($0.conformances, $0.fieldLayoutTypes) }
+        return RuntimeMetadataSnapshot(
+            binaryIdentifier: binaryIdentifier,
+            conformances: conformances.compactMap { descriptor, type in
+                guard let descriptorName = _mangledTypeName(descriptor),
+                      let typeName = _mangledTypeName(type) else {
+                    return nil
+                }
+                return Conformance(protocolDescriptor: descriptorName, type: typeName)
+            },
+            fieldLayoutTypes: fieldLayoutTypes.compactMap { _mangledTypeName($0) }
+        )
+    }
+
+    /// Discards the recorded queries.
+    package static func resetRecording() {
+        recorder.access { $0 = Recorder() }
+    }
+}
+
+// MARK: - RuntimeMetadataSnapshot + Launch
+
+extension RuntimeMetadataSnapshot {
+    /// The delay after launch before the recorded queries are saved.
+    private static let saveDelay: DispatchTimeInterval = .seconds(10)
+
+    /// The location of the snapshot of the current process.
+    ///
+    /// The caches directory can be shared by several executables, as it is
+    /// outside of Darwin, so the file is named after a hash of the binary
+    /// identifier.
+    package static var defaultURL: URL? {
+        guard let binaryIdentifier = currentBinaryIdentifier else {
+            return nil
+        }
+        return defaultURL(binaryIdentifier: binaryIdentifier)
+    }
+
+    package static func defaultURL(binaryIdentifier: String) -> URL? {
+        // FNV-1a, since `Hasher` is seeded per process.
+        var hash: UInt64 = 0xCBF2_9CE4_8422_2325
+        for byte in binaryIdentifier.utf8 {
+            hash = (hash ^ UInt64(byte)) &* 0x0000_0100_0000_01B3
+        }
+        let name = String(hash, radix: 16)
+        return FileManager.default.urls(for: .cachesDirectory, in: .userDomainMask).first?
+            .appendingPathComponent("OpenSwiftUI", isDirectory: true)
+            .appendingPathComponent("RuntimeMetadata-\(name).snapshot")
+    }
+
+    /// Prewarms the runtime metadata caches from the snapshot of the
+    /// previous launch, if it was recorded by the same executable, and
+    /// starts recording the queries of this launch.
+    ///
+    /// Recording stops a few seconds after launch, when the queries are
+    /// saved if they cover more than the loaded snapshot.
+    package static func beginLaunch() {
+        guard EnvironmentHelper.int32(for: "OPENSWIFTUI_RUNTIME_METADATA_SNAPSHOT") != 0,
+              let binaryIdentifier = currentBinaryIdentifier,
+              let url = defaultURL(binaryIdentifier: binaryIdentifier) else {
+            return
+        }
+        isRecording = true
+        let queue = DispatchQueue.global(qos: .userInitiated)
+        queue.async {
+            if let snapshot = try? load(from: url, binaryIdentifier: binaryIdentifier) {
+                recorder.access {
+                    $0.loadedCount = snapshot.conformances.count + snapshot.fieldLayoutTypes.count
+                }
+                snapshot.prewarm()
+            }
+        }
+        queue.asyncAfter(deadline: .now() + saveDelay) {
+            isRecording = false
+            let snapshot = recorded(binaryIdentifier: binaryIdentifier)
+            let loadedCount = recorder.access { $0.loadedCount }
+            guard snapshot.conformances.count + snapshot.fieldLayoutTypes.count > loadedCount else {
+                return
+            }
+            try? snapshot.save(to: url)
+        }
+    }
+
+    /// Loads a snapshot, returning `nil` if it was recorded by another
+    /// executable or with another format version.
+    package static func load(from url: URL, binaryIdentifier: String) throws -> RuntimeMetadataSnapshot? {
+        var decoder = try ProtobufDecoder(mappingContentsOf: url)
+        let (version, snapshot) = try decodeVersioned(from: &decoder)
+        guard version == currentVersion, snapshot.binaryIdentifier == binaryIdentifier else {
+            return nil
+        }
+        return snapshot
+    }
+
+    /// Writes the snapshot atomically, creating its directory if needed.
+    package func save(to url: URL) throws {
+        try FileManager.default.createDirectory(
+            at: url.deletingLastPathComponent(),
+            withIntermediateDirectories: true
+        )
+        try ProtobufEncoder.encoding(self).write(to: url, options: .atomic)
+    }
+
+    /// An identifier of the main executable that changes whenever it is
+    /// rebuilt: its `LC_UUID` on Darwin, and the identity and modification
+    /// date of its file elsewhere.
+    package static let currentBinaryIdentifier: String? = {
+        #if canImport(MachO)
+        guard let header = _dyld_get_image_header(0),
+              header.pointee.magic == MH_MAGIC_64 else {
+            return nil
+        }
+        var command = UnsafeRawPointer(header).advanced(by: MemoryLayout<mach_header_64>.size)
+        for _ in 0 ..< header.pointee.ncmds {
+            let loadCommand = command.loadUnaligned(as: load_command.self)
+            if loadCommand.cmd == LC_UUID {
+                return UUID(uuid: command.loadUnaligned(as: uuid_command.self).uuid).uuidString
+            }
+            command = command.advanced(by: Int(loadCommand.cmdsize))
+        }
+        return nil
+        #elseif os(WASI)
+        return nil
+        #else
+        var info = stat()
+        guard stat("/proc/self/exe", &info) == 0 else {
+            return nil
+        }
+        return "\(info.st_dev)-\(info.st_ino)-\(info.st_size)-\(info.st_mtim.tv_sec).\(info.st_mtim.tv_nsec)"
+        #endif
+    }()
+}
+
+// MARK: - RuntimeMetadataSnapshot + ProtobufMessage
+
+extension RuntimeMetadataSnapshot: ProtobufMessage {
+    package func encode(to encoder: inout ProtobufEncoder) throws {
+        encoder.uintField(1, Self.currentVersion)
+        try encoder.stringField(2, binaryIdentifier)
+        for conformance in conformances {
+            try encoder.messageField(3, conformance)
+        }
+        for name in fieldLayoutTypes {
+            try encoder.stringField(4, name, defaultValue: nil)
+        }
+    }
+
+    package init(from decoder: inout ProtobufDecoder) throws {
+        (_, self) = try Self.decodeVersioned(from: &decoder)
+    }
+
+    private static func decodeVersioned(from decoder: inout ProtobufDecoder) throws -> (UInt, RuntimeMetadataSnapshot) {
+        var version: UInt = 0
+        var snapshot = RuntimeMetadataSnapshot(binaryIdentifier: "")
+        while let field = try decoder.nextField() {
+            switch field.tag {
+            case 1: version = try decoder.uintField(field)
+            case 2: snapshot.binaryIdentifier = try decoder.stringField(field)
+            case 3: snapshot.conformances.append(try decoder.messageField(field))
+            case 4: snapshot.fieldLayoutTypes.append(try decoder.stringField(field))
+            default: try decoder.skipField(field)
+            }
+        }
+        return (version, snapshot)
+    }
+}
+
+extension RuntimeMetadataSnapshot.Conformance: ProtobufMessage {
+    package func encode(to encoder: inout ProtobufEncoder) throws {
+        try encoder.stringField(1, protocolDescriptor)
+        try encoder.stringField(2, type)
+    }
+
+    package init(from decoder: inout ProtobufDecoder) throws {
+        var protocolDescriptor = ""
+        var type = ""
+        while let field = try decoder.nextField() {
+            switch field.tag {
+            case 1: protocolDescriptor = try decoder.stringField(field)
+            case 2: type = try decoder.stringField(field)
+            default: try decoder.skipField(field)
+            }
+        }
+        self.init(protocolDescriptor: protocolDescriptor, type: type)
+    }
+}
+
+/* OpenSwiftUI Addition End */
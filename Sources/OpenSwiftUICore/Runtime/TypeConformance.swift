@@ -16,13 +16,49 @@ package protocol ProtocolDescriptor {
 
 extension ProtocolDescriptor {
     package static func conformance(of type: any Any.Type) -> TypeConformance<Self>? {
-        guard let conformance = swiftConformsToProtocol(type, descriptor) else {
+        // OpenSwiftUI Addition: memoize the result and record it for the runtime metadata snapshot
+        guard let conformance = ConformanceCache.conformance(of: type, to: Self.self) else {
             return nil
         }
         return TypeConformance(storage: (type, conformance))
     }
 }
 
+/* OpenSwiftUI Addition Begin */
+
+// MARK: - ConformanceCache
+
+/// The conformances found by the conformance queries of every protocol
+/// descriptor.
+///
+/// Negative results aren't cached: a conformance can appear later, when an
+/// image declaring it is loaded, and the runtime keeps its own cache of
+/// them anyway.
+private enum ConformanceCache {
+    struct Key: Hashable {
+        var type: ObjectIdentifier
+
+        var descriptor: UnsafeRawPointer
+    }
+
+    static let results = AtomicBox(wrappedValue: [Key: UnsafeRawPointer]())
+
+    static func conformance<P>(of type: any Any.Type, to _: P.Type) -> UnsafeRawPointer? where P: ProtocolDescriptor {
+        let key = Key(type: ObjectIdentifier(type), descriptor: P.descriptor)
+        if let result = results.wrappedValue[key] {
+            return result
+        }
+        let result = swiftConformsToProtocol(type, key.descriptor)
+        if let result {
+            results.access { $0[key] = result }
+        }
+        RuntimeMetadataSnapshot.recordConformance(of: type, to: P.self)
+        return result
+    }
+}
+
+/* OpenSwiftUI Addition End */
+
 // MARK: - TypeConformance
 
 package struct TypeConformance<P> where P: ProtocolDescriptor {
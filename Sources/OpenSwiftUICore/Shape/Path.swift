@@ -29,11 +29,53 @@ public struct Path: Equatable, LosslessStringConvertible, @unchecked Sendable {
             #endif
             case rbPath
             case buffer
+            /* OpenSwiftUI Addition Begin */
+            case elements
+            /* OpenSwiftUI Addition End */
         }
 
         private var kind: Kind
         private var data: PathData
 
+        /* OpenSwiftUI Addition Begin */
+        fileprivate var elements: [Path.Element] = [] {
+            didSet {
+                #if canImport(CoreGraphics)
+                cachedCGPath = nil
+                #endif
+            }
+        }
+
+        #if canImport(CoreGraphics)
+        private var cachedCGPath: CGPath?
+        #endif
+
+        /// Creates a box that stores its elements directly, for paths built
+        /// or transformed without CoreGraphics or RenderBox.
+        package init(elements: [Path.Element]) {
+            kind = .elements
+            data = PathData()
+            self.elements = elements
+        }
+
+        #if OPENSWIFTUI_CF_CGTYPES
+        /// Creates a box by parsing a path string straight into its buffer.
+        package init?(parsing string: UnsafePointer<CChar>) {
+            kind = .buffer
+            data = PathData()
+            let parsed = withUnsafeMutablePointer(to: &data) { pointer in
+                let storage = unsafeBitCast(pointer, to: ORBPath.Storage.self)
+                storage.initialize(capacity: 96, source: nil)
+                return _PathStorageParseString(storage, string)
+            }
+            // The buffer is destroyed by deinit.
+            guard parsed else {
+                return nil
+            }
+        }
+        #endif
+        /* OpenSwiftUI Addition End */
+
         #if canImport(CoreGraphics) || !OPENSWIFTUI_CF_CGTYPES
         @inline(__always)
         init(_ path: CGPath) {
@@ -60,6 +102,8 @@ public struct Path: Equatable, LosslessStringConvertible, @unchecked Sendable {
                     let storage = unsafeBitCast(pointer, to: ORBPath.Storage.self)
                     storage.destroy()
                 }
+            case .elements:
+                break
             }
         }
 
@@ -72,7 +116,7 @@ public struct Path: Equatable, LosslessStringConvertible, @unchecked Sendable {
             #endif
             case .rbPath:
                 path = data.rbPath
-            case .buffer:
+            case .buffer, .elements:
                 return
             }
             withUnsafeMutablePointer(to: &data) { pointer in
@@ -160,11 +204,150 @@ public struct Path: Equatable, LosslessStringConvertible, @unchecked Sendable {
             case .buffer:
                 let storage = unsafeBitCast(self, to: ORBPath.Storage.self)
                 rbPath = ORBPath(storage: storage, callbacks: Self.bufferCallbacks)
+            case .elements:
+                #if canImport(CoreGraphics)
+                return elementsCGPath
+                #else
+                _openSwiftUIPlatformUnimplementedFailure()
+                #endif
             }
             return rbPath.cgPath
         }
         #endif
 
+        /* OpenSwiftUI Addition Begin */
+        #if canImport(CoreGraphics)
+        private var elementsCGPath: CGPath {
+            if let cachedCGPath {
+                return cachedCGPath
+            }
+            let path = CGMutablePath()
+            for element in elements {
+                switch element {
+                case let .move(to: point):
+                    path.move(to: point)
+                case let .line(to: point):
+                    path.addLine(to: point)
+                case let .quadCurve(to: end, control: control):
+                    path.addQuadCurve(to: end, control: control)
+                case let .curve(to: end, control1: control1, control2: control2):
+                    path.addCurve(to: end, control1: control1, control2: control2)
+                case .closeSubpath:
+                    path.closeSubpath()
+                }
+            }
+            cachedCGPath = path
+            return path
+        }
+        #endif
+
+        /// Calls `body` with each element of the stored path.
+        ///
+        /// Without CoreGraphics, RenderBox-backed paths are enumerated from
+        /// their path storage.
+        fileprivate func forEach(_ body: (Path.Element) -> Void) {
+            if kind == .elements {
+                for element in elements {
+                    body(element)
+                }
+                return
+            }
+            #if !canImport(CoreGraphics)
+            switch kind {
+            case .buffer:
+                withUnsafeMutablePointer(to: &data) { pointer in
+                    Self.apply(unsafeBitCast(pointer, to: ORBPath.Storage.self), body)
+                }
+                return
+            case .rbPath:
+                var buffer = PathData()
+                withUnsafeMutablePointer(to: &buffer) { pointer in
+                    let storage = unsafeBitCast(pointer, to: ORBPath.Storage.self)
+                    storage.initialize(capacity: 96, source: nil)
+                    storage.append(path: data.rbPath)
+                    Self.apply(storage, body)
+                    storage.destroy()
+                }
+                return
+            default:
+                break
+            }
+            #endif
+            #if canImport(CoreGraphics)
+            cgPath.applyWithBlock { element in
+                let points = element.pointee.points
+                switch element.pointee.type {
+                case .moveToPoint:
+                    body(.move(to: points[0]))
+                case .addLineToPoint:
+                    body(.line(to: points[0]))
+                case .addQuadCurveToPoint:
+                    body(.quadCurve(to: points[1], control: points[0]))
+                case .addCurveToPoint:
+                    body(.curve(to: points[2], control1: points[0], control2: points[1]))
+                case .closeSubpath:
+                    body(.closeSubpath)
+                @unknown default:
+                    break
+                }
+            }
+            #else
+            _openSwiftUIPlatformUnimplementedFailure()
+            #endif
+        }
+
+        #if !canImport(CoreGraphics)
+        private static func apply(_ storage: ORBPath.Storage, _ body: (Path.Element) -> Void) {
+            withoutActuallyEscaping(body) { body in
+                var body = body
+                _ = withUnsafeMutablePointer(to: &body) { info in
+                    storage.apply(info: info) { info, element, points, _ in
+                        let body = info!.assumingMemoryBound(to: ((Path.Element) -> Void).self).pointee
+                        // Points are stored as consecutive x and y coordinates.
+                        func point(_ index: Int) -> CGPoint {
+                            CGPoint(x: points[2 * index], y: points[2 * index + 1])
+                        }
+                        switch element.rawValue {
+                        case 0:
+                            body(.move(to: point(0)))
+                        case 1:
+                            body(.line(to: point(0)))
+                        case 2:
+                            body(.quadCurve(to: point(1), control: point(0)))
+                        case 3:
+                            body(.curve(to: point(2), control1: point(0), control2: point(1)))
+                        case 4:
+                            body(.closeSubpath)
+                        default:
+                            break
+                        }
+                        return true
+                    }
+                }
+            }
+        }
+        #endif
+
+        /// The stored elements, copied out of CoreGraphics or RenderBox
+        /// storage when needed.
+        fileprivate var elementList: [Path.Element] {
+            guard kind != .elements else {
+                return elements
+            }
+            var result: [Path.Element] = []
+            forEach { result.append($0) }
+            return result
+        }
+
+        fileprivate var storesElements: Bool {
+            kind == .elements
+        }
+
+        fileprivate var isEmpty: Bool {
+            kind == .elements ? elements.isEmpty : rbPath.isEmpty
+        }
+        /* OpenSwiftUI Addition End */
+
         @inline(__always)
         fileprivate var rbPath: ORBPath {
             switch kind {
@@ -175,6 +358,12 @@ public struct Path: Equatable, LosslessStringConvertible, @unchecked Sendable {
             case .buffer:
                 let storage = unsafeBitCast(self, to: ORBPath.Storage.self)
                 return ORBPath(storage: storage, callbacks: Self.bufferCallbacks)
+            case .elements:
+                #if canImport(CoreGraphics)
+                return ORBPath(cgPath: elementsCGPath)
+                #else
+                _openSwiftUIPlatformUnimplementedFailure()
+                #endif
             }
         }
         
@@ -193,8 +382,13 @@ public struct Path: Equatable, LosslessStringConvertible, @unchecked Sendable {
                 // return data.rbPath.boundingBox // FIXME: RB API
                 return .zero
             case .buffer:
-                let storage = unsafeBitCast(self, to: ORBPath.Storage.self)
-                return storage.boundingRect
+                // The buffer is stored in `data`, as the buffer callbacks
+                // expect, rather than at the start of the box.
+                return withUnsafeMutablePointer(to: &data) { pointer in
+                    unsafeBitCast(pointer, to: ORBPath.Storage.self).boundingRect
+                }
+            case .elements:
+                return PathGeometry.boundingRect(of: elements)
             }
         }
 
@@ -207,6 +401,9 @@ public struct Path: Equatable, LosslessStringConvertible, @unchecked Sendable {
 
         @usableFromInline
         package static func == (lhs: PathBox, rhs: PathBox) -> Bool {
+            if lhs.kind == .elements || rhs.kind == .elements {
+                return lhs.elementList == rhs.elementList
+            }
             return lhs.rbPath.isEqual(to: rhs.rbPath)
         }
     }
@@ -355,11 +552,17 @@ public struct Path: Equatable, LosslessStringConvertible, @unchecked Sendable {
     ///
     public init(roundedRect rect: CGRect, cornerRadii: RectangleCornerRadii, style: RoundedCornerStyle = .continuous) {
         guard !rect.isNull else {
-            storage = .empty
+            self.init()
             return
         }
-        // TODO: addRoundedRect
-        _openSwiftUIUnimplementedFailure()
+        let radius = cornerRadii.topLeft
+        if cornerRadii.topRight == radius, cornerRadii.bottomRight == radius, cornerRadii.bottomLeft == radius {
+            self.init(roundedRect: rect, cornerRadius: radius, style: style)
+        } else {
+            var elements: [Element] = []
+            PathGeometry.appendRoundedRect(rect, cornerRadii: cornerRadii, to: &elements)
+            self.init(elements: elements)
+        }
     }
 
     /// Creates a path as an ellipse within the given rectangle.
@@ -408,20 +611,43 @@ public struct Path: Equatable, LosslessStringConvertible, @unchecked Sendable {
     /// `Path.stringRepresentation`. Fails if the `string` does not
     /// describe a valid path.
     public init?(_ string: String) {
-        #if canImport(CoreGraphics)
-        let mutablePath = CGMutablePath()
-        let nsString = string as NSString
-        guard let str = nsString.utf8String else {
+        /* OpenSwiftUI Addition Begin */
+        // Parsed without CoreGraphics, straight into RenderBox path storage
+        // where it is available and into an element list elsewhere.
+        #if OPENSWIFTUI_CF_CGTYPES
+        guard let box = PathBox(parsing: string) else {
             return nil
         }
-        guard _CGPathParseString(mutablePath, str) else {
+        storage = .path(box)
+        #else
+        var elements: [Element] = []
+        let parsed = _PathParseString(string, &elements) { info, element, points in
+            let elements = info!.assumingMemoryBound(to: [Path.Element].self)
+            func point(_ index: Int) -> CGPoint {
+                CGPoint(x: CGFloat(points[index * 2]), y: CGFloat(points[index * 2 + 1]))
+            }
+            switch element {
+            case .moveToPoint:
+                elements.pointee.append(.move(to: point(0)))
+            case .addLineToPoint:
+                elements.pointee.append(.line(to: point(0)))
+            case .addQuadCurveToPoint:
+                elements.pointee.append(.quadCurve(to: point(1), control: point(0)))
+            case .addCurveToPoint:
+                elements.pointee.append(.curve(to: point(2), control1: point(0), control2: point(1)))
+            case .closeSubpath:
+                elements.pointee.append(.closeSubpath)
+            @unknown default:
+                return false
+            }
+            return true
+        }
+        guard parsed else {
             return nil
         }
-        storage = .path(PathBox(mutablePath))
-        #else
-        _openSwiftUIPlatformUnimplementedWarning()
-        return nil
+        self.init(elements: elements)
         #endif
+        /* OpenSwiftUI Addition End */
     }
 
     /// A description of the path that may be used to recreate the path
@@ -430,7 +656,25 @@ public struct Path: Equatable, LosslessStringConvertible, @unchecked Sendable {
         #if canImport(Darwin)
         _CGPathCopyDescription(cgPath, 0.0)
         #else
-        _openSwiftUIPlatformUnimplementedFailure()
+        /* OpenSwiftUI Addition Begin */
+        var description = PathDescription(step: 0)
+        defer { description.destroy() }
+        forEach { element in
+            switch element {
+            case let .move(to: point):
+                description.append(.moveToPoint, [point])
+            case let .line(to: point):
+                description.append(.addLineToPoint, [point])
+            case let .quadCurve(to: end, control: control):
+                description.append(.addQuadCurveToPoint, [control, end])
+            case let .curve(to: end, control1: control1, control2: control2):
+                description.append(.addCurveToPoint, [control1, control2, end])
+            case .closeSubpath:
+                description.append(.closeSubpath, [])
+            }
+        }
+        return String(cString: description.cString())
+        /* OpenSwiftUI Addition End */
         #endif
     }
 
@@ -499,7 +743,7 @@ public struct Path: Equatable, LosslessStringConvertible, @unchecked Sendable {
         case .stroked, .trimmed:
             _openSwiftUIUnreachableCode()
         case let .path(pathBox):
-            pathBox.rbPath.isEmpty
+            pathBox.isEmpty
         }
     }
 
@@ -530,11 +774,27 @@ public struct Path: Equatable, LosslessStringConvertible, @unchecked Sendable {
     /// If `eoFill` is true, this method uses the even-odd rule to define which
     /// points are inside the path. Otherwise, it uses the non-zero rule.
     public func contains(_ p: CGPoint, eoFill: Bool = false) -> Bool {
-        _openSwiftUIUnimplementedFailure()
+        switch storage {
+        case .empty:
+            false
+        case let .rect(rect):
+            rect.contains(p)
+        default:
+            PathWindingTester(self).contains(p, eoFill: eoFill)
+        }
     }
 
     package func contains(points: [CGPoint], eoFill: Bool = false, origin: CGPoint = .zero) -> BitVector64 {
-        _openSwiftUIUnimplementedFailure()
+        switch storage {
+        case .empty:
+            BitVector64()
+        case let .rect(rect):
+            points.prefix(64).mapBool { point in
+                rect.contains(CGPoint(x: point.x - origin.x, y: point.y - origin.y))
+            }
+        default:
+            PathWindingTester(self).contains(points: points, eoFill: eoFill, origin: origin)
+        }
     }
 
     /// An element of a path.
@@ -569,13 +829,38 @@ public struct Path: Equatable, LosslessStringConvertible, @unchecked Sendable {
 
     /// Calls `body` with each element in the path.
     public func forEach(_ body: (Path.Element) -> Void) {
-        _openSwiftUIUnimplementedFailure()
+        var elements: [Element] = []
+        switch storage {
+        case .empty:
+            return
+        case let .rect(rect):
+            PathGeometry.appendRect(rect, to: &elements)
+        case let .ellipse(rect):
+            PathGeometry.appendEllipse(in: rect, to: &elements)
+        case let .roundedRect(fixedRoundedRect):
+            PathGeometry.appendRoundedRect(
+                fixedRoundedRect.rect,
+                cornerSize: fixedRoundedRect.clampedCornerSize,
+                to: &elements
+            )
+        case .stroked, .trimmed:
+            _openSwiftUIUnreachableCode()
+        case let .path(pathBox):
+            pathBox.forEach(body)
+            return
+        }
+        for element in elements {
+            body(element)
+        }
     }
 
     /// Returns a stroked copy of the path using `style` to define how the
     /// stroked outline is created.
     public func strokedPath(_ style: StrokeStyle) -> Path {
-        _openSwiftUIUnimplementedFailure()
+        guard !isEmpty else {
+            return self
+        }
+        return Path(elements: PathStroker(style: style).stroke(self))
     }
 
     /// Returns a partial copy of the path.
@@ -584,7 +869,15 @@ public struct Path: Equatable, LosslessStringConvertible, @unchecked Sendable {
     /// which must be fractions between zero and one defining points
     /// linearly-interpolated along the path.
     public func trimmedPath(from: CGFloat, to: CGFloat) -> Path {
-        _openSwiftUIUnimplementedFailure()
+        let from = max(0, min(from, 1))
+        let to = max(0, min(to, 1))
+        guard from < to else {
+            return Path()
+        }
+        guard from > 0 || to < 1 else {
+            return self
+        }
+        return Path(elements: PathTrimmer().trim(self, from: from, to: to))
     }
 
     package func rect() -> CGRect? {
@@ -638,12 +931,104 @@ extension Path: Shape {
 
 extension Path: ProtobufMessage {
     package func encode(to encoder: inout ProtobufEncoder) throws {
-        _openSwiftUIUnimplementedFailure()
+        switch storage {
+        case .empty:
+            break
+        case let .rect(rect):
+            try encoder.messageField(1, rect)
+        case let .ellipse(rect):
+            try encoder.messageField(2, rect)
+        case let .roundedRect(roundedRect):
+            try encoder.messageField(3, roundedRect)
+        default:
+            encoder.messageField(4) { encoder in
+                encodeElements(to: &encoder)
+            }
+        }
     }
 
     package init(from decoder: inout ProtobufDecoder) throws {
-        _openSwiftUIUnimplementedFailure()
+        var path = Path()
+        while let field = try decoder.nextField() {
+            switch field.tag {
+            case 1: path = Path(try decoder.messageField(field) as CGRect)
+            case 2: path = Path(ellipseIn: try decoder.messageField(field))
+            case 3: path = Path(storage: .roundedRect(try decoder.messageField(field)))
+            case 4: path = try decoder.messageField(field) { try Path(elementsFrom: &$0) }
+            default: try decoder.skipField(field)
+            }
+        }
+        self = path
+    }
+
+    /* OpenSwiftUI Addition Begin */
+    // Elements are stored as a packed list of kinds, 0 to 4 for move, line,
+    // quadCurve, curve and closeSubpath, followed by the packed coordinates of
+    // their points.
+
+    private func encodeElements(to encoder: inout ProtobufEncoder) {
+        var kinds: [UInt] = []
+        var coordinates: [CGFloat] = []
+        forEach { element in
+            switch element {
+            case let .move(point):
+                kinds.append(0)
+                coordinates.append(contentsOf: [point.x, point.y])
+            case let .line(point):
+                kinds.append(1)
+                coordinates.append(contentsOf: [point.x, point.y])
+            case let .quadCurve(point, control):
+                kinds.append(2)
+                coordinates.append(contentsOf: [point.x, point.y, control.x, control.y])
+            case let .curve(point, control1, control2):
+                kinds.append(3)
+                coordinates.append(contentsOf: [point.x, point.y, control1.x, control1.y, control2.x, control2.y])
+            case .closeSubpath:
+                kinds.append(4)
+            }
+        }
+        // Empty packed fields are omitted.
+        encoder.uintsField(1, kinds)
+        encoder.cgFloatsField(2, coordinates)
+    }
+
+    private init(elementsFrom decoder: inout ProtobufDecoder) throws {
+        var kinds: [UInt] = []
+        var coordinates: [CGFloat] = []
+        while let field = try decoder.nextField() {
+            switch field.tag {
+            case 1: try decoder.uintsField(field, into: &kinds)
+            case 2: try decoder.cgFloatsField(field, into: &coordinates)
+            default: try decoder.skipField(field)
+            }
+        }
+        var path = Path()
+        var index = 0
+        func nextPoint() throws -> CGPoint {
+            guard index + 1 < coordinates.count else {
+                throw ProtobufDecoder.DecodingError.failed
+            }
+            defer { index += 2 }
+            return CGPoint(x: coordinates[index], y: coordinates[index + 1])
+        }
+        for kind in kinds {
+            switch kind {
+            case 0: path.move(to: try nextPoint())
+            case 1: path.addLine(to: try nextPoint())
+            case 2:
+                let end = try nextPoint()
+                path.addQuadCurve(to: end, control: try nextPoint())
+            case 3:
+                let end = try nextPoint()
+                let control1 = try nextPoint()
+                path.addCurve(to: end, control1: control1, control2: try nextPoint())
+            case 4: path.closeSubpath()
+            default: throw ProtobufDecoder.DecodingError.failed
+            }
+        }
+        self = path
     }
+    /* OpenSwiftUI Addition End */
 }
 
 // MARK: - StrokedPath
@@ -681,18 +1066,30 @@ extension TrimmedPath: Sendable {}
 @available(OpenSwiftUI_v1_0, *)
 extension Path {
     public mutating func move(to end: CGPoint) {
-        _openSwiftUIUnimplementedFailure()
+        withMutableElements { elements in
+            elements.append(.move(to: end))
+        }
     }
 
     public mutating func addLine(to end: CGPoint) {
-        _openSwiftUIUnimplementedFailure()
+        withMutableElements { elements in
+            guard !elements.isEmpty else {
+                return
+            }
+            elements.append(.line(to: end))
+        }
     }
 
     public mutating func addQuadCurve(
         to end: CGPoint,
         control: CGPoint
     ) {
-        _openSwiftUIUnimplementedFailure()
+        withMutableElements { elements in
+            guard !elements.isEmpty else {
+                return
+            }
+            elements.append(.quadCurve(to: end, control: control))
+        }
     }
 
     public mutating func addCurve(
@@ -700,18 +1097,30 @@ extension Path {
         control1: CGPoint,
         control2: CGPoint
     ) {
-        _openSwiftUIUnimplementedFailure()
+        withMutableElements { elements in
+            guard !elements.isEmpty else {
+                return
+            }
+            elements.append(.curve(to: end, control1: control1, control2: control2))
+        }
     }
 
     public mutating func closeSubpath() {
-        _openSwiftUIUnimplementedFailure()
+        withMutableElements { elements in
+            guard let last = elements.last, last != .closeSubpath else {
+                return
+            }
+            elements.append(.closeSubpath)
+        }
     }
 
     public mutating func addRect(
         _ rect: CGRect,
         transform: CGAffineTransform = .identity
     ) {
-        _openSwiftUIUnimplementedFailure()
+        withMutableElements { elements in
+            PathGeometry.appendRect(rect, transform: transform, to: &elements)
+        }
     }
 
     public mutating func addRoundedRect(
@@ -720,7 +1129,9 @@ extension Path {
         style: RoundedCornerStyle = .continuous,
         transform: CGAffineTransform = .identity
     ) {
-        _openSwiftUIUnimplementedFailure()
+        withMutableElements { elements in
+            PathGeometry.appendRoundedRect(rect, cornerSize: cornerSize, transform: transform, to: &elements)
+        }
     }
 
     @available(OpenSwiftUI_v4_0, *)
@@ -730,25 +1141,41 @@ extension Path {
         style: RoundedCornerStyle = .continuous,
         transform: CGAffineTransform = .identity
     ) {
-        _openSwiftUIUnimplementedFailure()
+        withMutableElements { elements in
+            PathGeometry.appendRoundedRect(rect, cornerRadii: cornerRadii, transform: transform, to: &elements)
+        }
     }
 
     public mutating func addEllipse(
         in rect: CGRect,
         transform: CGAffineTransform = .identity
     ) {
-        _openSwiftUIUnimplementedFailure()
+        withMutableElements { elements in
+            PathGeometry.appendEllipse(in: rect, transform: transform, to: &elements)
+        }
     }
 
     public mutating func addRects(
         _ rects: [CGRect],
         transform: CGAffineTransform = .identity
     ) {
-        _openSwiftUIUnimplementedFailure()
+        withMutableElements { elements in
+            for rect in rects {
+                PathGeometry.appendRect(rect, transform: transform, to: &elements)
+            }
+        }
     }
 
     public mutating func addLines(_ lines: [CGPoint]) {
-        _openSwiftUIUnimplementedFailure()
+        guard let first = lines.first else {
+            return
+        }
+        withMutableElements { elements in
+            elements.append(.move(to: first))
+            for point in lines.dropFirst() {
+                elements.append(.line(to: point))
+            }
+        }
     }
 
     public mutating func addRelativeArc(
@@ -758,7 +1185,17 @@ extension Path {
         delta: Angle,
         transform: CGAffineTransform = .identity
     ) {
-        _openSwiftUIUnimplementedFailure()
+        withMutableElements { elements in
+            PathGeometry.appendArc(
+                center: center,
+                radius: radius,
+                startAngle: CGFloat(startAngle.radians),
+                delta: CGFloat(delta.radians),
+                transform: transform,
+                hasCurrentPoint: !elements.isEmpty,
+                to: &elements
+            )
+        }
     }
 
     public mutating func addArc(
@@ -769,7 +1206,27 @@ extension Path {
         clockwise: Bool,
         transform: CGAffineTransform = .identity
     ) {
-        _openSwiftUIUnimplementedFailure()
+        // Like CoreGraphics, `clockwise` sweeps towards decreasing angles.
+        let fullTurn = 2 * Double.pi
+        var delta = endAngle.radians - startAngle.radians
+        if clockwise {
+            if delta > 0 {
+                delta -= fullTurn * (delta / fullTurn).rounded(.up)
+            }
+            delta = max(delta, -fullTurn)
+        } else {
+            if delta < 0 {
+                delta += fullTurn * (-delta / fullTurn).rounded(.up)
+            }
+            delta = min(delta, fullTurn)
+        }
+        addRelativeArc(
+            center: center,
+            radius: radius,
+            startAngle: startAngle,
+            delta: .radians(delta),
+            transform: transform
+        )
     }
 
     public mutating func addArc(
@@ -778,23 +1235,81 @@ extension Path {
         radius: CGFloat,
         transform: CGAffineTransform = .identity
     ) {
-        _openSwiftUIUnimplementedFailure()
+        guard var start = currentPoint else {
+            return
+        }
+        if !transform.isIdentity {
+            start = start.applying(transform.inverted())
+        }
+        let corner = tangent1End
+        func unit(_ x: CGFloat, _ y: CGFloat) -> CGPoint {
+            let length = sqrt(x * x + y * y)
+            return length > 0 ? CGPoint(x: x / length, y: y / length) : .zero
+        }
+        let d0 = unit(start.x - corner.x, start.y - corner.y)
+        let d1 = unit(tangent2End.x - corner.x, tangent2End.y - corner.y)
+        let cross = d0.x * d1.y - d0.y * d1.x
+        let halfAngle = acos(max(-1, min(1, d0.x * d1.x + d0.y * d1.y))) / 2
+        guard radius > 0, abs(cross) > 1e-9, halfAngle > 0 else {
+            addLine(to: corner.applying(transform))
+            return
+        }
+        let tangentLength = radius / tan(halfAngle)
+        let bisector = unit(d0.x + d1.x, d0.y + d1.y)
+        let centerLength = radius / sin(halfAngle)
+        let center = CGPoint(x: corner.x + bisector.x * centerLength, y: corner.y + bisector.y * centerLength)
+        let p0 = CGPoint(x: corner.x + d0.x * tangentLength, y: corner.y + d0.y * tangentLength)
+        let p1 = CGPoint(x: corner.x + d1.x * tangentLength, y: corner.y + d1.y * tangentLength)
+        let startAngle = atan2(p0.y - center.y, p0.x - center.x)
+        var delta = atan2(p1.y - center.y, p1.x - center.x) - startAngle
+        if delta > .pi {
+            delta -= 2 * .pi
+        } else if delta < -.pi {
+            delta += 2 * .pi
+        }
+        withMutableElements { elements in
+            PathGeometry.appendArc(
+                center: center,
+                radius: radius,
+                startAngle: startAngle,
+                delta: delta,
+                transform: transform,
+                hasCurrentPoint: true,
+                to: &elements
+            )
+        }
     }
 
     public mutating func addPath(
         _ path: Path,
         transform: CGAffineTransform = .identity
     ) {
-        _openSwiftUIUnimplementedFailure()
+        guard !path.isEmpty else {
+            return
+        }
+        withMutableElements { elements in
+            path.forEach { element in
+                elements.append(transform.isIdentity ? element : element.applying(transform))
+            }
+        }
     }
 
     public var currentPoint: CGPoint? {
-        get { _openSwiftUIUnimplementedFailure() }
+        get {
+            var elements: [Element] = []
+            forEach { elements.append($0) }
+            return PathGeometry.currentPoint(of: elements)
+        }
     }
 
     @available(OpenSwiftUI_v5_0, *)
     public func normalized(eoFill: Bool = true) -> Path {
-        _openSwiftUIUnimplementedFailure()
+        switch storage {
+        case .empty, .rect, .ellipse, .roundedRect:
+            return self
+        default:
+            return PathClipper(operation: .normalization, eoFill: eoFill).combine(self)
+        }
     }
 
     @available(OpenSwiftUI_v5_0, *)
@@ -802,7 +1317,13 @@ extension Path {
         _ other: Path,
         eoFill: Bool = false
     ) -> Path {
-        _openSwiftUIUnimplementedFailure()
+        if let rect = rect(), let otherRect = other.rect() {
+            return Path(rect.intersection(otherRect))
+        }
+        guard !isEmpty, !other.isEmpty, boundingRect.intersects(other.boundingRect) else {
+            return Path()
+        }
+        return PathClipper(operation: .intersection, eoFill: eoFill).combine(self, other)
     }
 
     @available(OpenSwiftUI_v5_0, *)
@@ -810,7 +1331,7 @@ extension Path {
         _ other: Path,
         eoFill: Bool = false
     ) -> Path {
-        _openSwiftUIUnimplementedFailure()
+        PathClipper(operation: .union, eoFill: eoFill).combine(self, other)
     }
 
     @available(OpenSwiftUI_v5_0, *)
@@ -818,7 +1339,10 @@ extension Path {
         _ other: Path,
         eoFill: Bool = false
     ) -> Path {
-        _openSwiftUIUnimplementedFailure()
+        guard !isEmpty else {
+            return Path()
+        }
+        return PathClipper(operation: .subtraction, eoFill: eoFill).combine(self, other)
     }
 
     @available(OpenSwiftUI_v5_0, *)
@@ -826,7 +1350,7 @@ extension Path {
         _ other: Path,
         eoFill: Bool = false
     ) -> Path {
-        _openSwiftUIUnimplementedFailure()
+        PathClipper(operation: .symmetricDifference, eoFill: eoFill).combine(self, other)
     }
 
     @available(OpenSwiftUI_v5_0, *)
@@ -834,7 +1358,10 @@ extension Path {
         _ other: Path,
         eoFill: Bool = false
     ) -> Path {
-        _openSwiftUIUnimplementedFailure()
+        guard !isEmpty, !other.isEmpty else {
+            return Path()
+        }
+        return PathClipper(operation: .intersection, eoFill: eoFill).clipLines(of: self, to: other, keepsInside: true)
     }
 
     @available(OpenSwiftUI_v5_0, *)
@@ -842,11 +1369,25 @@ extension Path {
         _ other: Path,
         eoFill: Bool = false
     ) -> Path {
-        _openSwiftUIUnimplementedFailure()
+        guard !isEmpty else {
+            return Path()
+        }
+        return PathClipper(operation: .subtraction, eoFill: eoFill).clipLines(of: self, to: other, keepsInside: false)
     }
 
     package mutating func formTrivialUnion(_ path: Path) {
-        _openSwiftUIUnimplementedFailure()
+        guard !path.isEmpty else {
+            return
+        }
+        guard !isEmpty else {
+            self = path
+            return
+        }
+        if boundingRect.intersects(path.boundingRect) {
+            self = PathClipper(operation: .union).combine(self, path)
+        } else {
+            addPath(path)
+        }
     }
 
     public func applying(_ transform: CGAffineTransform) -> Path {
@@ -863,7 +1404,9 @@ extension Path {
         case let .roundedRect(fixedRoundedRect) where transform.isRectilinear:
             return Path(storage: .roundedRect(fixedRoundedRect.applying(transform)))
         default:
-            _openSwiftUIUnimplementedFailure()
+            var elements: [Element] = []
+            forEach { elements.append($0.applying(transform)) }
+            return Path(elements: elements)
         }
     }
 
@@ -871,7 +1414,7 @@ extension Path {
         dx: CGFloat,
         dy: CGFloat
     ) -> Path {
-        _openSwiftUIUnimplementedFailure()
+        applying(CGAffineTransform(translationX: dx, y: dy))
     }
 
     func mapPoints(_ body: (inout [CGPoint]) -> ()) -> Path {
@@ -881,6 +1424,54 @@ extension Path {
     }
 }
 
+/* OpenSwiftUI Addition Begin */
+
+// MARK: - Path + Elements
+
+extension Path {
+    package init(elements: [Element]) {
+        storage = elements.isEmpty ? .empty : .path(PathBox(elements: elements))
+    }
+
+    /// Calls `body` with the path's elements, converting the storage to an
+    /// element list first. The list is edited in place when this path holds
+    /// the only reference to it.
+    private mutating func withMutableElements(_ body: (inout [Element]) -> Void) {
+        var elements: [Element]
+        if case var .path(box) = storage, box.storesElements {
+            storage = .empty
+            if isKnownUniquelyReferenced(&box) {
+                body(&box.elements)
+                storage = box.elements.isEmpty ? .empty : .path(box)
+                return
+            }
+            elements = box.elements
+        } else {
+            elements = []
+            forEach { elements.append($0) }
+        }
+        body(&elements)
+        self = Path(elements: elements)
+    }
+}
+
+/* OpenSwiftUI Addition End */
+
+/* OpenSwiftUI Addition Begin */
+
+// MARK: - PathDescription + Path
+
+extension PathDescription {
+    fileprivate mutating func append(_ element: PathStringElement, _ points: [CGPoint]) {
+        let coordinates = points.flatMap { [Double($0.x), Double($0.y)] }
+        coordinates.withUnsafeBufferPointer { buffer in
+            append(element: element, points: buffer.baseAddress)
+        }
+    }
+}
+
+/* OpenSwiftUI Addition End */
+
 // MARK: - RenderBox
 
 private let temporaryPathCallbacks: UnsafePointer<ORBPath.Callbacks> = {
@@ -0,0 +1,995 @@
+//
+//  PathClipper.swift
+//  OpenSwiftUICore
+//
+//  Status: WIP
+
+/* OpenSwiftUI Addition Begin */
+
+package import Foundation
+package import OpenCoreGraphicsShims
+
+// MARK: - PathClipper
+
+/// Computes boolean combinations of filled paths.
+///
+/// Both operands are flattened and swept upward with a line that only
+/// stops where something happens: an edge starts or ends, a horizontal
+/// edge lies on it, or two neighbouring edges cross. The edges crossing the
+/// line are kept in a balanced tree ordered from left to right, each with
+/// the fill state of both operands just to its right. At every stop only
+/// the edges around the event points are revisited, and only newly
+/// adjacent edges are tested for crossings, so a combination costs
+/// O((n + k) log n) for n edges and k crossings. Edges whose fill state
+/// differs on their two sides are the side edges of the result; they are
+/// joined by the horizontal differences between the covered spans below
+/// and above each stop, and stitched into closed outlines with the interior
+/// on their left, so the result fills the same with either fill rule.
+package struct PathClipper {
+    package enum Operation {
+        case union
+        case intersection
+        case subtraction
+        case symmetricDifference
+        /// Resolves the fill rule of the first operand only.
+        case normalization
+    }
+
+    package var operation: Operation
+    package var eoFill: Bool
+    package var tolerance: CGFloat
+
+    package init(
+        operation: Operation,
+        eoFill: Bool = false,
+        tolerance: CGFloat = PathGeometry.defaultTolerance
+    ) {
+        self.operation = operation
+        self.eoFill = eoFill
+        self.tolerance = tolerance
+    }
+
+    // MARK: - Fill operations
+
+    package func combine(_ lhs: Path, _ rhs: Path = Path()) -> Path {
+        var edges: [Edge] = []
+        appendEdges(of: lhs, operand: 0, to: &edges)
+        if operation != .normalization {
+            appendEdges(of: rhs, operand: 1, to: &edges)
+        }
+        var sweep = Sweep(clipper: self, edges: edges)
+        sweep.run()
+        return Path(elements: stitch(sweep.segments))
+    }
+
+    /// Appends the boundary along the line at `y` between the spans covered
+    /// just below it and the spans covered just above it.
+    private func appendHorizontals(y: Double, below: [Double], above: [Double], to segments: inout [Segment]) {
+        guard !below.isEmpty || !above.isEmpty else {
+            return
+        }
+        var events: [(x: Double, below: Int, above: Int)] = []
+        for index in stride(from: 0, to: below.count - 1, by: 2) {
+            events.append((min(below[index], below[index + 1]), 1, 0))
+            events.append((max(below[index], below[index + 1]), -1, 0))
+        }
+        for index in stride(from: 0, to: above.count - 1, by: 2) {
+            events.append((min(above[index], above[index + 1]), 0, 1))
+            events.append((max(above[index], above[index + 1]), 0, -1))
+        }
+        events.sort { $0.x < $1.x }
+        var belowCount = 0
+        var aboveCount = 0
+        var index = 0
+        while index < events.count {
+            let x = events[index].x
+            while index < events.count, events[index].x == x {
+                belowCount += events[index].below
+                aboveCount += events[index].above
+                index += 1
+            }
+            guard index < events.count else {
+                break
+            }
+            let nextX = events[index].x
+            let isBelow = belowCount > 0
+            guard isBelow != (aboveCount > 0) else {
+                continue
+            }
+            let left = Key(x: x, y: y)
+            let right = Key(x: nextX, y: y)
+            // The top of a region runs right to left, the bottom left to right.
+            segments.append(isBelow
+                ? Segment(start: right, end: left, edge: -1)
+                : Segment(start: left, end: right, edge: -1))
+        }
+    }
+
+    /// Chains segments into closed loops. A walk that comes back to a vertex
+    /// it already passed splits off the loop it closed, so outlines touching
+    /// at a vertex become separate subpaths.
+    private func stitch(_ segments: [Segment]) -> [Path.Element] {
+        var outgoing: [Key: [Int]] = [:]
+        for (index, segment) in segments.enumerated() {
+            outgoing[segment.start, default: []].append(index)
+        }
+        var isUsed = [Bool](repeating: false, count: segments.count)
+        var elements: [Path.Element] = []
+        var loop: [Int] = []
+        var positions: [Key: Int] = [:]
+        for first in segments.indices where !isUsed[first] {
+            loop.removeAll(keepingCapacity: true)
+            positions.removeAll(keepingCapacity: true)
+            var current = first
+            while true {
+                isUsed[current] = true
+                positions[segments[current].start] = loop.count
+                loop.append(current)
+                let end = segments[current].end
+                if let position = positions[end] {
+                    appendLoop(Array(loop[position...]), of: segments, to: &elements)
+                    for index in loop[position...] {
+                        positions[segments[index].start] = nil
+                    }
+                    loop.removeSubrange(position...)
+                }
+                guard let next = outgoing[end]?.first(where: { !isUsed[$0] }) else {
+                    break
+                }
+                current = next
+            }
+            if !loop.isEmpty {
+                appendLoop(loop, of: segments, to: &elements)
+            }
+        }
+        return elements
+    }
+
+    private func appendLoop(
+        _ loop: [Int],
+        of segments: [Segment],
+        to elements: inout [Path.Element]
+    ) {
+        // Drop the vertices between pieces of the same edge.
+        var points: [CGPoint] = []
+        for (offset, index) in loop.enumerated() {
+            let previous = loop[(offset + loop.count - 1) % loop.count]
+            guard segments[previous].edge != segments[index].edge else {
+                continue
+            }
+            points.append(segments[index].start.point)
+        }
+        guard points.count > 2, abs(signedArea(points)) > 1e-9 else {
+            return
+        }
+        elements.append(.move(to: points[0]))
+        for point in points.dropFirst() {
+            elements.append(.line(to: point))
+        }
+        elements.append(.closeSubpath)
+    }
+
+    @inline(__always)
+    private func contains(_ windings: (Int, Int)) -> Bool {
+        let lhs = isInside(windings.0)
+        switch operation {
+        case .union:
+            return lhs || isInside(windings.1)
+        case .intersection:
+            return lhs && isInside(windings.1)
+        case .subtraction:
+            return lhs && !isInside(windings.1)
+        case .symmetricDifference:
+            return lhs != isInside(windings.1)
+        case .normalization:
+            return lhs
+        }
+    }
+
+    @inline(__always)
+    private func isInside(_ winding: Int) -> Bool {
+        eoFill ? winding & 1 != 0 : winding != 0
+    }
+
+    // MARK: - Line operations
+
+    /// Returns the parts of the outline of `lhs` that lie inside the filled
+    /// area of `rhs`, or outside it when `keepsInside` is `false`.
+    package func clipLines(of lhs: Path, to rhs: Path, keepsInside: Bool) -> Path {
+        var edges: [Edge] = []
+        appendEdges(of: rhs, operand: 1, to: &edges)
+        let index = EdgeIndex(edges)
+        var elements: [Path.Element] = []
+        var parameters: [Double] = []
+        for contour in PathFlattener(lhs, tolerance: tolerance).contours {
+            var points = contour.points
+            if contour.isClosed, let first = points.first {
+                points.append(first)
+            }
+            var lastEnd: CGPoint?
+            for segment in 1 ..< max(points.count, 1) {
+                let p = points[segment - 1]
+                let q = points[segment]
+                let px = Double(p.x), py = Double(p.y)
+                let rx = Double(q.x) - px, ry = Double(q.y) - py
+                parameters.removeAll(keepingCapacity: true)
+                parameters.append(0)
+                index.forEachEdge(minY: min(py, py + ry), maxY: max(py, py + ry)) { edge in
+                    let sx = edge.x1 - edge.x0, sy = edge.y1 - edge.y0
+                    let denominator = rx * sy - ry * sx
+                    guard denominator != 0 else {
+                        return
+                    }
+                    let ox = edge.x0 - px, oy = edge.y0 - py
+                    let t = (ox * sy - oy * sx) / denominator
+                    let u = (ox * ry - oy * rx) / denominator
+                    if t > 0, t < 1, u >= 0, u <= 1 {
+                        parameters.append(t)
+                    }
+                }
+                parameters.append(1)
+                parameters.sort()
+                for piece in 1 ..< parameters.count {
+                    let t0 = parameters[piece - 1]
+                    let t1 = parameters[piece]
+                    guard t1 > t0 else {
+                        continue
+                    }
+                    let t = (t0 + t1) / 2
+                    guard isInside(index.winding(x: px + rx * t, y: py + ry * t)) == keepsInside else {
+                        lastEnd = nil
+                        continue
+                    }
+                    let start = t0 == 0 ? p : CGPoint(x: px + rx * t0, y: py + ry * t0)
+                    let end = t1 == 1 ? q : CGPoint(x: px + rx * t1, y: py + ry * t1)
+                    if lastEnd != start {
+                        elements.append(.move(to: start))
+                    }
+                    elements.append(.line(to: end))
+                    lastEnd = end
+                }
+            }
+        }
+        return Path(elements: elements)
+    }
+
+    // MARK: - Edges
+
+    private func appendEdges(of path: Path, operand: Int, to edges: inout [Edge]) {
+        guard !path.isEmpty else {
+            return
+        }
+        for contour in PathFlattener(path, tolerance: tolerance).contours {
+            let points = contour.points
+            guard points.count > 1 else {
+                continue
+            }
+            for index in points.indices {
+                let p = points[index]
+                let q = points[(index + 1) % points.count]
+                let x0 = Double(p.x), y0 = Double(p.y)
+                let x1 = Double(q.x), y1 = Double(q.y)
+                guard x0.isFinite, y0.isFinite, x1.isFinite, y1.isFinite else {
+                    continue
+                }
+                if y0 == y1 {
+                    if x0 != x1 {
+                        edges.append(Edge(x0: x0, y0: y0, x1: x1, y1: y1, winding: 0, operand: operand))
+                    }
+                    continue
+                }
+                edges.append(y0 < y1
+                    ? Edge(x0: x0, y0: y0, x1: x1, y1: y1, winding: 1, operand: operand)
+                    : Edge(x0: x1, y0: y1, x1: x0, y1: y0, winding: -1, operand: operand))
+            }
+        }
+    }
+
+    private func signedArea(_ points: [CGPoint]) -> CGFloat {
+        var area: CGFloat = 0
+        for index in points.indices {
+            let p = points[index]
+            let q = points[(index + 1) % points.count]
+            area += p.x * q.y - q.x * p.y
+        }
+        return area / 2
+    }
+}
+
+// MARK: - PathClipper.Edge
+
+extension PathClipper {
+    /// A flattened edge with `y0 <= y1`. `winding` is the direction the
+    /// original edge ran in: +1 for increasing y, -1 for decreasing y and 0
+    /// for horizontal edges, which never affect the winding number.
+    private struct Edge {
+        var x0: Double
+        var y0: Double
+        var x1: Double
+        var y1: Double
+        var winding: Int
+        var operand: Int
+
+        /// The x coordinate at `y`. The endpoints are returned exactly, so
+        /// every stop of the sweep sees the same vertex for the same edge.
+        @inline(__always)
+        func x(at y: Double) -> Double {
+            if y == y0 {
+                return x0
+            }
+            if y == y1 {
+                return x1
+            }
+            return x0 + (x1 - x0) * ((y - y0) / (y1 - y0))
+        }
+
+        /// The change in x per unit of y, for edges that aren't horizontal.
+        var slope: Double {
+            (x1 - x0) / (y1 - y0)
+        }
+    }
+
+    /// A vertex of the outline, compared by the exact bits of its
+    /// coordinates.
+    private struct Key: Hashable {
+        var x: UInt64
+        var y: UInt64
+
+        init(x: Double, y: Double) {
+            // Fold -0 into +0.
+            self.x = (x + 0).bitPattern
+            self.y = (y + 0).bitPattern
+        }
+
+        var point: CGPoint {
+            CGPoint(x: CGFloat(Double(bitPattern: x)), y: CGFloat(Double(bitPattern: y)))
+        }
+    }
+
+    private struct Segment {
+        var start: Key
+        var end: Key
+        /// The edge the segment lies on, or -1 for horizontal segments.
+        var edge: Int32
+    }
+
+    /// Buckets edges by their y range for crossing and winding queries.
+    private struct EdgeIndex {
+        let edges: [Edge]
+        let minY: Double
+        let bucketHeight: Double
+        var buckets: [[Int32]]
+
+        init(_ edges: [Edge]) {
+            self.edges = edges
+            var minY = Double.infinity
+            var maxY = -Double.infinity
+            for edge in edges {
+                minY = min(minY, edge.y0)
+                maxY = max(maxY, edge.y1)
+            }
+            let count = max(1, Int(Double(edges.count).squareRoot()))
+            self.minY = minY
+            bucketHeight = maxY > minY ? (maxY - minY) / Double(count) : 1
+            buckets = Array(repeating: [], count: count)
+            for (index, edge) in edges.enumerated() {
+                for bucket in bucket(edge.y0) ... bucket(edge.y1) {
+                    buckets[bucket].append(Int32(index))
+                }
+            }
+        }
+
+        func bucket(_ y: Double) -> Int {
+            let value = ((y - minY) / bucketHeight).rounded(.down)
+            guard value.isFinite else {
+                return 0
+            }
+            return min(max(Int(value), 0), buckets.count - 1)
+        }
+
+        func forEachEdge(minY: Double, maxY: Double, _ body: (Edge) -> Void) {
+            guard !edges.isEmpty else {
+                return
+            }
+            let first = bucket(minY)
+            let last = bucket(maxY)
+            for bucket in first ... last {
+                for index in buckets[bucket] {
+                    let edge = edges[Int(index)]
+                    // Report an edge only from the first bucket both share.
+                    guard max(self.bucket(edge.y0), first) == bucket,
+                          edge.y1 >= minY, edge.y0 <= maxY else {
+                        continue
+                    }
+                    body(edge)
+                }
+            }
+        }
+
+        func winding(x: Double, y: Double) -> Int {
+            guard !edges.isEmpty else {
+                return 0
+            }
+            var winding = 0
+            for index in buckets[bucket(y)] {
+                let edge = edges[Int(index)]
+                if edge.winding != 0, edge.y0 <= y, y < edge.y1, edge.x(at: y) > x {
+                    winding += edge.winding
+                }
+            }
+            return winding
+        }
+    }
+}
+
+// MARK: - PathClipper.Sweep
+
+extension PathClipper {
+    /// The sweep that finds the side edges of a fill operation.
+    private struct Sweep {
+        let clipper: PathClipper
+        let edges: [Edge]
+        private(set) var segments: [Segment] = []
+        private var active: ActiveEdges
+        private var crossings = CrossingQueue()
+        /// The winding numbers of both operands just right of each active
+        /// edge.
+        private var windings: [(Int, Int)]
+        /// The lower end of the side edge each active edge has open, if the
+        /// fill state differs on its two sides.
+        private var openKeys: [Key?]
+        /// Whether the area right of an open side edge is covered.
+        private var isEntering: [Bool]
+        /// The x coordinate of each edge at the current stop, with values
+        /// that only differ by rounding snapped together.
+        private var snapped: [Double]
+
+        init(clipper: PathClipper, edges: [Edge]) {
+            self.clipper = clipper
+            self.edges = Self.snappingRows(of: edges)
+            active = ActiveEdges(count: edges.count)
+            windings = Array(repeating: (0, 0), count: edges.count)
+            openKeys = Array(repeating: nil, count: edges.count)
+            isEntering = Array(repeating: false, count: edges.count)
+            snapped = Array(repeating: 0, count: edges.count)
+        }
+
+        mutating func run() {
+            let edges = self.edges
+            var starts: [Int] = []
+            var horizontals: [Int] = []
+            for index in edges.indices {
+                if edges[index].winding == 0 {
+                    horizontals.append(index)
+                } else {
+                    starts.append(index)
+                }
+            }
+            var ends = starts
+            starts.sort { edges[$0].y0 < edges[$1].y0 }
+            ends.sort { edges[$0].y1 < edges[$1].y1 }
+            horizontals.sort { edges[$0].y0 < edges[$1].y0 }
+            var nextStart = 0
+            var nextEnd = 0
+            var nextHorizontal = 0
+            var intervals: [(lower: Double, upper: Double)] = []
+            var started: [Int] = []
+            while true {
+                var y = Double.infinity
+                if nextStart < starts.count {
+                    y = min(y, edges[starts[nextStart]].y0)
+                }
+                if nextEnd < ends.count {
+                    y = min(y, edges[ends[nextEnd]].y1)
+                }
+                if nextHorizontal < horizontals.count {
+                    y = min(y, edges[horizontals[nextHorizontal]].y0)
+                }
+                if let crossing = crossings.first {
+                    y = min(y, crossing.y)
+                }
+                guard y < .infinity else {
+                    break
+                }
+                intervals.removeAll(keepingCapacity: true)
+                started.removeAll(keepingCapacity: true)
+                while nextStart < starts.count, edges[starts[nextStart]].y0 == y {
+                    let edge = starts[nextStart]
+                    started.append(edge)
+                    intervals.append((edges[edge].x0, edges[edge].x0))
+                    nextStart += 1
+                }
+                while nextEnd < ends.count, edges[ends[nextEnd]].y1 == y {
+                    let x = edges[ends[nextEnd]].x1
+                    intervals.append((x, x))
+                    nextEnd += 1
+                }
+                while nextHorizontal < horizontals.count, edges[horizontals[nextHorizontal]].y0 == y {
+                    let edge = edges[horizontals[nextHorizontal]]
+                    intervals.append((min(edge.x0, edge.x1), max(edge.x0, edge.x1)))
+                    nextHorizontal += 1
+                }
+                while let crossing = crossings.first, crossing.y == y {
+                    crossings.removeFirst()
+                    guard active.contains(crossing.lhs), active.contains(crossing.rhs) else {
+                        continue
+                    }
+                    let lhs = edges[crossing.lhs].x(at: y)
+                    let rhs = edges[crossing.rhs].x(at: y)
+                    intervals.append((min(lhs, rhs), max(lhs, rhs)))
+                }
+                stop(at: y, intervals: &intervals, started: &started)
+            }
+        }
+
+        /// Moves y coordinates that only differ by rounding onto one value.
+        ///
+        /// An edge spanning a few ulps vertically becomes horizontal, rather
+        /// than crossing other edges at heights where its x coordinate can't
+        /// be told apart.
+        private static func snappingRows(of edges: [Edge]) -> [Edge] {
+            var ys: [Double] = []
+            ys.reserveCapacity(edges.count * 2)
+            for edge in edges {
+                ys.append(edge.y0)
+                ys.append(edge.y1)
+            }
+            ys.sort()
+            var rows: [UInt64: Double] = [:]
+            var row = 0.0
+            for index in ys.indices {
+                if index == 0 || !isTied(ys[index - 1], ys[index]) {
+                    row = ys[index]
+                }
+                rows[ys[index].bitPattern] = row
+            }
+            return edges.map { edge in
+                var edge = edge
+                edge.y0 = rows[edge.y0.bitPattern] ?? edge.y0
+                edge.y1 = rows[edge.y1.bitPattern] ?? edge.y1
+                if edge.y0 == edge.y1 {
+                    edge.winding = 0
+                }
+                return edge
+            }
+        }
+
+        /// Updates the active edges around the event points at `y`.
+        ///
+        /// Every other active edge keeps its place, its winding numbers and
+        /// its open side edge: a stop changes the winding numbers of the
+        /// area right of a group of event points by the windings of the
+        /// edges starting there minus those of the edges ending there, and
+        /// those cancel out because every contour is closed.
+        private mutating func stop(
+            at y: Double,
+            intervals: inout [(lower: Double, upper: Double)],
+            started: inout [Int]
+        ) {
+            let edges = self.edges
+            intervals.sort { $0.lower < $1.lower }
+            started.sort { edges[$0].x0 < edges[$1].x0 }
+            var nextStarted = 0
+            var runs: [(left: Int, edges: [Int])] = []
+            var index = 0
+            while index < intervals.count {
+                let lower = intervals[index].lower
+                var upper = intervals[index].upper
+                index += 1
+                while index < intervals.count, intervals[index].lower <= upper + Self.padding(upper) {
+                    upper = max(upper, intervals[index].upper)
+                    index += 1
+                }
+                upper += Self.padding(upper)
+                var added: [Int] = []
+                while nextStarted < started.count, edges[started[nextStarted]].x0 <= upper {
+                    added.append(started[nextStarted])
+                    nextStarted += 1
+                }
+                runs.append(update(at: y, from: lower - Self.padding(lower), to: upper, adding: added))
+            }
+            // Test the new neighbours once every group is in place, since a
+            // group's right neighbour may belong to the next group.
+            for run in runs {
+                var previous = run.left
+                for edge in run.edges {
+                    if previous >= 0 {
+                        findCrossing(of: previous, and: edge, above: y)
+                    }
+                    previous = edge
+                }
+                if previous >= 0 {
+                    let next = active.next(previous)
+                    if next >= 0 {
+                        findCrossing(of: previous, and: next, above: y)
+                    }
+                }
+            }
+        }
+
+        /// Replaces the active edges through `lower ... upper` at `y` with
+        /// the edges continuing above the line, and emits the side edges and
+        /// horizontal boundaries that end or start there.
+        ///
+        /// - Returns: The active edge left of the group, or -1, and the
+        ///   group's edges above the line.
+        private mutating func update(
+            at y: Double,
+            from lower: Double,
+            to upper: Double,
+            adding added: [Int]
+        ) -> (left: Int, edges: [Int]) {
+            let edges = self.edges
+            // The tree is ordered below the line, where x coordinates at the
+            // line only tie or swap inside the group.
+            var first = active.lowerBound { edges[$0].x(at: y) >= lower }
+            var left = first < 0 ? active.last : active.previous(first)
+            while left >= 0, edges[left].x(at: y) >= lower {
+                first = left
+                left = active.previous(left)
+            }
+            var below: [Int] = []
+            var node = first
+            while node >= 0, edges[node].x(at: y) <= upper {
+                below.append(node)
+                node = active.next(node)
+            }
+            var above = below.filter { edges[$0].y1 > y } + added
+            for i in 1 ..< max(above.count, 1) {
+                var j = i
+                while j > 0, isOrdered(above[j], before: above[j - 1], at: y) {
+                    above.swapAt(j - 1, j)
+                    j -= 1
+                }
+            }
+            var points = (below + added).map { (x: edges[$0].x(at: y), edge: $0) }
+            points.sort { $0.x < $1.x }
+            for index in points.indices {
+                if index == 0 || !Self.isTied(points[index - 1].x, points[index].x) {
+                    snapped[points[index].edge] = points[index].x
+                } else {
+                    snapped[points[index].edge] = snapped[points[index - 1].edge]
+                }
+            }
+
+            let leftWindings = left < 0 ? (0, 0) : windings[left]
+            let rightWindings = below.last.map { windings[$0] } ?? leftWindings
+            var belowSpans: [Double] = clipper.contains(leftWindings) ? [-.infinity] : []
+            for edge in below {
+                guard let start = openKeys[edge] else {
+                    continue
+                }
+                let end = Key(x: snapped[edge], y: y)
+                segments.append(isEntering[edge]
+                    ? Segment(start: end, end: start, edge: Int32(edge))
+                    : Segment(start: start, end: end, edge: Int32(edge)))
+                belowSpans.append(snapped[edge])
+                openKeys[edge] = nil
+            }
+            if clipper.contains(rightWindings) {
+                belowSpans.append(.infinity)
+            }
+
+            for edge in below {
+                active.remove(edge)
+            }
+            var previous = left
+            for edge in above {
+                active.insert(edge, after: previous)
+                previous = edge
+            }
+
+            var current = leftWindings
+            var isInside = clipper.contains(current)
+            var aboveSpans: [Double] = isInside ? [-.infinity] : []
+            var index = 0
+            while index < above.count {
+                // Coincident edges change the winding together.
+                var end = index
+                repeat {
+                    let edge = edges[above[end]]
+                    if edge.operand == 0 {
+                        current.0 += edge.winding
+                    } else {
+                        current.1 += edge.winding
+                    }
+                    end += 1
+                } while end < above.count && isCoincident(above[index], above[end], at: y)
+                let nowInside = clipper.contains(current)
+                if nowInside != isInside {
+                    let edge = above[index]
+                    openKeys[edge] = Key(x: snapped[edge], y: y)
+                    isEntering[edge] = nowInside
+                    aboveSpans.append(snapped[edge])
+                    isInside = nowInside
+                }
+                for edge in above[index ..< end] {
+                    windings[edge] = current
+                }
+                index = end
+            }
+            if isInside {
+                aboveSpans.append(.infinity)
+            }
+            clipper.appendHorizontals(y: y, below: belowSpans, above: aboveSpans, to: &segments)
+            return (left, above)
+        }
+
+        /// Queues the crossing of two neighbouring edges above `y`, if they
+        /// swap before either ends.
+        private mutating func findCrossing(of lhs: Int, and rhs: Int, above y: Double) {
+            let top = min(edges[lhs].y1, edges[rhs].y1)
+            let dLo = edges[lhs].x(at: y) - edges[rhs].x(at: y)
+            let dHi = edges[lhs].x(at: top) - edges[rhs].x(at: top)
+            guard dLo < 0, dHi > 0 else {
+                return
+            }
+            // Rounding can put the crossing on the line itself; the edges
+            // are swapped just above it instead.
+            let crossing = max(y + (top - y) * (dLo / (dLo - dHi)), y.nextUp)
+            if crossing < top {
+                crossings.insert(Crossing(y: crossing, lhs: lhs, rhs: rhs))
+            }
+        }
+
+        /// Whether `lhs` is left of `rhs` just above `y`.
+        private func isOrdered(_ lhs: Int, before rhs: Int, at y: Double) -> Bool {
+            let lhsX = edges[lhs].x(at: y)
+            let rhsX = edges[rhs].x(at: y)
+            guard Self.isTied(lhsX, rhsX) else {
+                return lhsX < rhsX
+            }
+            let lhsSlope = edges[lhs].slope
+            let rhsSlope = edges[rhs].slope
+            guard lhsSlope == rhsSlope else {
+                return lhsSlope < rhsSlope
+            }
+            return lhs < rhs
+        }
+
+        private func isCoincident(_ lhs: Int, _ rhs: Int, at y: Double) -> Bool {
+            Self.isTied(edges[lhs].x(at: y), edges[rhs].x(at: y)) && edges[lhs].slope == edges[rhs].slope
+        }
+
+        /// Whether two x coordinates are the same point up to rounding, as
+        /// for two edges evaluated at their crossing.
+        private static func isTied(_ lhs: Double, _ rhs: Double) -> Bool {
+            abs(lhs - rhs) <= padding(max(abs(lhs), abs(rhs)))
+        }
+
+        @inline(__always)
+        private static func padding(_ x: Double) -> Double {
+            1e-9 * max(1, abs(x))
+        }
+    }
+
+    private struct Crossing {
+        var y: Double
+        var lhs: Int
+        var rhs: Int
+    }
+
+    /// The pending crossings of neighbouring edges, lowest first.
+    private struct CrossingQueue {
+        private var heap: [Crossing] = []
+
+        var first: Crossing? {
+            heap.first
+        }
+
+        mutating func insert(_ crossing: Crossing) {
+            heap.append(crossing)
+            var position = heap.count - 1
+            while position > 0 {
+                let parent = (position - 1) / 2
+                guard crossing.y < heap[parent].y else {
+                    break
+                }
+                heap[position] = heap[parent]
+                position = parent
+            }
+            heap[position] = crossing
+        }
+
+        mutating func removeFirst() {
+            let last = heap.removeLast()
+            guard !heap.isEmpty else {
+                return
+            }
+            var position = 0
+            while true {
+                var child = 2 * position + 1
+                guard child < heap.count else {
+                    break
+                }
+                if child + 1 < heap.count, heap[child + 1].y < heap[child].y {
+                    child += 1
+                }
+                guard heap[child].y < last.y else {
+                    break
+                }
+                heap[position] = heap[child]
+                position = child
+            }
+            heap[position] = last
+        }
+    }
+
+    /// The edges crossing the sweep line, ordered from left to right.
+    ///
+    /// A treap whose nodes are edge indices, with -1 for no node. Edges are
+    /// inserted next to a known neighbour, so the tree never compares
+    /// coordinates itself; the priorities are a fixed hash of the index,
+    /// which keeps it balanced in expectation.
+    private struct ActiveEdges {
+        private var left: [Int]
+        private var right: [Int]
+        private var parent: [Int]
+        private var isMember: [Bool]
+        private let priorities: [UInt64]
+        private var root = -1
+
+        init(count: Int) {
+            left = Array(repeating: -1, count: count)
+            right = Array(repeating: -1, count: count)
+            parent = Array(repeating: -1, count: count)
+            isMember = Array(repeating: false, count: count)
+            priorities = (0 ..< count).map { index in
+                // SplitMix64 finalizer.
+                var z = UInt64(index) &+ 0x9E37_79B9_7F4A_7C15
+                z = (z ^ (z >> 30)) &* 0xBF58_476D_1CE4_E5B9
+                z = (z ^ (z >> 27)) &* 0x94D0_49BB_1331_11EB
+                return z ^ (z >> 31)
+            }
+        }
+
+        func contains(_ node: Int) -> Bool {
+            isMember[node]
+        }
+
+        var first: Int {
+            var node = root
+            while node >= 0, left[node] >= 0 {
+                node = left[node]
+            }
+            return node
+        }
+
+        var last: Int {
+            var node = root
+            while node >= 0, right[node] >= 0 {
+                node = right[node]
+            }
+            return node
+        }
+
+        func next(_ node: Int) -> Int {
+            var node = node
+            if right[node] >= 0 {
+                node = right[node]
+                while left[node] >= 0 {
+                    node = left[node]
+                }
+                return node
+            }
+            var ancestor = parent[node]
+            while ancestor >= 0, right[ancestor] == node {
+                node = ancestor
+                ancestor = parent[ancestor]
+            }
+            return ancestor
+        }
+
+        func previous(_ node: Int) -> Int {
+            var node = node
+            if left[node] >= 0 {
+                node = left[node]
+                while right[node] >= 0 {
+                    node = right[node]
+                }
+                return node
+            }
+            var ancestor = parent[node]
+            while ancestor >= 0, left[ancestor] == node {
+                node = ancestor
+                ancestor = parent[ancestor]
+            }
+            return ancestor
+        }
+
+        /// Returns the leftmost node for which `predicate` holds, given that
+        /// it holds for every node right of one that does.
+        func lowerBound(where predicate: (Int) -> Bool) -> Int {
+            var node = root
+            var result = -1
+            while node >= 0 {
+                if predicate(node) {
+                    result = node
+                    node = left[node]
+                } else {
+                    node = right[node]
+                }
+            }
+            return result
+        }
+
+        /// Inserts `node` right after `previous`, or first if `previous` is
+        /// -1.
+        mutating func insert(_ node: Int, after previous: Int) {
+            left[node] = -1
+            right[node] = -1
+            isMember[node] = true
+            guard root >= 0 else {
+                parent[node] = -1
+                root = node
+                return
+            }
+            if previous < 0 {
+                let first = self.first
+                left[first] = node
+                parent[node] = first
+            } else if right[previous] < 0 {
+                right[previous] = node
+                parent[node] = previous
+            } else {
+                var successor = right[previous]
+                while left[successor] >= 0 {
+                    successor = left[successor]
+                }
+                left[successor] = node
+                parent[node] = successor
+            }
+            while parent[node] >= 0, priorities[parent[node]] < priorities[node] {
+                rotateUp(node)
+            }
+        }
+
+        mutating func remove(_ node: Int) {
+            while left[node] >= 0 || right[node] >= 0 {
+                let lhs = left[node]
+                let rhs = right[node]
+                rotateUp(rhs < 0 || (lhs >= 0 && priorities[lhs] > priorities[rhs]) ? lhs : rhs)
+            }
+            let ancestor = parent[node]
+            if ancestor < 0 {
+                root = -1
+            } else if left[ancestor] == node {
+                left[ancestor] = -1
+            } else {
+                right[ancestor] = -1
+            }
+            parent[node] = -1
+            isMember[node] = false
+        }
+
+        /// Rotates `node` above its parent, keeping the in-order sequence.
+        private mutating func rotateUp(_ node: Int) {
+            let ancestor = parent[node]
+            let grandparent = parent[ancestor]
+            let child: Int
+            if left[ancestor] == node {
+                child = right[node]
+                left[ancestor] = child
+                right[node] = ancestor
+            } else {
+                child = left[node]
+                right[ancestor] = child
+                left[node] = ancestor
+            }
+            if child >= 0 {
+                parent[child] = ancestor
+            }
+            parent[ancestor] = node
+            parent[node] = grandparent
+            if grandparent < 0 {
+                root = node
+            } else if left[grandparent] == ancestor {
+                left[grandparent] = node
+            } else {
+                right[grandparent] = node
+            }
+        }
+    }
+}
+
+/* OpenSwiftUI Addition End */
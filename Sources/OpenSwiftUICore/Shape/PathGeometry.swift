@@ -0,0 +1,1185 @@
+//
+//  PathGeometry.swift
+//  OpenSwiftUICore
+//
+//  Status: WIP
+
+/* OpenSwiftUI Addition Begin */
+
+package import Foundation
+package import OpenCoreGraphicsShims
+
+// MARK: - PathGeometry
+
+/// A pure-Swift path geometry kernel used where CoreGraphics and RenderBox
+/// are not available.
+///
+/// It generates elements for the primitive path storages, flattens Bézier
+/// curves adaptively, answers winding-number queries, and strokes and trims
+/// element lists.
+package enum PathGeometry {
+    /// Control point offset for a quarter ellipse approximated by a cubic.
+    package static let ellipseControl: CGFloat = 0.552_284_749_830_793_4
+
+    /// The default maximum distance, in path units, between a curve and its
+    /// flattened polyline.
+    package static let defaultTolerance: CGFloat = 0.05
+
+    // MARK: - Primitive elements
+
+    package static func appendRect(
+        _ rect: CGRect,
+        transform: CGAffineTransform = .identity,
+        to elements: inout [Path.Element]
+    ) {
+        guard !rect.isNull else {
+            return
+        }
+        let rect = rect.standardized
+        elements.append(.move(to: CGPoint(x: rect.minX, y: rect.minY).applying(transform)))
+        elements.append(.line(to: CGPoint(x: rect.maxX, y: rect.minY).applying(transform)))
+        elements.append(.line(to: CGPoint(x: rect.maxX, y: rect.maxY).applying(transform)))
+        elements.append(.line(to: CGPoint(x: rect.minX, y: rect.maxY).applying(transform)))
+        elements.append(.closeSubpath)
+    }
+
+    package static func appendEllipse(
+        in rect: CGRect,
+        transform: CGAffineTransform = .identity,
+        to elements: inout [Path.Element]
+    ) {
+        guard !rect.isNull else {
+            return
+        }
+        let rect = rect.standardized
+        let rx = rect.width / 2
+        let ry = rect.height / 2
+        let kx = rx * ellipseControl
+        let ky = ry * ellipseControl
+        let center = CGPoint(x: rect.midX, y: rect.midY)
+        func point(_ x: CGFloat, _ y: CGFloat) -> CGPoint {
+            CGPoint(x: center.x + x, y: center.y + y).applying(transform)
+        }
+        elements.append(.move(to: point(rx, 0)))
+        elements.append(.curve(to: point(0, ry), control1: point(rx, ky), control2: point(kx, ry)))
+        elements.append(.curve(to: point(-rx, 0), control1: point(-kx, ry), control2: point(-rx, ky)))
+        elements.append(.curve(to: point(0, -ry), control1: point(-rx, -ky), control2: point(-kx, -ry)))
+        elements.append(.curve(to: point(rx, 0), control1: point(kx, -ry), control2: point(rx, -ky)))
+        elements.append(.closeSubpath)
+    }
+
+    /// Appends a rounded rectangle with elliptical corners of `cornerSize`.
+    ///
+    /// Continuous corners are approximated with circular ones.
+    package static func appendRoundedRect(
+        _ rect: CGRect,
+        cornerSize: CGSize,
+        transform: CGAffineTransform = .identity,
+        to elements: inout [Path.Element]
+    ) {
+        guard !rect.isNull else {
+            return
+        }
+        let rect = rect.standardized
+        let corner = CGSize(
+            width: min(abs(cornerSize.width), rect.width / 2),
+            height: min(abs(cornerSize.height), rect.height / 2)
+        )
+        appendRoundedRect(
+            rect,
+            topLeft: corner,
+            topRight: corner,
+            bottomRight: corner,
+            bottomLeft: corner,
+            transform: transform,
+            to: &elements
+        )
+    }
+
+    /// Appends a rounded rectangle with a separate circular radius for each
+    /// corner. Radii are scaled down uniformly when adjacent corners would
+    /// overlap.
+    package static func appendRoundedRect(
+        _ rect: CGRect,
+        cornerRadii radii: RectangleCornerRadii,
+        transform: CGAffineTransform = .identity,
+        to elements: inout [Path.Element]
+    ) {
+        guard !rect.isNull else {
+            return
+        }
+        let rect = rect.standardized
+        let topLeft = max(radii.topLeft, 0)
+        let topRight = max(radii.topRight, 0)
+        let bottomRight = max(radii.bottomRight, 0)
+        let bottomLeft = max(radii.bottomLeft, 0)
+        var scale: CGFloat = 1
+        for (length, sum) in [
+            (rect.width, topLeft + topRight),
+            (rect.width, bottomLeft + bottomRight),
+            (rect.height, topLeft + bottomLeft),
+            (rect.height, topRight + bottomRight),
+        ] where sum > length {
+            scale = min(scale, length / sum)
+        }
+        func size(_ radius: CGFloat) -> CGSize {
+            CGSize(width: radius * scale, height: radius * scale)
+        }
+        appendRoundedRect(
+            rect,
+            topLeft: size(topLeft),
+            topRight: size(topRight),
+            bottomRight: size(bottomRight),
+            bottomLeft: size(bottomLeft),
+            transform: transform,
+            to: &elements
+        )
+    }
+
+    private static func appendRoundedRect(
+        _ rect: CGRect,
+        topLeft: CGSize,
+        topRight: CGSize,
+        bottomRight: CGSize,
+        bottomLeft: CGSize,
+        transform: CGAffineTransform,
+        to elements: inout [Path.Element]
+    ) {
+        func point(_ x: CGFloat, _ y: CGFloat) -> CGPoint {
+            CGPoint(x: x, y: y).applying(transform)
+        }
+        func corner(to end: CGPoint, from start: CGPoint, radius: CGSize, cornerX: CGFloat, cornerY: CGFloat) {
+            guard radius.width > 0, radius.height > 0 else {
+                elements.append(.line(to: point(end.x, end.y)))
+                return
+            }
+            let k = ellipseControl
+            elements.append(.curve(
+                to: point(end.x, end.y),
+                control1: point(start.x + (cornerX - start.x) * k, start.y + (cornerY - start.y) * k),
+                control2: point(end.x + (cornerX - end.x) * k, end.y + (cornerY - end.y) * k)
+            ))
+        }
+        let minX = rect.minX
+        let minY = rect.minY
+        let maxX = rect.maxX
+        let maxY = rect.maxY
+        elements.append(.move(to: point(minX + topLeft.width, minY)))
+        elements.append(.line(to: point(maxX - topRight.width, minY)))
+        corner(
+            to: CGPoint(x: maxX, y: minY + topRight.height),
+            from: CGPoint(x: maxX - topRight.width, y: minY),
+            radius: topRight,
+            cornerX: maxX,
+            cornerY: minY
+        )
+        elements.append(.line(to: point(maxX, maxY - bottomRight.height)))
+        corner(
+            to: CGPoint(x: maxX - bottomRight.width, y: maxY),
+            from: CGPoint(x: maxX, y: maxY - bottomRight.height),
+            radius: bottomRight,
+            cornerX: maxX,
+            cornerY: maxY
+        )
+        elements.append(.line(to: point(minX + bottomLeft.width, maxY)))
+        corner(
+            to: CGPoint(x: minX, y: maxY - bottomLeft.height),
+            from: CGPoint(x: minX + bottomLeft.width, y: maxY),
+            radius: bottomLeft,
+            cornerX: minX,
+            cornerY: maxY
+        )
+        elements.append(.line(to: point(minX, minY + topLeft.height)))
+        corner(
+            to: CGPoint(x: minX + topLeft.width, y: minY),
+            from: CGPoint(x: minX, y: minY + topLeft.height),
+            radius: topLeft,
+            cornerX: minX,
+            cornerY: minY
+        )
+        elements.append(.closeSubpath)
+    }
+
+    /// Appends a circular arc of `delta` radians starting at `startAngle`,
+    /// approximated by one cubic per quarter turn.
+    ///
+    /// The arc is connected to the current point with a line when there is
+    /// one, and starts a new subpath otherwise.
+    package static func appendArc(
+        center: CGPoint,
+        radius: CGFloat,
+        startAngle: CGFloat,
+        delta: CGFloat,
+        transform: CGAffineTransform = .identity,
+        hasCurrentPoint: Bool,
+        to elements: inout [Path.Element]
+    ) {
+        func point(_ angle: CGFloat) -> CGPoint {
+            CGPoint(x: center.x + radius * cos(angle), y: center.y + radius * sin(angle))
+        }
+        let start = point(startAngle).applying(transform)
+        elements.append(hasCurrentPoint ? .line(to: start) : .move(to: start))
+        guard delta != 0, radius != 0 else {
+            return
+        }
+        let count = max(1, Int((abs(delta) / (.pi / 2)).rounded(.up)))
+        let step = delta / CGFloat(count)
+        let k = 4 / 3 * tan(step / 4) * radius
+        var angle = startAngle
+        for _ in 0 ..< count {
+            let next = angle + step
+            let p0 = point(angle)
+            let p3 = point(next)
+            let control1 = CGPoint(x: p0.x - k * sin(angle), y: p0.y + k * cos(angle))
+            let control2 = CGPoint(x: p3.x + k * sin(next), y: p3.y - k * cos(next))
+            elements.append(.curve(
+                to: p3.applying(transform),
+                control1: control1.applying(transform),
+                control2: control2.applying(transform)
+            ))
+            angle = next
+        }
+    }
+
+    // MARK: - Element queries
+
+    /// Returns the smallest rectangle enclosing every point on the path,
+    /// excluding Bézier control points.
+    package static func boundingRect(of elements: [Path.Element]) -> CGRect {
+        var minX = CGFloat.infinity
+        var minY = CGFloat.infinity
+        var maxX = -CGFloat.infinity
+        var maxY = -CGFloat.infinity
+        func include(_ point: CGPoint) {
+            minX = min(minX, point.x)
+            minY = min(minY, point.y)
+            maxX = max(maxX, point.x)
+            maxY = max(maxY, point.y)
+        }
+        var current: CGPoint?
+        var start: CGPoint?
+        for element in elements {
+            switch element {
+            case let .move(to: point):
+                include(point)
+                current = point
+                start = point
+            case let .line(to: point):
+                include(point)
+                current = point
+            case let .quadCurve(to: end, control: control):
+                include(end)
+                if let p0 = current {
+                    for t in quadExtrema(p0, control, end) {
+                        include(evaluateQuad(p0, control, end, t))
+                    }
+                }
+                current = end
+            case let .curve(to: end, control1: control1, control2: control2):
+                include(end)
+                if let p0 = current {
+                    for t in cubicExtrema(p0, control1, control2, end) {
+                        include(evaluateCubic(p0, control1, control2, end, t))
+                    }
+                }
+                current = end
+            case .closeSubpath:
+                current = start
+            }
+        }
+        guard minX <= maxX, minY <= maxY else {
+            return .null
+        }
+        return CGRect(x: minX, y: minY, width: maxX - minX, height: maxY - minY)
+    }
+
+    /// Returns the current point after `elements`, matching CoreGraphics:
+    /// after a close the current point is the start of the closed subpath.
+    package static func currentPoint(of elements: [Path.Element]) -> CGPoint? {
+        var current: CGPoint?
+        var start: CGPoint?
+        for element in elements {
+            switch element {
+            case let .move(to: point):
+                current = point
+                start = point
+            case let .line(point),
+                 let .quadCurve(point, _),
+                 let .curve(point, _, _):
+                if current == nil {
+                    start = point
+                }
+                current = point
+            case .closeSubpath:
+                current = start
+            }
+        }
+        return current
+    }
+
+    package static func applying(
+        _ transform: CGAffineTransform,
+        to elements: [Path.Element]
+    ) -> [Path.Element] {
+        elements.map { $0.applying(transform) }
+    }
+
+    // MARK: - Curve helpers
+
+    @inline(__always)
+    static func evaluateQuad(_ p0: CGPoint, _ p1: CGPoint, _ p2: CGPoint, _ t: CGFloat) -> CGPoint {
+        let u = 1 - t
+        return CGPoint(
+            x: u * u * p0.x + 2 * u * t * p1.x + t * t * p2.x,
+            y: u * u * p0.y + 2 * u * t * p1.y + t * t * p2.y
+        )
+    }
+
+    @inline(__always)
+    static func evaluateCubic(_ p0: CGPoint, _ p1: CGPoint, _ p2: CGPoint, _ p3: CGPoint, _ t: CGFloat) -> CGPoint {
+        let u = 1 - t
+        let a = u * u * u
+        let b = 3 * u * u * t
+        let c = 3 * u * t * t
+        let d = t * t * t
+        return CGPoint(
+            x: a * p0.x + b * p1.x + c * p2.x + d * p3.x,
+            y: a * p0.y + b * p1.y + c * p2.y + d * p3.y
+        )
+    }
+
+    /// The number of line segments needed to approximate a Bézier curve of
+    /// `degree` within `tolerance`, from Wang's formula.
+    static func segmentCount(degree: Int, points: [CGPoint], tolerance: CGFloat) -> Int {
+        var deviation: CGFloat = 0
+        if points.count > 2 {
+            for index in 0 ..< points.count - 2 {
+                let dx = points[index].x - 2 * points[index + 1].x + points[index + 2].x
+                let dy = points[index].y - 2 * points[index + 1].y + points[index + 2].y
+                deviation = max(deviation, sqrt(dx * dx + dy * dy))
+            }
+        }
+        let scale = CGFloat(degree * (degree - 1)) / 8
+        let count = sqrt(scale * deviation / max(tolerance, 1e-6))
+        guard count.isFinite else {
+            return 1
+        }
+        return min(max(Int(count.rounded(.up)), 1), 1024)
+    }
+
+    private static func quadExtrema(_ p0: CGPoint, _ p1: CGPoint, _ p2: CGPoint) -> [CGFloat] {
+        var result: [CGFloat] = []
+        for (a, b, c) in [(p0.x, p1.x, p2.x), (p0.y, p1.y, p2.y)] {
+            let denominator = a - 2 * b + c
+            guard denominator != 0 else {
+                continue
+            }
+            let t = (a - b) / denominator
+            if t > 0, t < 1 {
+                result.append(t)
+            }
+        }
+        return result
+    }
+
+    private static func cubicExtrema(_ p0: CGPoint, _ p1: CGPoint, _ p2: CGPoint, _ p3: CGPoint) -> [CGFloat] {
+        var result: [CGFloat] = []
+        for (a, b, c, d) in [(p0.x, p1.x, p2.x, p3.x), (p0.y, p1.y, p2.y, p3.y)] {
+            // Derivative coefficients of the cubic, divided by 3.
+            let qa = -a + 3 * b - 3 * c + d
+            let qb = 2 * (a - 2 * b + c)
+            let qc = b - a
+            if abs(qa) < 1e-12 {
+                if qb != 0 {
+                    let t = -qc / qb
+                    if t > 0, t < 1 {
+                        result.append(t)
+                    }
+                }
+                continue
+            }
+            let discriminant = qb * qb - 4 * qa * qc
+            guard discriminant >= 0 else {
+                continue
+            }
+            let root = sqrt(discriminant)
+            for t in [(-qb + root) / (2 * qa), (-qb - root) / (2 * qa)] where t > 0 && t < 1 {
+                result.append(t)
+            }
+        }
+        return result
+    }
+}
+
+extension Path.Element {
+    package func applying(_ transform: CGAffineTransform) -> Path.Element {
+        switch self {
+        case let .move(to: point):
+            .move(to: point.applying(transform))
+        case let .line(to: point):
+            .line(to: point.applying(transform))
+        case let .quadCurve(to: end, control: control):
+            .quadCurve(to: end.applying(transform), control: control.applying(transform))
+        case let .curve(to: end, control1: control1, control2: control2):
+            .curve(
+                to: end.applying(transform),
+                control1: control1.applying(transform),
+                control2: control2.applying(transform)
+            )
+        case .closeSubpath:
+            .closeSubpath
+        }
+    }
+}
+
+// MARK: - PathFlattener
+
+/// Converts path elements into polylines, subdividing curves adaptively so
+/// each stays within `tolerance` of the true curve.
+package struct PathFlattener {
+    package struct Contour: Equatable {
+        package var points: [CGPoint]
+        package var isClosed: Bool
+    }
+
+    package let tolerance: CGFloat
+    package private(set) var contours: [Contour] = []
+    private var open: Contour?
+    private var current: CGPoint?
+    private var start: CGPoint?
+
+    package init(tolerance: CGFloat = PathGeometry.defaultTolerance) {
+        self.tolerance = tolerance
+    }
+
+    package init(_ path: Path, tolerance: CGFloat = PathGeometry.defaultTolerance) {
+        self.init(tolerance: tolerance)
+        path.forEach { append($0) }
+        finish()
+    }
+
+    package mutating func append(_ element: Path.Element) {
+        switch element {
+        case let .move(to: point):
+            flush()
+            open = Contour(points: [point], isClosed: false)
+            current = point
+            start = point
+        case let .line(to: point):
+            guard beginSegment(to: point) else {
+                return
+            }
+            open!.points.append(point)
+            current = point
+        case let .quadCurve(to: end, control: control):
+            guard beginSegment(to: end), let p0 = current else {
+                return
+            }
+            let count = PathGeometry.segmentCount(degree: 2, points: [p0, control, end], tolerance: tolerance)
+            for step in 1 ..< count {
+                open!.points.append(PathGeometry.evaluateQuad(p0, control, end, CGFloat(step) / CGFloat(count)))
+            }
+            open!.points.append(end)
+            current = end
+        case let .curve(to: end, control1: control1, control2: control2):
+            guard beginSegment(to: end), let p0 = current else {
+                return
+            }
+            let count = PathGeometry.segmentCount(
+                degree: 3,
+                points: [p0, control1, control2, end],
+                tolerance: tolerance
+            )
+            for step in 1 ..< count {
+                open!.points.append(PathGeometry.evaluateCubic(
+                    p0,
+                    control1,
+                    control2,
+                    end,
+                    CGFloat(step) / CGFloat(count)
+                ))
+            }
+            open!.points.append(end)
+            current = end
+        case .closeSubpath:
+            guard open != nil else {
+                return
+            }
+            open!.isClosed = true
+            flush()
+            current = start
+        }
+    }
+
+    /// Ends the last open contour.
+    package mutating func finish() {
+        flush()
+    }
+
+    /// Ensures there is an open contour to append a segment ending at `end`
+    /// to. Returns `false` when there is no current point, in which case the
+    /// segment starts a new contour at `end`.
+    private mutating func beginSegment(to end: CGPoint) -> Bool {
+        if open != nil {
+            return true
+        }
+        guard let current else {
+            append(.move(to: end))
+            return false
+        }
+        open = Contour(points: [current], isClosed: false)
+        return true
+    }
+
+    private mutating func flush() {
+        if let open, open.points.count > 1 || open.isClosed {
+            contours.append(open)
+        }
+        open = nil
+    }
+}
+
+// MARK: - PathWindingTester
+
+/// Answers winding-number queries against the flattened edges of a path.
+///
+/// Every contour is treated as closed, as when filling. Batched queries
+/// test eight points per SIMD lane group against each edge.
+package struct PathWindingTester {
+    private var x0: [Double] = []
+    private var y0: [Double] = []
+    private var x1: [Double] = []
+    private var y1: [Double] = []
+    private var minY = Double.infinity
+    private var maxY = -Double.infinity
+
+    package init(_ path: Path, tolerance: CGFloat = PathGeometry.defaultTolerance) {
+        self.init(contours: PathFlattener(path, tolerance: tolerance).contours)
+    }
+
+    package init(contours: [PathFlattener.Contour]) {
+        for contour in contours {
+            let points = contour.points
+            guard points.count > 1 else {
+                continue
+            }
+            for index in points.indices {
+                let p = points[index]
+                let q = points[(index + 1) % points.count]
+                guard p.y != q.y else {
+                    continue
+                }
+                x0.append(Double(p.x))
+                y0.append(Double(p.y))
+                x1.append(Double(q.x))
+                y1.append(Double(q.y))
+                minY = min(minY, Double(min(p.y, q.y)))
+                maxY = max(maxY, Double(max(p.y, q.y)))
+            }
+        }
+    }
+
+    package var isEmpty: Bool {
+        x0.isEmpty
+    }
+
+    package func winding(at point: CGPoint) -> Int {
+        let px = Double(point.x)
+        let py = Double(point.y)
+        guard py >= minY, py < maxY else {
+            return 0
+        }
+        var winding = 0
+        for index in x0.indices {
+            let ax = x0[index], ay = y0[index], bx = x1[index], by = y1[index]
+            let side = (bx - ax) * (py - ay) - (px - ax) * (by - ay)
+            if ay <= py {
+                if by > py, side > 0 {
+                    winding += 1
+                }
+            } else if by <= py, side < 0 {
+                winding -= 1
+            }
+        }
+        return winding
+    }
+
+    package func contains(_ point: CGPoint, eoFill: Bool) -> Bool {
+        let winding = winding(at: point)
+        return eoFill ? winding & 1 != 0 : winding != 0
+    }
+
+    /// Tests up to 64 points at once. Bit `i` of the result is set when
+    /// `points[i] - origin` is inside the path.
+    package func contains(points: [CGPoint], eoFill: Bool, origin: CGPoint = .zero) -> BitVector64 {
+        var result = BitVector64()
+        let count = min(points.count, 64)
+        guard count > 0, !isEmpty else {
+            return result
+        }
+        let ox = Double(origin.x)
+        let oy = Double(origin.y)
+        var start = 0
+        while start < count {
+            var px = SIMD8<Double>(repeating: .nan)
+            var py = SIMD8<Double>(repeating: .nan)
+            let laneCount = min(8, count - start)
+            for lane in 0 ..< laneCount {
+                px[lane] = Double(points[start + lane].x) - ox
+                py[lane] = Double(points[start + lane].y) - oy
+            }
+            var winding = SIMD8<Int64>(repeating: 0)
+            for index in x0.indices {
+                let ax = x0[index], ay = y0[index], bx = x1[index], by = y1[index]
+                let side = (bx - ax) * (py - ay) - (px - ax) * (by - ay)
+                let upward = (py .>= ay) .& (py .< by) .& (side .> 0)
+                let downward = (py .< ay) .& (py .>= by) .& (side .< 0)
+                winding.replace(with: winding &+ 1, where: upward)
+                winding.replace(with: winding &- 1, where: downward)
+            }
+            for lane in 0 ..< laneCount {
+                let value = winding[lane]
+                result[start + lane] = eoFill ? value & 1 != 0 : value != 0
+            }
+            start += 8
+        }
+        return result
+    }
+}
+
+// MARK: - PathStroker
+
+/// Converts a path into the outline of its stroke.
+///
+/// Each flattened contour becomes one offset outline: the offset of its
+/// left side with the joins inserted, the end cap, the offset of its right
+/// side walked backwards, then the start cap. Closed contours become two
+/// loops, one per side. The outlines are then normalized through
+/// `PathClipper`, so the stroke has no overlapping pieces and fills,
+/// trims and dashes the same with either fill rule.
+package struct PathStroker {
+    package var style: StrokeStyle
+    package var tolerance: CGFloat
+
+    package init(style: StrokeStyle, tolerance: CGFloat = PathGeometry.defaultTolerance) {
+        self.style = style
+        self.tolerance = tolerance
+    }
+
+    package func stroke(_ path: Path) -> [Path.Element] {
+        let halfWidth = abs(style.lineWidth) / 2
+        guard halfWidth > 0 else {
+            return []
+        }
+        var elements: [Path.Element] = []
+        for contour in dashed(PathFlattener(path, tolerance: tolerance).contours) {
+            stroke(contour, halfWidth: halfWidth, into: &elements)
+        }
+        guard !elements.isEmpty else {
+            return []
+        }
+        // Joins on the inner side of a turn, and contours crossing
+        // themselves or each other, overlap; merge them into one outline.
+        var outline: [Path.Element] = []
+        PathClipper(operation: .normalization, tolerance: tolerance)
+            .combine(Path(elements: elements))
+            .forEach { outline.append($0) }
+        return outline
+    }
+
+    private func stroke(_ contour: PathFlattener.Contour, halfWidth: CGFloat, into elements: inout [Path.Element]) {
+        var points: [CGPoint] = []
+        for point in contour.points where points.last.map({ distance($0, point) > 1e-9 }) ?? true {
+            points.append(point)
+        }
+        if contour.isClosed, points.count > 2, distance(points[0], points[points.count - 1]) <= 1e-9 {
+            points.removeLast()
+        }
+        guard points.count > 1 else {
+            if let point = points.first, !contour.isClosed {
+                appendDot(at: point, halfWidth: halfWidth, into: &elements)
+            }
+            return
+        }
+        let reversed = Array(points.reversed())
+        if contour.isClosed, points.count > 2 {
+            appendLoop(offsetSide(of: points, isClosed: true, halfWidth: halfWidth), into: &elements)
+            appendLoop(offsetSide(of: reversed, isClosed: true, halfWidth: halfWidth), into: &elements)
+            return
+        }
+        let first = normalize(CGPoint(x: points[1].x - points[0].x, y: points[1].y - points[0].y))
+        let p = points[points.count - 2]
+        let q = points[points.count - 1]
+        let last = normalize(CGPoint(x: q.x - p.x, y: q.y - p.y))
+        var outline = offsetSide(of: points, isClosed: false, halfWidth: halfWidth)
+        appendCap(at: points[points.count - 1], direction: last, halfWidth: halfWidth, into: &outline)
+        outline += offsetSide(of: reversed, isClosed: false, halfWidth: halfWidth)
+        appendCap(at: points[0], direction: CGPoint(x: -first.x, y: -first.y), halfWidth: halfWidth, into: &outline)
+        appendLoop(outline, into: &elements)
+    }
+
+    /// Returns the offset of the left side of a polyline, with joins at its
+    /// vertices.
+    ///
+    /// The left side of a polyline walked backwards is the right side of
+    /// the polyline, so both sides are built by this function.
+    private func offsetSide(of points: [CGPoint], isClosed: Bool, halfWidth: CGFloat) -> [CGPoint] {
+        let count = points.count
+        let segmentCount = isClosed ? count : count - 1
+        var directions: [CGPoint] = []
+        directions.reserveCapacity(segmentCount)
+        for index in 0 ..< segmentCount {
+            let p = points[index]
+            let q = points[(index + 1) % count]
+            directions.append(normalize(CGPoint(x: q.x - p.x, y: q.y - p.y)))
+        }
+        var side: [CGPoint] = []
+        side.reserveCapacity(count * 2)
+        if isClosed {
+            for index in 0 ..< count {
+                let incoming = directions[(index + count - 1) % count]
+                appendJoin(at: points[index], incoming: incoming, outgoing: directions[index], halfWidth: halfWidth, into: &side)
+            }
+        } else {
+            side.append(offset(points[0], leftNormal(directions[0], halfWidth)))
+            for index in 1 ..< count - 1 {
+                appendJoin(at: points[index], incoming: directions[index - 1], outgoing: directions[index], halfWidth: halfWidth, into: &side)
+            }
+            side.append(offset(points[count - 1], leftNormal(directions[count - 2], halfWidth)))
+        }
+        return side
+    }
+
+    /// Appends the left offsets of the segments meeting at `vertex` and the
+    /// join between them.
+    private func appendJoin(
+        at vertex: CGPoint,
+        incoming: CGPoint,
+        outgoing: CGPoint,
+        halfWidth: CGFloat,
+        into side: inout [CGPoint]
+    ) {
+        let n0 = leftNormal(incoming, halfWidth)
+        let n1 = leftNormal(outgoing, halfWidth)
+        let a = offset(vertex, n0)
+        let b = offset(vertex, n1)
+        let cross = incoming.x * outgoing.y - incoming.y * outgoing.x
+        let dot = incoming.x * outgoing.x + incoming.y * outgoing.y
+        if abs(cross) <= 1e-9, dot > 0 {
+            side.append(a)
+            return
+        }
+        guard cross <= 0 else {
+            // The inner side of the turn: pass through the vertex, which
+            // keeps the winding of the overlap positive.
+            side.append(a)
+            side.append(vertex)
+            side.append(b)
+            return
+        }
+        side.append(a)
+        switch style.lineJoin {
+        case .round:
+            appendArc(center: vertex, from: n0, sweep: -acos(min(max(dot, -1), 1)), halfWidth: halfWidth, into: &side)
+        case .miter:
+            let cosHalf = sqrt(max((1 + dot) / 2, 0))
+            if cosHalf > 1e-9, 1 / cosHalf <= style.miterLimit {
+                let bisector = normalize(CGPoint(x: n0.x + n1.x, y: n0.y + n1.y))
+                let length = halfWidth / cosHalf
+                side.append(offset(vertex, CGPoint(x: bisector.x * length, y: bisector.y * length)))
+            }
+        default:
+            break
+        }
+        side.append(b)
+    }
+
+    /// Appends the cap at the end of a side, from its left offset to the
+    /// left offset of the side walked backwards.
+    private func appendCap(
+        at point: CGPoint,
+        direction: CGPoint,
+        halfWidth: CGFloat,
+        into outline: inout [CGPoint]
+    ) {
+        let normal = leftNormal(direction, halfWidth)
+        switch style.lineCap {
+        case .round:
+            appendArc(center: point, from: normal, sweep: -.pi, halfWidth: halfWidth, into: &outline)
+        case .square:
+            let extent = CGPoint(x: direction.x * halfWidth, y: direction.y * halfWidth)
+            outline.append(CGPoint(x: point.x + normal.x + extent.x, y: point.y + normal.y + extent.y))
+            outline.append(CGPoint(x: point.x - normal.x + extent.x, y: point.y - normal.y + extent.y))
+        default:
+            break
+        }
+    }
+
+    /// Appends the inner points of an arc around `center`, starting at
+    /// `center + start` and turning by `sweep` radians.
+    private func appendArc(
+        center: CGPoint,
+        from start: CGPoint,
+        sweep: CGFloat,
+        halfWidth: CGFloat,
+        into points: inout [CGPoint]
+    ) {
+        let maximumStep = halfWidth > tolerance ? 2 * acos(1 - tolerance / halfWidth) : .pi / 2
+        let steps = max(Int((abs(sweep) / maximumStep).rounded(.up)), 1)
+        for step in 1 ..< steps {
+            let angle = sweep * CGFloat(step) / CGFloat(steps)
+            let c = cos(angle)
+            let s = sin(angle)
+            points.append(CGPoint(
+                x: center.x + start.x * c - start.y * s,
+                y: center.y + start.x * s + start.y * c
+            ))
+        }
+    }
+
+    private func appendLoop(_ points: [CGPoint], into elements: inout [Path.Element]) {
+        guard let first = points.first else {
+            return
+        }
+        elements.append(.move(to: first))
+        for point in points.dropFirst() {
+            elements.append(.line(to: point))
+        }
+        elements.append(.closeSubpath)
+    }
+
+    @inline(__always)
+    private func leftNormal(_ direction: CGPoint, _ halfWidth: CGFloat) -> CGPoint {
+        CGPoint(x: -direction.y * halfWidth, y: direction.x * halfWidth)
+    }
+
+    @inline(__always)
+    private func offset(_ point: CGPoint, _ vector: CGPoint) -> CGPoint {
+        CGPoint(x: point.x + vector.x, y: point.y + vector.y)
+    }
+
+    /// Strokes a zero-length contour, which is only visible with round or
+    /// square caps.
+    private func appendDot(at point: CGPoint, halfWidth: CGFloat, into elements: inout [Path.Element]) {
+        switch style.lineCap {
+        case .round:
+            PathGeometry.appendEllipse(in: circleRect(point, halfWidth), to: &elements)
+        case .square:
+            PathGeometry.appendRect(circleRect(point, halfWidth), to: &elements)
+        default:
+            break
+        }
+    }
+
+    // MARK: Dashes
+
+    /// Splits contours into the open polylines painted by the dash pattern.
+    private func dashed(_ contours: [PathFlattener.Contour]) -> [PathFlattener.Contour] {
+        var pattern = style.dash.map { max($0, 0) }
+        if pattern.count % 2 == 1 {
+            pattern += pattern
+        }
+        let period = pattern.reduce(0, +)
+        guard !pattern.isEmpty, period > 0, period.isFinite else {
+            return contours
+        }
+        var result: [PathFlattener.Contour] = []
+        for contour in contours {
+            var points = contour.points
+            if contour.isClosed, let first = points.first {
+                points.append(first)
+            }
+            var phase = style.dashPhase.truncatingRemainder(dividingBy: period)
+            if phase < 0 {
+                phase += period
+            }
+            var index = 0
+            // A zero-length "on" entry at the phase still paints a dot.
+            while phase > pattern[index] || (phase == pattern[index] && pattern[index] > 0) {
+                phase -= pattern[index]
+                index = (index + 1) % pattern.count
+            }
+            var remaining = pattern[index] - phase
+            var isOn = index % 2 == 0
+            var dash: [CGPoint] = isOn ? [points[0]] : []
+            for segment in 1 ..< max(points.count, 1) {
+                var p = points[segment - 1]
+                let q = points[segment]
+                var length = distance(p, q)
+                while length > remaining {
+                    let t = remaining / length
+                    let split = CGPoint(x: p.x + (q.x - p.x) * t, y: p.y + (q.y - p.y) * t)
+                    if isOn {
+                        dash.append(split)
+                        result.append(PathFlattener.Contour(points: dash, isClosed: false))
+                        dash = []
+                    } else {
+                        dash = [split]
+                    }
+                    isOn.toggle()
+                    length -= remaining
+                    p = split
+                    index = (index + 1) % pattern.count
+                    remaining = pattern[index]
+                }
+                remaining -= length
+                if isOn {
+                    dash.append(q)
+                }
+            }
+            if isOn, dash.count > 1 {
+                result.append(PathFlattener.Contour(points: dash, isClosed: false))
+            } else if !isOn, remaining <= 0, !contour.isClosed, pattern[(index + 1) % pattern.count] == 0,
+                      let last = points.last {
+                // A dot that falls exactly on the end of an open contour.
+                result.append(PathFlattener.Contour(points: [last], isClosed: false))
+            }
+        }
+        return result
+    }
+
+    private func circleRect(_ center: CGPoint, _ radius: CGFloat) -> CGRect {
+        CGRect(x: center.x - radius, y: center.y - radius, width: radius * 2, height: radius * 2)
+    }
+}
+
+// MARK: - PathTrimmer
+
+/// Extracts the part of a path between two fractions of its arc length.
+///
+/// Curves are split exactly with de Casteljau subdivision at parameters
+/// found from their flattened arc length, so trimmed curves stay curves.
+package struct PathTrimmer {
+    private enum Segment {
+        case line(CGPoint, CGPoint)
+        case quad(CGPoint, CGPoint, CGPoint)
+        case cubic(CGPoint, CGPoint, CGPoint, CGPoint)
+    }
+
+    private struct Piece {
+        var segment: Segment
+        var length: CGFloat
+        var subpath: Int
+        var isClosing: Bool
+    }
+
+    package var tolerance: CGFloat
+
+    package init(tolerance: CGFloat = PathGeometry.defaultTolerance) {
+        self.tolerance = tolerance
+    }
+
+    package func trim(_ path: Path, from: CGFloat, to: CGFloat) -> [Path.Element] {
+        let (pieces, subpathLengths) = makePieces(path)
+        let total = subpathLengths.reduce(0, +)
+        guard total > 0 else {
+            return []
+        }
+        let startLength = from * total
+        let endLength = to * total
+        var elements: [Path.Element] = []
+        var offset: CGFloat = 0
+        var subpathOffset: CGFloat = 0
+        var lastSubpath = -1
+        var isConnected = false
+        for piece in pieces {
+            if piece.subpath != lastSubpath {
+                if lastSubpath >= 0 {
+                    subpathOffset += subpathLengths[lastSubpath]
+                }
+                lastSubpath = piece.subpath
+                isConnected = false
+            }
+            let pieceStart = offset
+            let pieceEnd = offset + piece.length
+            offset = pieceEnd
+            guard pieceEnd > startLength, pieceStart < endLength else {
+                continue
+            }
+            let t0 = pieceStart >= startLength ? 0 : parameter(of: piece, atLength: startLength - pieceStart)
+            let t1 = pieceEnd <= endLength ? 1 : parameter(of: piece, atLength: endLength - pieceStart)
+            let segment = subsegment(piece.segment, from: t0, to: t1)
+            if !isConnected {
+                elements.append(.move(to: startPoint(of: segment)))
+                isConnected = true
+            }
+            let wholeSubpath = subpathOffset >= startLength && subpathOffset + subpathLengths[piece.subpath] <= endLength
+            if piece.isClosing, wholeSubpath {
+                elements.append(.closeSubpath)
+                isConnected = false
+                continue
+            }
+            switch segment {
+            case let .line(_, p1):
+                elements.append(.line(to: p1))
+            case let .quad(_, p1, p2):
+                elements.append(.quadCurve(to: p2, control: p1))
+            case let .cubic(_, p1, p2, p3):
+                elements.append(.curve(to: p3, control1: p1, control2: p2))
+            }
+        }
+        return elements
+    }
+
+    private func makePieces(_ path: Path) -> ([Piece], [CGFloat]) {
+        var pieces: [Piece] = []
+        var subpathLengths: [CGFloat] = []
+        var current: CGPoint?
+        var start: CGPoint?
+        var subpath = -1
+        var needsSubpath = true
+        func append(_ segment: Segment, isClosing: Bool = false) {
+            if needsSubpath {
+                subpath += 1
+                subpathLengths.append(0)
+                needsSubpath = false
+            }
+            let length = self.length(of: segment)
+            pieces.append(Piece(segment: segment, length: length, subpath: subpath, isClosing: isClosing))
+            subpathLengths[subpath] += length
+        }
+        path.forEach { element in
+            switch element {
+            case let .move(to: point):
+                current = point
+                start = point
+                needsSubpath = true
+            case let .line(to: point):
+                if let p0 = current {
+                    append(.line(p0, point))
+                } else {
+                    start = point
+                }
+                current = point
+            case let .quadCurve(to: end, control: control):
+                if let p0 = current {
+                    append(.quad(p0, control, end))
+                } else {
+                    start = end
+                }
+                current = end
+            case let .curve(to: end, control1: control1, control2: control2):
+                if let p0 = current {
+                    append(.cubic(p0, control1, control2, end))
+                } else {
+                    start = end
+                }
+                current = end
+            case .closeSubpath:
+                if let p0 = current, let start, !needsSubpath {
+                    append(.line(p0, start), isClosing: true)
+                }
+                current = start
+                needsSubpath = true
+            }
+        }
+        return (pieces, subpathLengths)
+    }
+
+    private func samples(of segment: Segment) -> [CGPoint] {
+        switch segment {
+        case let .line(p0, p1):
+            return [p0, p1]
+        case let .quad(p0, p1, p2):
+            let count = PathGeometry.segmentCount(degree: 2, points: [p0, p1, p2], tolerance: tolerance)
+            return (0 ... count).map { PathGeometry.evaluateQuad(p0, p1, p2, CGFloat($0) / CGFloat(count)) }
+        case let .cubic(p0, p1, p2, p3):
+            let count = PathGeometry.segmentCount(degree: 3, points: [p0, p1, p2, p3], tolerance: tolerance)
+            return (0 ... count).map { PathGeometry.evaluateCubic(p0, p1, p2, p3, CGFloat($0) / CGFloat(count)) }
+        }
+    }
+
+    private func length(of segment: Segment) -> CGFloat {
+        let points = samples(of: segment)
+        var length: CGFloat = 0
+        for index in 1 ..< points.count {
+            length += distance(points[index - 1], points[index])
+        }
+        return length
+    }
+
+    /// Returns the curve parameter at which `piece` reaches `target` arc
+    /// length, interpolating linearly between flattened samples.
+    private func parameter(of piece: Piece, atLength target: CGFloat) -> CGFloat {
+        guard piece.length > 0 else {
+            return 0
+        }
+        let points = samples(of: piece.segment)
+        let count = CGFloat(points.count - 1)
+        var length: CGFloat = 0
+        for index in 1 ..< points.count {
+            let step = distance(points[index - 1], points[index])
+            if length + step >= target {
+                let fraction = step > 0 ? (target - length) / step : 0
+                return (CGFloat(index - 1) + fraction) / count
+            }
+            length += step
+        }
+        return 1
+    }
+
+    private func subsegment(_ segment: Segment, from t0: CGFloat, to t1: CGFloat) -> Segment {
+        guard t0 > 0 || t1 < 1 else {
+            return segment
+        }
+        switch segment {
+        case let .line(p0, p1):
+            return .line(lerp(p0, p1, t0), lerp(p0, p1, t1))
+        case let .quad(p0, p1, p2):
+            // Split at t1 and keep the head, then split the head at t0 / t1.
+            let a = lerp(p0, p1, t1)
+            let b = lerp(p1, p2, t1)
+            let end = lerp(a, b, t1)
+            let s = t1 > 0 ? t0 / t1 : 0
+            let c = lerp(p0, a, s)
+            let d = lerp(a, end, s)
+            return .quad(lerp(c, d, s), d, end)
+        case let .cubic(p0, p1, p2, p3):
+            let a = lerp(p0, p1, t1)
+            let b = lerp(p1, p2, t1)
+            let c = lerp(p2, p3, t1)
+            let ab = lerp(a, b, t1)
+            let bc = lerp(b, c, t1)
+            let end = lerp(ab, bc, t1)
+            let s = t1 > 0 ? t0 / t1 : 0
+            let e = lerp(p0, a, s)
+            let f = lerp(a, ab, s)
+            let g = lerp(ab, end, s)
+            let ef = lerp(e, f, s)
+            let fg = lerp(f, g, s)
+            return .cubic(lerp(ef, fg, s), fg, g, end)
+        }
+    }
+
+    private func startPoint(of segment: Segment) -> CGPoint {
+        switch segment {
+        case let .line(p0, _), let .quad(p0, _, _), let .cubic(p0, _, _, _):
+            p0
+        }
+    }
+}
+
+// MARK: - Point helpers
+
+@inline(__always)
+private func distance(_ p: CGPoint, _ q: CGPoint) -> CGFloat {
+    let dx = q.x - p.x
+    let dy = q.y - p.y
+    return sqrt(dx * dx + dy * dy)
+}
+
+@inline(__always)
+private func normalize(_ vector: CGPoint) -> CGPoint {
+    let length = sqrt(vector.x * vector.x + vector.y * vector.y)
+    guard length > 0 else {
+        return .zero
+    }
+    return CGPoint(x: vector.x / length, y: vector.y / length)
+}
+
+@inline(__always)
+private func lerp(_ p: CGPoint, _ q: CGPoint, _ t: CGFloat) -> CGPoint {
+    CGPoint(x: p.x + (q.x - p.x) * t, y: p.y + (q.y - p.y) * t)
+}
+
+/* OpenSwiftUI Addition End */
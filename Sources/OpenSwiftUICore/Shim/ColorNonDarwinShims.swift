@@ -42,7 +42,7 @@ final package class NDColor: CFCompatObject {
 }
 
 extension Color.Resolved {
-    private static let cache: ObjectCache<Color.Resolved, NSObject> = ObjectCache { resolved in
+    private static let cache: ShardedObjectCache<Color.Resolved, NSObject> = ShardedObjectCache { resolved in
         NDColor(
             red: CGFloat(resolved.red),
             green: CGFloat(resolved.green),
@@ -0,0 +1,384 @@
+//
+//  BenchmarkWorkload.swift
+//  OpenSwiftUICore
+//
+//  Status: Complete
+
+/* OpenSwiftUI Addition Begin */
+
+public import Foundation
+
+// MARK: - _BenchmarkWorkload
+
+/// A headless workload that exercises one part of the framework, for use by
+/// an external benchmark harness.
+///
+/// Calling `prepare()` performs the setup work, such as building a view graph
+/// or a display list, and returns the closure to measure. The closure can be
+/// called repeatedly and does the same amount of work on every call.
+@available(OpenSwiftUI_v1_0, *)
+public struct _BenchmarkWorkload {
+    /// A short description of the workload, including its size.
+    public var name: String
+
+    /// The number of elements the workload operates on.
+    public var size: Int
+
+    private var makeBody: () -> () -> Void
+
+    private init(name: String, size: Int, makeBody: @escaping () -> () -> Void) {
+        self.name = name
+        self.size = size
+        self.makeBody = makeBody
+    }
+
+    /// Performs the setup work of the workload and returns the closure to
+    /// measure.
+    public func prepare() -> () -> Void {
+        makeBody()
+    }
+}
+
+// MARK: - View graph workloads
+
+#if !OPENSWIFTUI_SWIFTUI_RENDERER
+@available(OpenSwiftUI_v1_0, *)
+extension _BenchmarkWorkload {
+    /// Creates a view graph for a vertical stack of `children` views and
+    /// renders its first frame.
+    public static func viewGraphInstantiation(children: Int) -> _BenchmarkWorkload {
+        _BenchmarkWorkload(name: "View graph instantiation (\(children) children)", size: children) {
+            let data = Array(0 ..< children)
+            return {
+                let host = BenchmarkStackView.makeHost(data: data)
+                host.renderForBenchmark()
+            }
+        }
+    }
+
+    /// Lays out a vertical stack of `children` views again after the
+    /// proposed size changes.
+    public static func stackLayout(children: Int) -> _BenchmarkWorkload {
+        _BenchmarkWorkload(name: "StackLayout (\(children) children)", size: children) {
+            let host = BenchmarkStackView.makeHost(data: Array(0 ..< children))
+            host.renderForBenchmark()
+            let sizes = [host.options.surface, CGSize(width: host.options.surface.width / 2, height: host.options.surface.height)]
+            var index = 0
+            return {
+                index = 1 - index
+                host.options.surface = sizes[index]
+                host.renderForBenchmark()
+            }
+        }
+    }
+
+    /// Lays out a horizontal stack of `columns` vertical stacks of flexible
+    /// rows again after the proposed size changes.
+    ///
+    /// Stack layout measures each flexible child with several proposals, so
+    /// this workload is dominated by the size caches of the nested stacks.
+    public static func nestedStackLayout(columns: Int) -> _BenchmarkWorkload {
+        _BenchmarkWorkload(name: "Nested stack layout (\(columns) columns)", size: columns) {
+            let host = StdoutRendererHost(
+                rootView: BenchmarkNestedStackView(columns: columns),
+                environment: EnvironmentValues(),
+                options: .init()
+            )
+            host.renderForBenchmark()
+            let sizes = [host.options.surface, CGSize(width: host.options.surface.width * 0.75, height: host.options.surface.height)]
+            var index = 0
+            return {
+                index = 1 - index
+                host.options.surface = sizes[index]
+                host.renderForBenchmark()
+            }
+        }
+    }
+
+    /// Appends an element to and removes it from the data of a `ForEach` of
+    /// `count` elements, updating the view graph after each change.
+    public static func forEachUpdate(count: Int) -> _BenchmarkWorkload {
+        _BenchmarkWorkload(name: "ForEach update (\(count) elements)", size: count) {
+            let data = Array(0 ..< count)
+            let host = BenchmarkStackView.makeHost(data: data)
+            host.renderForBenchmark()
+            let appended = data + [count]
+            var isAppended = false
+            return {
+                isAppended.toggle()
+                host.rootView = BenchmarkStackView(data: isAppended ? appended : data)
+                host.renderForBenchmark()
+            }
+        }
+    }
+}
+
+private struct BenchmarkStackView: View {
+    var data: [Int]
+
+    var body: some View {
+        VStack(spacing: 0) {
+            ForEach(data, id: \.self) { _ in
+                Color.red.frame(height: 1)
+            }
+        }
+    }
+
+    static func makeHost(data: [Int]) -> StdoutRendererHost<BenchmarkStackView> {
+        StdoutRendererHost(
+            rootView: BenchmarkStackView(data: data),
+            environment: EnvironmentValues(),
+            options: .init()
+        )
+    }
+}
+
+private struct BenchmarkNestedStackView: View {
+    var columns: Int
+
+    var body: some View {
+        HStack(spacing: 1) {
+            ForEach(0 ..< columns, id: \.self) { column in
+                VStack(spacing: 0) {
+                    ForEach(0 ..< 8, id: \.self) { row in
+                        HStack(spacing: 1) {
+                            Color.red.frame(minWidth: 1, idealWidth: CGFloat(row + 1), maxWidth: 20, minHeight: 1, maxHeight: 10)
+                            Color.blue.frame(minWidth: 2, maxWidth: CGFloat(column % 4 + 1) * 10, minHeight: 1, maxHeight: 5)
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+extension StdoutRendererHost {
+    /// Updates the view graph and its display list without writing the
+    /// display list to standard output.
+    fileprivate func renderForBenchmark() {
+        render(updateDisplayList: false, targetTimestamp: nil)
+        withExtendedLifetime(viewGraph.rootDisplayList) {}
+    }
+}
+#endif
+
+// MARK: - PropertyList workloads
+
+@available(OpenSwiftUI_v1_0, *)
+extension _BenchmarkWorkload {
+    /// Looks up the innermost value of a property list with `depth` values.
+    public static func propertyListLookup(depth: Int) -> _BenchmarkWorkload {
+        _BenchmarkWorkload(name: "PropertyList lookup (depth \(depth))", size: depth) {
+            var plist = PropertyList()
+            plist.prependValue(1, for: BenchmarkTargetKey.self)
+            for value in 1 ..< max(depth, 1) {
+                plist.prependValue(value, for: BenchmarkFillerKey.self)
+            }
+            return {
+                withExtendedLifetime(plist[BenchmarkTargetKey.self]) {}
+            }
+        }
+    }
+
+    /// Reads eight keys and a missing key from an environment-like property
+    /// list of `depth` values, where the keys are overridden at every level.
+    public static func environmentLookup(depth: Int) -> _BenchmarkWorkload {
+        _BenchmarkWorkload(name: "Environment lookup (depth \(depth))", size: depth) {
+            var plist = PropertyList()
+            for value in 0 ..< max(depth, 1) {
+                switch value % 8 {
+                case 0: plist.prependValue(value, for: BenchmarkKey<Int8>.self)
+                case 1: plist.prependValue(value, for: BenchmarkKey<Int16>.self)
+                case 2: plist.prependValue(value, for: BenchmarkKey<Int32>.self)
+                case 3: plist.prependValue(value, for: BenchmarkKey<Int64>.self)
+                case 4: plist.prependValue(value, for: BenchmarkKey<UInt8>.self)
+                case 5: plist.prependValue(value, for: BenchmarkKey<UInt16>.self)
+                case 6: plist.prependValue(value, for: BenchmarkKey<UInt32>.self)
+                default: plist.prependValue(value, for: BenchmarkFillerKey.self)
+                }
+            }
+            return {
+                var sum = plist[BenchmarkKey<Int8>.self]
+                sum &+= plist[BenchmarkKey<Int16>.self]
+                sum &+= plist[BenchmarkKey<Int32>.self]
+                sum &+= plist[BenchmarkKey<Int64>.self]
+                sum &+= plist[BenchmarkKey<UInt8>.self]
+                sum &+= plist[BenchmarkKey<UInt16>.self]
+                sum &+= plist[BenchmarkKey<UInt32>.self]
+                sum &+= plist[BenchmarkFillerKey.self]
+                sum &+= plist[BenchmarkTargetKey.self]
+                withExtendedLifetime(sum) {}
+            }
+        }
+    }
+}
+
+private struct BenchmarkTargetKey: PropertyKey {
+    static let defaultValue = 0
+}
+
+private struct BenchmarkFillerKey: PropertyKey {
+    static let defaultValue = 0
+}
+
+private struct BenchmarkKey<Tag>: PropertyKey {
+    static var defaultValue: Int { 0 }
+}
+
+// MARK: - DisplayList workloads
+
+@available(OpenSwiftUI_v1_0, *)
+extension _BenchmarkWorkload {
+    /// Encodes a display list of `items` items to protobuf data.
+    public static func displayListEncoding(items: Int) -> _BenchmarkWorkload {
+        _BenchmarkWorkload(name: "DisplayList encoding (\(items) items)", size: items) {
+            let list = benchmarkDisplayList(items: items)
+            return {
+                withExtendedLifetime(try? ProtobufEncoder.encoding(list)) {}
+            }
+        }
+    }
+
+    /// Decodes a display list of `items` items from protobuf data.
+    public static func displayListDecoding(items: Int) -> _BenchmarkWorkload {
+        _BenchmarkWorkload(name: "DisplayList decoding (\(items) items)", size: items) {
+            let data = (try? ProtobufEncoder.encoding(benchmarkDisplayList(items: items))) ?? Data()
+            return {
+                var decoder = ProtobufDecoder(data)
+                withExtendedLifetime(try? DisplayList(from: &decoder)) {}
+            }
+        }
+    }
+
+    /// Canonicalizes the items of a display list of `items` items, each
+    /// wrapping its content in an effect that canonicalization removes.
+    public static func displayListCanonicalization(items: Int) -> _BenchmarkWorkload {
+        _BenchmarkWorkload(name: "DisplayList canonicalization (\(items) items)", size: items) {
+            let list = benchmarkDisplayList(items: items)
+            let wrapped = list.items.map { item in
+                var child = item
+                child.frame.origin = .zero
+                return DisplayList.Item(
+                    .effect(.opacity(1), DisplayList(child)),
+                    frame: item.frame,
+                    identity: .none,
+                    version: item.version
+                )
+            }
+            return {
+                var items = wrapped
+                for index in items.indices {
+                    items[index].canonicalize()
+                }
+                withExtendedLifetime(items) {}
+            }
+        }
+    }
+
+    /// Canonicalizes a flat display list of `items` items, each wrapping its
+    /// content in an effect that canonicalization removes, and indexes its
+    /// identities.
+    ///
+    /// The items are grouped into effects of 64 items, so that large lists
+    /// have independent subtrees that can be processed concurrently.
+    public static func flatDisplayListCanonicalization(items: Int, parallel: Bool) -> _BenchmarkWorkload {
+        let mode = parallel ? "parallel" : "serial"
+        return _BenchmarkWorkload(name: "Flat DisplayList canonicalization (\(items) items, \(mode))", size: items) {
+            let list = benchmarkDisplayList(items: items)
+            var groups: [DisplayList.Item] = []
+            for start in stride(from: 0, to: list.items.count, by: 64) {
+                let wrapped = list.items[start ..< min(start + 64, list.items.count)].map { item in
+                    DisplayList.Item(
+                        .effect(.opacity(1), DisplayList(item)),
+                        frame: .zero,
+                        identity: .none,
+                        version: item.version
+                    )
+                }
+                groups.append(DisplayList.Item(
+                    .effect(.transform(.affine(.identity)), DisplayList(wrapped)),
+                    frame: .zero,
+                    identity: .init(),
+                    version: list.items[start].version
+                ))
+            }
+            var flatList = FlatDisplayList()
+            let source = DisplayList(groups)
+            return {
+                flatList.assign(source)
+                flatList.canonicalize(parallel: parallel)
+                withExtendedLifetime(flatList.identityIndex(parallel: parallel)) {}
+            }
+        }
+    }
+}
+
+// MARK: - Protobuf workloads
+
+@available(OpenSwiftUI_v1_0, *)
+extension _BenchmarkWorkload {
+    /// Encodes a path of `elements` curves to protobuf data and decodes it
+    /// again, exercising the packed repeated fields.
+    public static func pathArchiving(elements: Int) -> _BenchmarkWorkload {
+        _BenchmarkWorkload(name: "Path archiving (\(elements) elements)", size: elements) {
+            var path = Path()
+            path.move(to: .zero)
+            for index in 0 ..< elements {
+                let x = CGFloat(index)
+                path.addCurve(
+                    to: CGPoint(x: x + 1, y: x.truncatingRemainder(dividingBy: 7)),
+                    control1: CGPoint(x: x + 0.25, y: 3),
+                    control2: CGPoint(x: x + 0.75, y: -3)
+                )
+            }
+            return {
+                guard let data = try? ProtobufEncoder.encoding(path) else { return }
+                var decoder = ProtobufDecoder(data)
+                withExtendedLifetime(try? Path(from: &decoder)) {}
+            }
+        }
+    }
+
+    /// Encodes a display list of `items` items grouped into nested effects,
+    /// so that most messages need a length of more than one byte.
+    public static func nestedDisplayListEncoding(items: Int) -> _BenchmarkWorkload {
+        _BenchmarkWorkload(name: "Nested DisplayList encoding (\(items) items)", size: items) {
+            var list = benchmarkDisplayList(items: items)
+            for _ in 0 ..< 4 {
+                var groups: [DisplayList.Item] = []
+                for start in stride(from: 0, to: list.items.count, by: 8) {
+                    let group = Array(list.items[start ..< min(start + 8, list.items.count)])
+                    groups.append(DisplayList.Item(
+                        .effect(.opacity(0.5), DisplayList(group)),
+                        frame: .zero,
+                        identity: .init(),
+                        version: group[0].version
+                    ))
+                }
+                list = DisplayList(groups)
+            }
+            return {
+                withExtendedLifetime(try? ProtobufEncoder.encoding(list)) {}
+            }
+        }
+    }
+}
+
+private func benchmarkDisplayList(items count: Int) -> DisplayList {
+    let version = DisplayList.Version(forUpdate: ())
+    return DisplayList((0 ..< count).map { index in
+        var item = DisplayList.Item(
+            .content(DisplayList.Content(
+                .color(Color.Resolved(red: 1, green: 0, blue: 0, opacity: 1)),
+                seed: DisplayList.Seed(version)
+            )),
+            frame: CGRect(x: 0, y: CGFloat(index), width: 100, height: 1),
+            identity: .init(),
+            version: version
+        )
+        item.canonicalize()
+        return item
+    })
+}
+
+/* OpenSwiftUI Addition End */
@@ -109,6 +109,11 @@ package struct CustomEventTrace {
 
     @inline(__always)
     package static func trace<Value>(_ category: CustomEventCategory, _ eventType: Int8, value: Value) {
+        /* OpenSwiftUI Addition Begin */
+        if SignpostTrace.isRecording {
+            recordSignpostTrace(category, eventType, value: value)
+        }
+        /* OpenSwiftUI Addition End */
         guard enabledCategories[Int(category.rawValue)], let recorder else {
             return
         }
@@ -301,4 +306,71 @@ package struct CustomEventTrace {
             value: values
         )
     }
+
+    /* OpenSwiftUI Addition Begin */
+
+    // MARK: - SignpostTrace
+
+    /// Mirrors transaction and animation events into the in-process trace
+    /// recorder. Transactions are recorded as async intervals keyed by their
+    /// ID; other events are recorded as instants.
+    private static func recordSignpostTrace<Value>(_ category: CustomEventCategory, _ eventType: Int8, value: Value) {
+        switch category {
+        case .transaction:
+            guard let type = TransactionEventType(rawValue: eventType) else {
+                return
+            }
+            let id = (value as? UInt32).map(UInt64.init) ?? 0
+            switch type {
+            case .begin:
+                SignpostTrace.record(.asyncBegin, category: "Transaction", name: "Transaction", id: id)
+            case .end:
+                SignpostTrace.record(.asyncEnd, category: "Transaction", name: "Transaction", id: id)
+            case .append:
+                SignpostTrace.record(.instant, category: "Transaction", name: "TransactionAppend", id: id)
+            case .enqueue:
+                SignpostTrace.record(.instant, category: "Transaction", name: "TransactionEnqueue", id: id)
+            case .continueAsNewTransaction:
+                SignpostTrace.record(.instant, category: "Transaction", name: "TransactionContinueAsNew", id: id)
+            case .continueAsContinuation:
+                SignpostTrace.record(
+                    .instant,
+                    category: "Transaction",
+                    name: "TransactionContinueAsContinuation",
+                    id: SignpostTrace.id(for: value as AnyObject)
+                )
+            }
+        case .animation:
+            guard let type = AnimationEventType(rawValue: eventType) else {
+                return
+            }
+            let id = UInt64(signpostTraceAttribute(value)?.rawValue ?? 0)
+            let name: StaticString = switch type {
+            case .animationBegin: "AnimationBegin"
+            case .animationEnd: "AnimationEnd"
+            case .animationAttrUpdate: "AnimationAttrUpdate"
+            case .animationScheduleTick: "AnimationScheduleTick"
+            case .animationTick: "AnimationTick"
+            case .animationRetarget: "AnimationRetarget"
+            }
+            SignpostTrace.record(.instant, category: "Animation", name: name, id: id)
+        default:
+            break
+        }
+    }
+
+    private static func signpostTraceAttribute<Value>(_ value: Value) -> AnyAttribute? {
+        if let attribute = value as? AnyAttribute {
+            return attribute
+        }
+        if let values = value as? (AnyAttribute?, Any.Type, Double, Double, Double, Double) {
+            return values.0
+        }
+        if let values = value as? (AnyAttribute?, Double) {
+            return values.0
+        }
+        return nil
+    }
+
+    /* OpenSwiftUI Addition End */
 }
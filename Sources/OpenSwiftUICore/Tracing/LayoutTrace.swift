@@ -27,11 +27,82 @@ package struct LayoutTrace {
 
     package static var recorder: LayoutTrace.Recorder?
 
+    /* OpenSwiftUI Addition Begin */
+    /// The path the layout trace is written to when the process exits.
+    ///
+    /// When `OPENSWIFTUI_LAYOUT_TRACE_FILE` is set, the shared graph registers
+    /// a recorder and its folded stacks are written to that path, ready for
+    /// `flamegraph.pl` or speedscope. A summary of the most frequently
+    /// measured attributes is written next to it with a `.txt` extension.
+    package static let environmentPath: String? = {
+        guard let path = ProcessInfo.processInfo.environment["OPENSWIFTUI_LAYOUT_TRACE_FILE"],
+              !path.isEmpty else {
+            return nil
+        }
+        atexit {
+            LayoutTrace.writeEnvironmentTrace()
+        }
+        return path
+    }()
+
+    private static func writeEnvironmentTrace() {
+        guard let environmentPath, let recorder else {
+            return
+        }
+        do {
+            try Data(recorder.foldedStacks().utf8).write(to: URL(fileURLWithPath: environmentPath))
+            try Data(recorder.report().utf8).write(to: URL(fileURLWithPath: environmentPath + ".txt"))
+        } catch {
+            Log.internalError("Failed to write layout trace to \(environmentPath): \(error)")
+        }
+    }
+    /* OpenSwiftUI Addition End */
+
     final package class Recorder {
         package var graph: Graph
         package var frameActive: Bool
         package var cacheLookup: (proposal: _ProposedSize, hit: Bool)?
 
+        /* OpenSwiftUI Addition Begin */
+        /// The number of traced layout queries.
+        package private(set) var queryCount: Int = 0
+
+        /// The number of frames that contained at least one layout query.
+        package private(set) var frameCount: Int = 0
+
+        /// The number of size cache lookups that found a size,
+        /// including lookups outside of traced queries.
+        package var cacheHits: Int = 0
+
+        /// The number of size cache lookups that computed a size.
+        package var cacheMisses: Int = 0
+
+        /// The number of times a `ViewSizeCache` grew to hold more sizes.
+        package var cacheResizes: Int = 0
+
+        private(set) var descriptions: [UInt32: String] = [:]
+
+        /// The traced queries of each attribute, aggregated as they end so
+        /// that long traces use memory in proportion to the number of
+        /// attributes rather than the number of queries.
+        private var summaries: [UInt32: AttributeSummary] = [:]
+
+        /// The frame an attribute was last measured in, and how many times.
+        private var frameCalls: [UInt32: (frame: Int, count: Int)] = [:]
+
+        /// The seconds spent in the innermost query of each distinct call
+        /// path, in the order the paths were first seen.
+        private var stackDurations: [[StackFrame]: Double] = [:]
+
+        private var stackOrder: [[StackFrame]] = []
+
+        /// The call path of the queries in progress, innermost last.
+        private var path: [StackFrame] = []
+
+        /// The time spent in the nested queries of each query in progress.
+        private var nestedDurations: [Double] = []
+        /* OpenSwiftUI Addition End */
+
         init(graph: Graph) {
             self.graph = graph
             self.frameActive = false
@@ -40,29 +111,225 @@ package struct LayoutTrace {
 
         func activateFrameIfNeeded() {
             guard !frameActive else { return }
-            // TODO
+            /* OpenSwiftUI Addition Begin */
+            frameActive = true
+            frameCount += 1
+            // Queries belong to the same frame until the current update
+            // dispatches its actions.
+            Update.enqueueAction { [weak self] in
+                self?.frameActive = false
+            }
+            /* OpenSwiftUI Addition End */
         }
 
         func traceSizeThatFits(_ attribute: AnyAttribute?, proposal: _ProposedSize, _ block: () -> CGSize) -> CGSize {
-            _openSwiftUIUnimplementedFailure()
+            /* OpenSwiftUI Addition Begin */
+            trace(attribute, .sizeThatFits, block)
+            /* OpenSwiftUI Addition End */
         }
 
         func traceLengthThatFits(_ attribute: AnyAttribute?, proposal: _ProposedSize, in axis: Axis, _ block: () -> CGFloat) -> CGFloat {
-            _openSwiftUIUnimplementedFailure()
+            /* OpenSwiftUI Addition Begin */
+            trace(attribute, .lengthThatFits(axis), block)
+            /* OpenSwiftUI Addition End */
         }
 
         func traceChildGeometries(_ attribute: AnyAttribute?, at parentSize: ViewSize, origin: CGPoint, _ block: () -> [ViewGeometry]) -> [ViewGeometry] {
             activateFrameIfNeeded()
             CoreGlue.shared.startChildGeometries(.init(recorder: self, parentSize: parentSize, origin: origin, attributeID: attribute?.rawValue ?? .zero))
-            let geometries = block()
+            /* OpenSwiftUI Addition Begin */
+            let geometries = trace(attribute, .childGeometries, block)
+            /* OpenSwiftUI Addition End */
             CoreGlue.shared.endChildGeometries(.init(recorder: self, geometries: geometries))
             return geometries
         }
 
         func traceContentDescription(_ attribute: AnyAttribute?, _ description: String) {
-            _openSwiftUIUnimplementedFailure()
+            /* OpenSwiftUI Addition Begin */
+            descriptions[attribute?.rawValue ?? .zero] = description
+            /* OpenSwiftUI Addition End */
+        }
+
+        /* OpenSwiftUI Addition Begin */
+        private func trace<Result>(
+            _ attribute: AnyAttribute?,
+            _ operation: Operation,
+            _ block: () -> Result
+        ) -> Result {
+            activateFrameIfNeeded()
+            let attribute = attribute?.rawValue ?? .zero
+            queryCount += 1
+            // A cache lookup belongs to the innermost query, and happens
+            // before any of its nested queries.
+            let outerCacheLookup = cacheLookup
+            cacheLookup = nil
+            path.append(StackFrame(attribute: attribute, operation: operation))
+            nestedDurations.append(0)
+            let start = Time.systemUptime
+            let result = block()
+            let duration = (Time.systemUptime - start).seconds
+            let selfDuration = max(duration - nestedDurations.removeLast(), 0)
+            record(
+                attribute,
+                operation,
+                duration: duration,
+                selfDuration: selfDuration,
+                cacheHit: operation == .childGeometries ? nil : cacheLookup?.hit
+            )
+            path.removeLast()
+            cacheLookup = outerCacheLookup
+            if !nestedDurations.isEmpty {
+                nestedDurations[nestedDurations.count - 1] += duration
+            }
+            return result
+        }
+
+        private func record(
+            _ attribute: UInt32,
+            _ operation: Operation,
+            duration: Double,
+            selfDuration: Double,
+            cacheHit: Bool?
+        ) {
+            var summary = summaries[attribute] ?? AttributeSummary(attribute: attribute)
+            summary.totalDuration += duration
+            summary.selfDuration += selfDuration
+            switch cacheHit {
+            case true?: summary.cacheHits += 1
+            case false?: summary.cacheMisses += 1
+            case nil: break
+            }
+            if operation == .childGeometries {
+                summary.placements += 1
+            } else {
+                summary.measurements += 1
+                var calls = frameCalls[attribute] ?? (frameCount, 0)
+                if calls.frame != frameCount {
+                    calls = (frameCount, 0)
+                }
+                calls.count += 1
+                frameCalls[attribute] = calls
+                summary.maxMeasurementsPerFrame = max(summary.maxMeasurementsPerFrame, calls.count)
+            }
+            summaries[attribute] = summary
+            if stackDurations[path] == nil {
+                stackOrder.append(path)
+            }
+            stackDurations[path, default: 0] += selfDuration
+        }
+
+        /// Discards every recorded query.
+        package func reset() {
+            queryCount = 0
+            frameCount = 0
+            cacheHits = 0
+            cacheMisses = 0
+            cacheResizes = 0
+            summaries.removeAll()
+            frameCalls.removeAll()
+            stackDurations.removeAll()
+            stackOrder.removeAll()
+        }
+
+        /// Returns the description of the layout engine of `attribute`.
+        package func description(of attribute: UInt32) -> String {
+            descriptions[attribute].map { "\($0) #\(attribute)" } ?? "#\(attribute)"
+        }
+
+        /// Returns a summary of the traced queries of every attribute, sorted
+        /// by the number of times the attribute was measured in a single
+        /// frame, then by the time spent in its own queries.
+        package func attributeSummaries() -> [AttributeSummary] {
+            summaries.values.sorted {
+                ($0.maxMeasurementsPerFrame, $0.selfDuration, $1.attribute)
+                    > ($1.maxMeasurementsPerFrame, $1.selfDuration, $0.attribute)
+            }
+        }
+
+        /// Returns the traced queries as folded stacks, one line per distinct
+        /// call path with the microseconds spent in its innermost query.
+        ///
+        /// The format is the input of `flamegraph.pl` and speedscope.
+        package func foldedStacks() -> String {
+            stackOrder.map { path in
+                let names = path.map { frame in
+                    "\(description(of: frame.attribute)).\(frame.operation)"
+                        .replacingOccurrences(of: ";", with: ",")
+                }
+                let weight = Int((stackDurations[path]! * 1_000_000).rounded())
+                return "\(names.joined(separator: ";")) \(weight)\n"
+            }.joined()
+        }
+
+        /// Returns a human-readable report of the attributes that were
+        /// measured the most times in a single frame.
+        package func report(limit: Int = 50) -> String {
+            var lines = ["Layout trace: \(queryCount) queries in \(frameCount) frames"]
+            lines.append("Size cache: \(cacheHits) hits, \(cacheMisses) misses, \(cacheResizes) resizes")
+            lines.append("max/frame  measure  place    hit   miss  self ms  total ms  attribute")
+            for summary in attributeSummaries().prefix(limit) {
+                let columns = [
+                    String(summary.maxMeasurementsPerFrame).padding(toLength: 9, withPad: " ", startingAt: 0),
+                    String(summary.measurements).padding(toLength: 7, withPad: " ", startingAt: 0),
+                    String(summary.placements).padding(toLength: 5, withPad: " ", startingAt: 0),
+                    String(summary.cacheHits).padding(toLength: 5, withPad: " ", startingAt: 0),
+                    String(summary.cacheMisses).padding(toLength: 5, withPad: " ", startingAt: 0),
+                    String(format: "%7.3f", summary.selfDuration * 1000),
+                    String(format: "%8.3f", summary.totalDuration * 1000),
+                    description(of: summary.attribute),
+                ]
+                lines.append(columns.joined(separator: "  "))
+            }
+            return lines.joined(separator: "\n") + "\n"
+        }
+        /* OpenSwiftUI Addition End */
+    }
+
+    /* OpenSwiftUI Addition Begin */
+    // MARK: - LayoutTrace.Operation
+
+    /// The kind of a traced layout query.
+    package enum Operation: Hashable, CustomStringConvertible {
+        case sizeThatFits
+        case lengthThatFits(Axis)
+        case childGeometries
+
+        package var description: String {
+            switch self {
+            case .sizeThatFits: "sizeThatFits"
+            case .lengthThatFits(.horizontal): "lengthThatFits(horizontal)"
+            case .lengthThatFits(.vertical): "lengthThatFits(vertical)"
+            case .childGeometries: "childGeometries"
+            }
+        }
+    }
+
+    /// A query on the call path of another, as a folded stack frame.
+    struct StackFrame: Hashable {
+        var attribute: UInt32
+
+        var operation: Operation
+    }
+
+    // MARK: - LayoutTrace.AttributeSummary
+
+    /// The traced queries of a single attribute.
+    package struct AttributeSummary {
+        package var attribute: UInt32
+        package var measurements: Int = 0
+        package var placements: Int = 0
+        package var cacheHits: Int = 0
+        package var cacheMisses: Int = 0
+        package var maxMeasurementsPerFrame: Int = 0
+        package var totalDuration: Double = 0
+        package var selfDuration: Double = 0
+
+        package var cacheHitRate: Double {
+            let lookups = cacheHits + cacheMisses
+            return lookups == 0 ? 0 : Double(cacheHits) / Double(lookups)
         }
     }
+    /* OpenSwiftUI Addition End */
 }
 
 extension LayoutTrace {
@@ -82,6 +349,13 @@ extension LayoutTrace {
             return
         }
         recorder.cacheLookup = (proposal, hit)
+        /* OpenSwiftUI Addition Begin */
+        if hit {
+            recorder.cacheHits += 1
+        } else {
+            recorder.cacheMisses += 1
+        }
+        /* OpenSwiftUI Addition End */
     }
 
     @inline(__always)
@@ -90,7 +364,24 @@ extension LayoutTrace {
             return
         }
         recorder.cacheLookup = (.init(proposal), hit)
+        /* OpenSwiftUI Addition Begin */
+        if hit {
+            recorder.cacheHits += 1
+        } else {
+            recorder.cacheMisses += 1
+        }
+        /* OpenSwiftUI Addition End */
+    }
+
+    /* OpenSwiftUI Addition Begin */
+    @inline(__always)
+    package static func traceCacheResize(_ capacity: Int) {
+        guard let recorder else {
+            return
+        }
+        recorder.cacheResizes += 1
     }
+    /* OpenSwiftUI Addition End */
 
     @inline(__always)
     package static func traceChildGeometries(_ attribute: AnyAttribute?, at parentSize: ViewSize, origin: CGPoint, _ block: () -> [ViewGeometry]) -> [ViewGeometry] {
@@ -553,6 +553,141 @@ package struct Cache3<Key, Value> where Key: Equatable {
     }
 }
 
+/* OpenSwiftUI Addition Begin */
+
+// MARK: - AdaptiveCache
+
+/// A cache that behaves like `Cache3` until it keeps evicting values, and
+/// then grows into an open-addressed hash table.
+///
+/// Most callers only ever see one to three distinct keys, and pay nothing
+/// more than a `Cache3` for them. When a caller cycles through more keys
+/// than fit, every lookup misses; after `promotionThreshold` evictions the
+/// cache moves its entries into a table of `initialTableCapacity` slots,
+/// which doubles as it fills up to `maxTableCapacity` slots. A full table of
+/// the maximum capacity is emptied rather than grown further.
+package struct AdaptiveCache<Key, Value> where Key: Hashable {
+    private var recent = Cache3<Key, Value>()
+
+    /// The slots of the hash table, or an empty array while the cache
+    /// behaves like `Cache3`.
+    private var slots: ContiguousArray<(key: Key, value: Value)?> = []
+
+    private var count = 0
+
+    private var evictions = 0
+
+    package static var promotionThreshold: Int { 3 }
+
+    package static var initialTableCapacity: Int { 8 }
+
+    package static var maxTableCapacity: Int { 32 }
+
+    /// Creates a new empty cache.
+    package init() {}
+
+    /// The number of values the cache can hold before it evicts or grows.
+    package var capacity: Int {
+        slots.isEmpty ? 3 : slots.count * 3 / 4
+    }
+
+    /// Looks up a value in the cache by key.
+    ///
+    /// - Parameter key: The key to look up.
+    /// - Returns: The value associated with the key, or `nil` if the key is not in the cache.
+    @inline(__always)
+    package func find(_ key: Key) -> Value? {
+        guard !slots.isEmpty else {
+            return recent.find(key)
+        }
+        let mask = slots.count - 1
+        var index = key.hashValue & mask
+        while let slot = slots[index] {
+            if slot.key == key {
+                return slot.value
+            }
+            index = (index + 1) & mask
+        }
+        return nil
+    }
+
+    /// Inserts a value into the cache, evicting or growing as needed.
+    ///
+    /// - Parameters:
+    ///   - key: The key to associate with the value. The key must not be in the cache.
+    ///   - value: The value to cache.
+    package mutating func put(_ key: Key, value: Value) {
+        guard slots.isEmpty else {
+            if (count + 1) * 4 > slots.count * 3 {
+                if slots.count < Self.maxTableCapacity {
+                    resize(to: slots.count * 2)
+                } else {
+                    slots = ContiguousArray(repeating: nil, count: slots.count)
+                    count = 0
+                }
+            }
+            insert(key, value: value)
+            return
+        }
+        if recent.store.2 != nil {
+            evictions += 1
+            if evictions >= Self.promotionThreshold {
+                slots = ContiguousArray(repeating: nil, count: Self.initialTableCapacity)
+                for item in [recent.store.2, recent.store.1, recent.store.0] {
+                    if let item {
+                        insert(item.key, value: item.value)
+                    }
+                }
+                recent = Cache3()
+                insert(key, value: value)
+                return
+            }
+        }
+        recent.put(key, value: value)
+    }
+
+    /// Retrieves a value from the cache by key, creating it if not present.
+    ///
+    /// - Parameters:
+    ///   - key: The key to look up.
+    ///   - makeValue: A closure that creates a new value if the key is not found.
+    /// - Returns: The value associated with the key, either retrieved from cache or newly created.
+    @inline(__always)
+    package mutating func get(_ key: Key, makeValue: () -> Value) -> Value {
+        guard let value = find(key) else {
+            let value = makeValue()
+            put(key, value: value)
+            return value
+        }
+        return value
+    }
+
+    private mutating func insert(_ key: Key, value: Value) {
+        let mask = slots.count - 1
+        var index = key.hashValue & mask
+        while let slot = slots[index] {
+            if slot.key == key {
+                slots[index] = (key, value)
+                return
+            }
+            index = (index + 1) & mask
+        }
+        slots[index] = (key, value)
+        count += 1
+    }
+
+    private mutating func resize(to capacity: Int) {
+        let oldSlots = slots
+        slots = ContiguousArray(repeating: nil, count: capacity)
+        count = 0
+        for case let (key, value)? in oldSlots {
+            insert(key, value: value)
+        }
+    }
+}
+
+/* OpenSwiftUI Addition End */
+
 // MARK: - Dictionary Extensions [6.5.4]
 
 extension Dictionary {
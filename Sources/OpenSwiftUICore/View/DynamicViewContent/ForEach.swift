@@ -118,6 +118,10 @@ public struct ForEach<Data, ID, Content> where Data: RandomAccessCollection, ID:
 
     var obsoleteContentID: Int
 
+    /* OpenSwiftUI Addition Begin */
+    package var changes: ForEachChanges? = nil
+    /* OpenSwiftUI Addition End */
+
     package init(
         _ data: Data,
         idGenerator: IDGenerator,
@@ -142,6 +146,9 @@ public struct ForEach<Data, ID, Content> where Data: RandomAccessCollection, ID:
             transform(other.content(element))
         }
         self.obsoleteContentID = other.obsoleteContentID
+        /* OpenSwiftUI Addition Begin */
+        self.changes = other.changes
+        /* OpenSwiftUI Addition End */
     }
 }
 
@@ -328,6 +335,11 @@ private class ForEachState<Data, ID, Content> where Data: RandomAccessCollection
     var pendingEviction: Bool = false
     var evictedIDs: Set<ID> = .init()
     var matchingStrategyCache: [ObjectIdentifier: IDTypeMatchingStrategy] = [:]
+    /* OpenSwiftUI Addition Begin */
+    var baseSeed: UInt32 = 0
+    var offsetChanges: [(seed: UInt32, changes: ForEachChanges)] = []
+    var lastChanges: (changes: ForEachChanges, insertedIDs: [ID])? = nil
+    /* OpenSwiftUI Addition End */
 
     init(inputs: _ViewListInputs) {
         self.inputs = inputs
@@ -354,6 +366,9 @@ private class ForEachState<Data, ID, Content> where Data: RandomAccessCollection
             let oldData = self.view!.data
             self.view = view
             self.view!.data = oldData
+            /* OpenSwiftUI Addition Begin */
+            resetItemGeneration()
+            /* OpenSwiftUI Addition End */
             for (_, item) in items {
                 item.contentID = contentID
                 if item.seed == oldSeed {
@@ -361,14 +376,26 @@ private class ForEachState<Data, ID, Content> where Data: RandomAccessCollection
                 }
             }
         } else {
+            /* OpenSwiftUI Addition Begin */
+            let oldData = self.view?.data
+            /* OpenSwiftUI Addition End */
             self.view = view
             edits.removeAll()
             lastTransaction = TransactionID(graph: list!.graph)
             guard firstInsertionOffset >= 0 else {
+                /* OpenSwiftUI Addition Begin */
+                resetItemGeneration()
+                /* OpenSwiftUI Addition End */
                 firstInsertionOffset = .max
                 createdAllItems = false
                 return
             }
+            /* OpenSwiftUI Addition Begin */
+            if let oldData, updateIncrementally(from: oldData) {
+                return
+            }
+            resetItemGeneration()
+            /* OpenSwiftUI Addition End */
             var index = view.data.startIndex
             let endIndex = view.data.endIndex
             let itemsCount = items.count
@@ -632,6 +659,232 @@ private class ForEachState<Data, ID, Content> where Data: RandomAccessCollection
         self.pendingEviction = pendingEviction
     }
 
+    /* OpenSwiftUI Addition Begin */
+
+    // MARK: - ForEachState + Incremental update
+
+    /// The number of incremental updates whose offset changes may be pending
+    /// before the next update walks the whole collection again.
+    static var maxPendingOffsetChanges: Int { 16 }
+
+    /// Starts a new generation of items: only items touched from now on are
+    /// current.
+    func resetItemGeneration() {
+        baseSeed = seed
+        offsetChanges.removeAll(keepingCapacity: true)
+    }
+
+    /// Whether the item was found by the last full update or touched since.
+    ///
+    /// Incremental updates don't touch the items they leave in place, so an
+    /// item is current as long as its seed isn't older than `baseSeed`.
+    func isCurrent(_ item: Item) -> Bool {
+        seed &- item.seed <= seed &- baseSeed
+    }
+
+    /// Returns the current item for `id`, with its index and offset brought up
+    /// to date with the incremental updates applied since it was last touched.
+    func currentItem(for id: ID) -> Item? {
+        guard let item = items[id], resolve(item) else {
+            return nil
+        }
+        return item
+    }
+
+    private func resolve(_ item: Item) -> Bool {
+        guard item.seed != seed else {
+            return isCurrent(item)
+        }
+        guard let offset = pendingOffset(of: item) else {
+            return false
+        }
+        let data = view!.data
+        item.index = data.index(data.startIndex, offsetBy: offset)
+        item.offset = offset
+        item.seed = seed
+        return true
+    }
+
+    /// Returns the offset of a current item after the incremental updates
+    /// applied since it was last touched, without touching it.
+    private func pendingOffset(of item: Item) -> Int? {
+        guard isCurrent(item) else {
+            return nil
+        }
+        let age = seed &- item.seed
+        var offset = item.offset
+        for (changesSeed, changes) in offsetChanges where seed &- changesSeed < age {
+            guard let newOffset = changes.offset(movingFrom: offset) else {
+                return nil
+            }
+            offset = newOffset
+        }
+        return offset
+    }
+
+    /// Updates the items for the new data without computing the ID of every
+    /// element, either from the changes supplied with the view or because the
+    /// new data only appends to the previous one.
+    ///
+    /// - Returns: `false` if the update needs to walk the whole collection.
+    func updateIncrementally(from oldData: Data) -> Bool {
+        guard !view!.idGenerator.isConstant,
+              offsetChanges.count < Self.maxPendingOffsetChanges else {
+            return false
+        }
+        if let changes = view!.changes {
+            let newData = view!.data
+            guard changes.insertions.last.map({ $0 < newData.count }) ?? true else {
+                return false
+            }
+            let insertedIDs = ids(at: changes.insertions, in: newData)
+            if let lastChanges, lastChanges.changes == changes, lastChanges.insertedIDs == insertedIDs {
+                // The body was evaluated again with the data these changes
+                // were already applied to, so the data only needs checking.
+                guard appendItems(from: oldData) else {
+                    return false
+                }
+            } else {
+                guard changes.isApplicable(oldCount: oldData.count, newCount: newData.count),
+                      apply(changes, insertedIDs: insertedIDs, from: oldData) else {
+                    return false
+                }
+                lastChanges = (changes, insertedIDs)
+            }
+        } else {
+            guard appendItems(from: oldData) else {
+                return false
+            }
+        }
+        firstInsertionOffset = .max
+        createdAllItems = false
+        return true
+    }
+
+    private func ids(at offsets: [Int], in data: Data) -> [ID] {
+        let idGenerator = view!.idGenerator
+        return offsets.map { offset in
+            idGenerator.makeID(
+                data: data,
+                index: data.index(data.startIndex, offsetBy: offset),
+                offset: offset
+            )
+        }
+    }
+
+    /// Applies `changes` to the items, after checking that they describe the
+    /// items produced for `oldData`.
+    ///
+    /// - Returns: `false`, without touching any item, if a removed element's
+    ///   item isn't at the removed offset or an inserted element already has
+    ///   an item.
+    private func apply(_ changes: ForEachChanges, insertedIDs: [ID], from oldData: Data) -> Bool {
+        let newData = view!.data
+        let removedIDs = ids(at: changes.removals, in: oldData)
+        let movedIDs = Set(removedIDs).intersection(insertedIDs)
+        for (offset, id) in zip(changes.removals, removedIDs) {
+            guard let item = items[id], !item.isRemoved, isCurrent(item) else {
+                continue
+            }
+            guard pendingOffset(of: item) == offset else {
+                return false
+            }
+        }
+        for id in insertedIDs where !movedIDs.contains(id) {
+            if let item = items[id], !item.isRemoved, isCurrent(item) {
+                return false
+            }
+        }
+        for id in removedIDs where !movedIDs.contains(id) {
+            evictedIDs.remove(id)
+            guard let item = items[id] else {
+                continue
+            }
+            item.seed = baseSeed &- 1
+            guard !item.isRemoved else {
+                continue
+            }
+            edits[id] = .removed
+            eraseItem(item)
+        }
+        for (offset, id) in zip(changes.insertions, insertedIDs) {
+            guard movedIDs.contains(id) else {
+                if !evictedIDs.contains(id) {
+                    edits[id] = .inserted
+                }
+                continue
+            }
+            guard let item = items[id], isCurrent(item) else {
+                continue
+            }
+            item.index = newData.index(newData.startIndex, offsetBy: offset)
+            item.offset = offset
+            item.seed = seed
+        }
+        if !changes.isEmpty {
+            offsetChanges.append((seed, changes))
+        }
+        return true
+    }
+
+    /// Handles data that keeps every element of the previous data in place,
+    /// such as a collection that was appended to or didn't change.
+    ///
+    /// Only the boundary is checked: the last previous element must keep its
+    /// ID at its offset, as recorded by its item if it has a live one, or
+    /// else in the previous data. Items are created lazily, so most elements
+    /// have none, and checking each of them would cost as much as the full
+    /// update this avoids.
+    ///
+    /// - Returns: `false`, without touching any item, if the boundary moved
+    ///   or an appended element already has an item, which means it moved.
+    private func appendItems(from oldData: Data) -> Bool {
+        let data = view!.data
+        let oldCount = oldData.count
+        let count = data.count
+        guard count >= oldCount else {
+            return false
+        }
+        let idGenerator = view!.idGenerator
+        if oldCount > 0 {
+            let offset = oldCount - 1
+            let id = idGenerator.makeID(
+                data: data,
+                index: data.index(data.startIndex, offsetBy: offset),
+                offset: offset
+            )
+            if let item = items[id], !item.isRemoved, isCurrent(item) {
+                guard pendingOffset(of: item) == offset else {
+                    return false
+                }
+            } else {
+                let oldID = idGenerator.makeID(
+                    data: oldData,
+                    index: oldData.index(oldData.startIndex, offsetBy: offset),
+                    offset: offset
+                )
+                guard oldID == id else {
+                    return false
+                }
+            }
+        }
+        let insertedIDs = ids(at: Array(oldCount ..< count), in: data)
+        for id in insertedIDs {
+            guard !evictedIDs.contains(id) else {
+                return false
+            }
+            if let item = items[id], !item.isRemoved, isCurrent(item) {
+                return false
+            }
+        }
+        for id in insertedIDs {
+            edits[id] = .inserted
+        }
+        return true
+    }
+
+    /* OpenSwiftUI Addition End */
+
     func fetchViewsPerElement() -> Int? {
         if let viewsPerElement {
             return viewsPerElement
@@ -877,7 +1130,7 @@ private class ForEachState<Data, ID, Content> where Data: RandomAccessCollection
                 var usedItemCount = 0 // 198
                 var totalCount = 0 // 1a0
                 for (_, item) in items {
-                    guard item.seed == seed else {
+                    guard isCurrent(item) else {
                         continue
                     }
                     usedItemCount += 1
@@ -914,7 +1167,7 @@ private class ForEachState<Data, ID, Content> where Data: RandomAccessCollection
             if transaction >= lastTransaction, let edit = edits[explicitID] {
                 return edit
             }
-            guard let item = items[explicitID], item.seed == seed else {
+            guard let item = items[explicitID], isCurrent(item) else {
                 return nil
             }
             switch item.views {
@@ -1464,8 +1717,7 @@ private struct ForEachChild<Data, ID, Content>: StatefulRule, CustomStringConver
 
     func updateValue() {
         let state = info.state
-        guard let item = state.items[id],
-              item.seed == state.seed else {
+        guard let item = state.currentItem(for: id) else {
             return
         }
         value = withObservation {
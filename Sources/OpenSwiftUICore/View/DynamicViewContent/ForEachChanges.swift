@@ -0,0 +1,120 @@
+//
+//  ForEachChanges.swift
+//  OpenSwiftUICore
+//
+//  Status: Complete
+
+/* OpenSwiftUI Addition Begin */
+
+// MARK: - ForEach + dataDifference
+
+@available(OpenSwiftUI_v1_0, *)
+extension ForEach {
+    /// Returns a for each that applies the given difference to the views it
+    /// produced for its previous data, instead of comparing the identifiers of
+    /// every element.
+    ///
+    /// By default, each time `data` changes a for each computes the identifier
+    /// of every element to find out which views to insert and remove. When you
+    /// already know how the collection changed, pass the difference from the
+    /// previous collection to the current one so that the update only touches
+    /// the changed elements:
+    ///
+    ///     ForEach(messages) { message in
+    ///         MessageRow(message: message)
+    ///     }
+    ///     .dataDifference(messages.difference(from: previousMessages))
+    ///
+    /// Moves inferred with
+    /// [inferringMoves()](https://developer.apple.com/documentation/swift/collectiondifference/inferringmoves())
+    /// keep the identity of the moved element.
+    ///
+    /// Evaluating the body again with the same data and difference doesn't
+    /// apply the difference a second time. If the difference doesn't describe
+    /// a collection of the current size, or doesn't match the views the for
+    /// each produced, the for each falls back to comparing every identifier.
+    ///
+    /// - Parameter difference: The changes from the previous value of `data`
+    ///   to the current one.
+    public func dataDifference<ChangeElement>(
+        _ difference: CollectionDifference<ChangeElement>
+    ) -> ForEach {
+        var forEach = self
+        forEach.changes = ForEachChanges(difference)
+        return forEach
+    }
+}
+
+// MARK: - ForEachChanges
+
+/// The offsets that changed between two consecutive values of a `ForEach`'s
+/// data.
+///
+/// Removals are offsets into the previous collection and insertions are
+/// offsets into the new one, both in ascending order, matching the offsets of
+/// a `CollectionDifference`. A moved element appears in both.
+package struct ForEachChanges: Equatable {
+    package private(set) var removals: [Int]
+
+    package private(set) var insertions: [Int]
+
+    package init<Removals, Insertions>(
+        removals: Removals,
+        insertions: Insertions
+    ) where Removals: Sequence, Removals.Element == Int, Insertions: Sequence, Insertions.Element == Int {
+        self.removals = Array(Set(removals)).sorted()
+        self.insertions = Array(Set(insertions)).sorted()
+    }
+
+    package init<ChangeElement>(_ difference: CollectionDifference<ChangeElement>) {
+        var removals: [Int] = []
+        var insertions: [Int] = []
+        for change in difference {
+            switch change {
+            case let .remove(offset, _, _):
+                removals.append(offset)
+            case let .insert(offset, _, _):
+                insertions.append(offset)
+            }
+        }
+        self.init(removals: removals, insertions: insertions)
+    }
+
+    package var isEmpty: Bool {
+        removals.isEmpty && insertions.isEmpty
+    }
+
+    /// Whether the changes turn a collection of `oldCount` elements into one
+    /// of `newCount` elements.
+    package func isApplicable(oldCount: Int, newCount: Int) -> Bool {
+        guard oldCount - removals.count + insertions.count == newCount else {
+            return false
+        }
+        if let last = removals.last, last >= oldCount || removals[0] < 0 {
+            return false
+        }
+        if let last = insertions.last, last >= newCount || insertions[0] < 0 {
+            return false
+        }
+        return true
+    }
+
+    /// Returns the offset in the new collection of the element at `offset` in
+    /// the previous one, or `nil` if the element was removed.
+    package func offset(movingFrom offset: Int) -> Int? {
+        let removed = removals.lowerBound(of: offset)
+        if removed != removals.endIndex, removals[removed] == offset {
+            return nil
+        }
+        var newOffset = offset - removed
+        for insertion in insertions {
+            guard insertion <= newOffset else {
+                break
+            }
+            newOffset += 1
+        }
+        return newOffset
+    }
+}
+
+/* OpenSwiftUI Addition End */
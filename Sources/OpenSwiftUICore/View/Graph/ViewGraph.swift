@@ -139,6 +139,12 @@ package final class ViewGraph: GraphHost {
     }
     
     package var nextUpdate: (views: NextUpdate, gestures: NextUpdate) = (NextUpdate(), NextUpdate())
+
+    /* OpenSwiftUI Addition Begin */
+    /// The next deadlines of the timelines of the graph, coalesced into
+    /// shared updates.
+    package let timelineScheduler = TimelineScheduler()
+    /* OpenSwiftUI Addition End */
     
     private weak var _preferenceBridge: PreferenceBridge?
     
@@ -304,6 +310,12 @@ package final class ViewGraph: GraphHost {
     
     override package func timeDidChange() {
         nextUpdate.views = NextUpdate()
+        /* OpenSwiftUI Addition Begin */
+        // Timelines that aren't updated at this time keep their pending
+        // deadlines.
+        timelineScheduler.advance(to: data.time)
+        nextUpdate.views.at(timelineScheduler.wakeTime)
+        /* OpenSwiftUI Addition End */
     }
     
     override package func isHiddenForReuseDidChange() {
@@ -475,12 +475,35 @@ package enum NamedImage {
 
     package struct Cache {
         private struct ImageCacheData {
-            var vectors: [NamedImage.VectorKey: NamedImage.VectorInfo] = [:]
-            var bitmaps: [NamedImage.BitmapKey: NamedImage.BitmapInfo] = [:]
-            var uuids: [UUID: NamedImage.DecodedInfo] = [:]
+            /* OpenSwiftUI Addition Begin */
+            // Vectors, bitmaps and decoded archive images share one budget,
+            // costed by their decoded size and evicted in LRU order.
+            var images: LRUCache<ImageKey, CachedImage>
+            /* OpenSwiftUI Addition End */
             var catalogs: [URL: WeakCatalog] = [:]
         }
 
+        /* OpenSwiftUI Addition Begin */
+        private enum ImageKey: Hashable {
+            case vector(NamedImage.VectorKey)
+            case bitmap(NamedImage.BitmapKey)
+            case uuid(UUID)
+
+            init(_ key: NamedImage.Key) {
+                switch key {
+                case let .bitmap(key): self = .bitmap(key)
+                case let .uuid(uuid): self = .uuid(uuid)
+                }
+            }
+        }
+
+        private enum CachedImage {
+            case vector(NamedImage.VectorInfo)
+            case bitmap(NamedImage.BitmapInfo)
+            case decoded(NamedImage.DecodedInfo)
+        }
+        /* OpenSwiftUI Addition End */
+
         private struct WeakCatalog {
             #if OPENSWIFTUI_LINK_COREUI
             weak var catalog: CUICatalog?
@@ -490,19 +513,128 @@ package enum NamedImage {
         package var archiveDelegate: AnyArchivedViewDelegate?
 
         @AtomicBox
-        private var data: ImageCacheData = .init()
+        private var data: ImageCacheData
 
-        package init(archiveDelegate: AnyArchivedViewDelegate? = nil) {
+        // OpenSwiftUI Addition: byteLimit
+        package init(
+            archiveDelegate: AnyArchivedViewDelegate? = nil,
+            byteLimit: Int = Cache.defaultByteLimit
+        ) {
             self.archiveDelegate = archiveDelegate
+            _data = AtomicBox(wrappedValue: ImageCacheData(images: LRUCache(costLimit: byteLimit)))
+        }
+
+        /* OpenSwiftUI Addition Begin */
+
+        // MARK: Cache budget
+
+        /// The default decoded size, in bytes, past which images are evicted.
+        package static let defaultByteLimit = 64 << 20
+
+        /// The estimated size of a cached vector glyph, whose drawing
+        /// commands are small next to a decoded bitmap.
+        private static let vectorCost = 4 << 10
+
+        /// The decoded size, in bytes, of an image with 32-bit pixels.
+        private static func cost(ofPixelSize size: CGSize) -> Int {
+            guard size.width.isFinite, size.height.isFinite else {
+                return 0
+            }
+            return Int(max(size.width, 0) * max(size.height, 0)) * 4
+        }
+
+        /// The decoded size, in bytes, past which least recently used
+        /// images are evicted.
+        ///
+        /// Pinned images are never evicted, so the cache can exceed this
+        /// limit while they are pinned.
+        package var byteLimit: Int {
+            get { data.images.costLimit }
+            nonmutating set { data.images.costLimit = max(newValue, 0) }
+        }
+
+        /// The decoded size of the cached images, in bytes.
+        package var byteCount: Int {
+            data.images.totalCost
         }
 
+        /// The decoded size of the pinned images, in bytes.
+        package var pinnedByteCount: Int {
+            data.images.pinnedCost
+        }
+
+        /// The number of cached images.
+        package var count: Int {
+            data.images.count
+        }
+
+        /// The counters of the lookups and evictions of the cache.
+        package var statistics: LRUCacheStatistics {
+            data.images.statistics
+        }
+
+        /// Protects a decoded image from eviction, such as while it is
+        /// visible, until it is unpinned as many times as it was pinned.
+        ///
+        /// - Returns: Whether the image is cached.
+        @discardableResult
+        package func pin(_ key: Key) -> Bool {
+            data.images.pin(ImageKey(key))
+        }
+
+        /// Balances a call to `pin(_:)`, evicting images past the byte limit.
+        package func unpin(_ key: Key) {
+            data.images.unpin(ImageKey(key))
+        }
+
+        /// The severity of a low-memory notification.
+        package enum MemoryPressure {
+            /// Memory is low: the cache shrinks to half its byte limit.
+            case warning
+
+            /// Memory is critically low: the cache keeps only pinned images.
+            case critical
+        }
+
+        /// Evicts unpinned images, from the least recently used one, in
+        /// response to memory pressure.
+        package func handleMemoryPressure(_ pressure: MemoryPressure) {
+            Self.release(in: $data, for: pressure)
+        }
+
+        private static func release(in data: AtomicBox<ImageCacheData>, for pressure: MemoryPressure) {
+            data.access { data in
+                switch pressure {
+                case .warning:
+                    data.images.trim(toCost: data.images.costLimit / 2)
+                case .critical:
+                    data.images.trim(toCost: 0)
+                }
+            }
+        }
+
+        #if canImport(Darwin)
+        /// Releases images of the cache when the system reports memory
+        /// pressure, for as long as the returned source isn't cancelled.
+        package func observeMemoryPressure(queue: DispatchQueue = .global(qos: .utility)) -> DispatchSourceMemoryPressure {
+            let source = DispatchSource.makeMemoryPressureSource(eventMask: [.warning, .critical], queue: queue)
+            source.setEventHandler { [data = $data, source] in
+                Self.release(in: data, for: source.data.contains(.critical) ? .critical : .warning)
+            }
+            source.resume()
+            return source
+        }
+        #endif
+
+        /* OpenSwiftUI Addition End */
+
         // MARK: Cache subscripts
 
         // Looks up cached VectorInfo for key; if not found or catalog changed,
         // calls loadVectorInfo and caches the result.
         fileprivate subscript(key: VectorKey, catalog: CUICatalog) -> VectorInfo? {
             #if OPENSWIFTUI_LINK_COREUI
-            if let cachedInfo = data.vectors[key] {
+            if case let .vector(cachedInfo)? = data.images.value(forKey: .vector(key)) {
                 if let cachedCatalog = cachedInfo.catalog, cachedCatalog == catalog {
                     return cachedInfo
                 }
@@ -510,7 +642,7 @@ package enum NamedImage {
             guard let info = key.loadVectorInfo(from: catalog, idiom: key.idiom) else {
                 return nil
             }
-            data.vectors[key] = info
+            data.images.setValue(.vector(info), forKey: .vector(key), cost: Self.vectorCost)
             return info
             #else
             _openSwiftUIPlatformUnimplementedWarning()
@@ -522,13 +654,13 @@ package enum NamedImage {
         // calls loadBitmapInfo and caches the result.
         package subscript(key: BitmapKey, location: Image.Location) -> BitmapInfo? {
             #if OPENSWIFTUI_LINK_COREUI
-            if let cached = data.bitmaps[key] {
+            if case let .bitmap(cached)? = data.images.value(forKey: .bitmap(key)) {
                 return cached
             }
             guard let info = key.loadBitmapInfo(location: location, idiom: key.idiom, subtype: key.subtype) else {
                 return nil
             }
-            data.bitmaps[key] = info
+            data.images.setValue(.bitmap(info), forKey: .bitmap(key), cost: Self.cost(ofPixelSize: info.unrotatedPixelSize))
             return info
             #else
             _openSwiftUIPlatformUnimplementedWarning()
@@ -575,7 +707,7 @@ package enum NamedImage {
                     orientation: info.orientation
                 )
             case .uuid(let uuid):
-                if let cached = data.uuids[uuid] {
+                if case let .decoded(cached)? = data.images.value(forKey: .uuid(uuid)) {
                     return cached
                 }
                 guard let delegate = archiveDelegate else {
@@ -596,7 +728,7 @@ package enum NamedImage {
                     unrotatedPixelSize: CGSize(width: width, height: height),
                     orientation: resolved.orientation
                 )
-                data.uuids[uuid] = decoded
+                data.images.setValue(.decoded(decoded), forKey: .uuid(uuid), cost: Self.cost(ofPixelSize: decoded.unrotatedPixelSize))
                 return decoded
             }
         }
@@ -604,7 +736,21 @@ package enum NamedImage {
 
     // MARK: - NamedImage.sharedCache
 
-    package static var sharedCache = Cache()
+    package static var sharedCache: Cache = {
+        let cache = Cache()
+        /* OpenSwiftUI Addition Begin */
+        #if canImport(Darwin)
+        sharedCacheMemoryPressureSource = cache.observeMemoryPressure()
+        #endif
+        /* OpenSwiftUI Addition End */
+        return cache
+    }()
+
+    /* OpenSwiftUI Addition Begin */
+    #if canImport(Darwin)
+    private static var sharedCacheMemoryPressureSource: DispatchSourceMemoryPressure?
+    #endif
+    /* OpenSwiftUI Addition End */
 }
 
 @available(OpenSwiftUI_v1_0, *)
@@ -368,8 +368,8 @@ extension Font {
         var category: DynamicTypeSize
     }
 
-    private static var fontCache: ObjectCache<Resolved, CTFont> = {
-        let cache: ObjectCache<Resolved, CTFont> = ObjectCache { resolved in
+    private static let fontCache: ShardedObjectCache<Resolved, CTFont> = {
+        let cache: ShardedObjectCache<Resolved, CTFont> = ShardedObjectCache { resolved in
             #if canImport(CoreText)
             let context = resolved.context
             var descriptor = resolved.font.resolve(in: context)
@@ -73,6 +73,8 @@ extension NSAttributedString {
         let drawWithRequestedWidth: Bool
         let isCollapsible: Bool
         var entries: [(CGSize, Metrics)]
+        // OpenSwiftUI Addition: the key of `string` in the shared metrics cache
+        var contentHash: StrongHash?
 
         init(
             _ string: NSAttributedString?,
@@ -99,6 +101,7 @@ extension NSAttributedString {
             self.drawWithRequestedWidth = drawWithRequestedWidth
             self.isCollapsible = isCollapsible
             self.entries = []
+            self.contentHash = nil
         }
 
         mutating func metrics(
@@ -130,18 +133,37 @@ extension NSAttributedString {
                 width: max(0, requestedSize.width - layoutMargins.horizontal) + bodyHeadOutdent,
                 height: max(0, requestedSize.height - layoutMargins.vertical)
             )
-            var result = string.measured(
-                requestedSize: measurementSize,
+            /* OpenSwiftUI Addition Begin */
+            // Equal strings resolved by other texts share their measurements.
+            let contentHash = self.contentHash ?? string.contentHash
+            self.contentHash = contentHash
+            let key = TextMetricsCache.Key(
+                contentHash: contentHash,
+                width: measurementSize.width,
+                height: measurementSize.height,
                 lineLimit: lineLimit,
                 lowerLineLimit: lowerLineLimit,
                 minScaleFactor: minScaleFactor,
                 bodyHeadOutdent: bodyHeadOutdent,
                 widthIsFlexible: widthIsFlexible,
-                kitCache: &kitCache,
                 isCollapsible: isCollapsible,
-                wantsNumberOfLineFragments: wantsNumberOfLineFragments,
-                context: context
+                wantsNumberOfLineFragments: wantsNumberOfLineFragments
             )
+            var result = TextMetricsCache.shared.metrics(for: key, string: string) {
+                string.measured(
+                    requestedSize: measurementSize,
+                    lineLimit: lineLimit,
+                    lowerLineLimit: lowerLineLimit,
+                    minScaleFactor: minScaleFactor,
+                    bodyHeadOutdent: bodyHeadOutdent,
+                    widthIsFlexible: widthIsFlexible,
+                    kitCache: &kitCache,
+                    isCollapsible: isCollapsible,
+                    wantsNumberOfLineFragments: wantsNumberOfLineFragments,
+                    context: context
+                )
+            }
+            /* OpenSwiftUI Addition End */
             result.size.round(.up, toMultipleOf: pixelLength)
             result.size.width -= bodyHeadOutdent
             result.update(layoutMargins: layoutMargins, pixelLength: pixelLength)
@@ -254,17 +276,51 @@ extension NSAttributedString {
                 hasTruncatedRanges: drawingContext.hasTruncatedRanges
             )
             #else
-            _openSwiftUIPlatformUnimplementedWarning()
+            /* OpenSwiftUI Addition Begin */
+            // Without a platform text engine, the text is measured by a
+            // portable layout, segmented once and kept in the kit cache.
+            // Fonts don't resolve to a platform font on these platforms, so
+            // the runs carry no font to measure with: every run is measured
+            // with the default metrics, whatever its font and size.
+            let layout: PortableTextLayout
+            if let cachedLayout = kitCache as? PortableTextLayout {
+                layout = cachedLayout
+            } else {
+                layout = PortableTextLayout(string: string, metrics: PortableTextLayout.defaultMetrics)
+                kitCache = layout
+            }
+            let paragraphStyle = firstAttribute(NSParagraphStyle.self, name: .kitParagraphStyle)
+            let lineSpacing = paragraphStyle?.lineSpacing ?? 0
+            let result = layout.layout(
+                in: requestedSize,
+                lineLimit: lineLimit,
+                lineBreakMode: paragraphStyle?.lineBreakMode ?? .byTruncatingTail,
+                lineSpacing: lineSpacing
+            )
+            let limitedFontHeight: CGFloat
+            if let lowerLineLimit, lowerLineLimit >= 1, length >= 1 {
+                let lineCount = CGFloat(lowerLineLimit)
+                limitedFontHeight = lineCount * layout.metrics.lineHeight + (lineCount - 1) * lineSpacing
+            } else {
+                limitedFontHeight = 0
+            }
+            var width = widthIsFlexible ? requestedSize.width : result.size.width
+            var height = max(result.size.height, limitedFontHeight)
+            if isCollapsible && height > requestedSize.height {
+                width = .zero
+                height = .zero
+            }
             return Metrics(
-                size: .zero,
+                size: CGSize(width: width, height: height),
                 scale: 1,
-                firstBaseline: 0,
-                lastBaseline: 0,
+                firstBaseline: result.firstBaseline,
+                lastBaseline: result.lastBaseline,
                 baselineAdjustment: 0,
                 requestedWidth: requestedSize.width,
-                numberOfLines: wantsNumberOfLineFragments ? 0 : nil,
-                hasTruncatedRanges: false
+                numberOfLines: wantsNumberOfLineFragments ? UInt(result.lines.count) : nil,
+                hasTruncatedRanges: result.hasTruncatedRanges
             )
+            /* OpenSwiftUI Addition End */
             #endif
         }
     }
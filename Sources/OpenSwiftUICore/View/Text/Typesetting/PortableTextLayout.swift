@@ -0,0 +1,582 @@
+//
+//  PortableTextLayout.swift
+//  OpenSwiftUICore
+//
+//  Status: Complete
+
+/* OpenSwiftUI Addition Begin */
+
+package import Foundation
+package import UIFoundation_Private
+
+// MARK: - PortableTextLayout
+
+/// A line breaker that lays out plain text without a platform text engine.
+///
+/// The text is segmented once into grapheme clusters, each with an advance
+/// from `TextGlyphMetrics` and the line break opportunity before it, found
+/// with the pair rules of UAX #14. Laying out the text then fills lines
+/// greedily, and truncates the last line as `NSLineBreakMode` does, visiting
+/// only the clusters of the lines it returns, so repeated measurements at
+/// different sizes don't pay for segmentation again.
+///
+/// Shaping, bidirectional reordering and dictionary-based breaking, as used
+/// for Thai, aren't supported.
+package final class PortableTextLayout {
+    package let string: String
+
+    package let metrics: any TextGlyphMetrics
+
+    private let characters: [Character]
+
+    private let clusters: [Cluster]
+
+    /// The indices of the clusters that end a paragraph, in order.
+    private let paragraphBreaks: [Int]
+
+    private let ellipsisAdvance: CGFloat
+
+    /// Segments a string.
+    ///
+    /// - Parameters:
+    ///   - string: The text to lay out.
+    ///   - metrics: The metrics measuring the grapheme clusters.
+    package init(string: String, metrics: any TextGlyphMetrics) {
+        self.string = string
+        self.metrics = metrics
+        let characters = Array(string)
+        var clusters: [Cluster] = []
+        clusters.reserveCapacity(characters.count)
+        var paragraphBreaks: [Int] = []
+        var previous: LineBreakClass?
+        var lastNonSpace: LineBreakClass?
+        for (index, character) in characters.enumerated() {
+            let breakClass = LineBreakClass(character)
+            let breakBefore = previous.map {
+                LineBreakClass.opportunity(between: $0, lastNonSpace: lastNonSpace ?? $0, and: breakClass)
+            } ?? .prohibited
+            clusters.append(Cluster(
+                advance: breakClass.isZeroWidth ? 0 : metrics.advance(of: character),
+                breakBefore: breakBefore,
+                isWhitespace: breakClass.isWhitespace
+            ))
+            if breakClass.isMandatoryBreak {
+                paragraphBreaks.append(index)
+            }
+            previous = breakClass
+            if breakClass != .space {
+                lastNonSpace = breakClass
+            }
+        }
+        self.characters = characters
+        self.clusters = clusters
+        self.paragraphBreaks = paragraphBreaks
+        self.ellipsisAdvance = metrics.advance(of: "\u{2026}")
+    }
+
+    /// The number of grapheme clusters of the text.
+    package var count: Int {
+        clusters.count
+    }
+
+    // MARK: - Layout
+
+    /// A line of laid out text.
+    package struct Line: Equatable {
+        /// The clusters shown before the ellipsis, or every cluster of the
+        /// line if it isn't truncated.
+        package var leading: Range<Int>
+
+        /// The clusters shown after the ellipsis of a line truncated at its
+        /// head or in its middle.
+        package var trailing: Range<Int>
+
+        /// Whether the line shows an ellipsis between its leading and
+        /// trailing clusters.
+        package var isTruncated: Bool
+
+        /// The width of the line, without its trailing whitespace.
+        package var width: CGFloat
+    }
+
+    /// The lines laid out in a size, and their metrics.
+    package struct Result: Equatable {
+        package var lines: [Line]
+
+        package var size: CGSize
+
+        /// The distance from the top of the text to the baseline of its
+        /// first line.
+        package var firstBaseline: CGFloat
+
+        /// The distance from the top of the text to the baseline of its
+        /// last line.
+        package var lastBaseline: CGFloat
+
+        /// Whether some of the text isn't shown.
+        package var hasTruncatedRanges: Bool
+    }
+
+    /// Lays out the text in a size.
+    ///
+    /// - Parameters:
+    ///   - size: The available size. Lines are broken to fit its width, and
+    ///     only the lines that fit its height are laid out; at least one
+    ///     line is always laid out.
+    ///   - lineLimit: The maximum number of lines, or `nil` for no limit.
+    ///   - lineBreakMode: How lines are broken and the last line truncated.
+    ///   - lineSpacing: The space between two lines.
+    /// - Returns: The lines and their metrics.
+    package func layout(
+        in size: CGSize,
+        lineLimit: Int? = nil,
+        lineBreakMode: NSLineBreakMode = .byWordWrapping,
+        lineSpacing: CGFloat = 0
+    ) -> Result {
+        let lineHeight = metrics.lineHeight
+        var maximumLineCount = max(lineLimit ?? .max, 1)
+        if size.height.isFinite, lineHeight > 0 {
+            let fittingLineCount = ((size.height + lineSpacing) / (lineHeight + lineSpacing)).rounded(.down)
+            maximumLineCount = min(maximumLineCount, Int(max(fittingLineCount, 1)))
+        }
+        let width = max(size.width, 0)
+        var lines: [Line] = []
+        var hasTruncatedRanges = false
+        var start = 0
+        while start < clusters.count, lines.count < maximumLineCount {
+            let end = lineEnd(from: start, width: width, breaksCharacters: lineBreakMode == .byCharWrapping)
+            if lines.count == maximumLineCount - 1, end < clusters.count {
+                hasTruncatedRanges = true
+                lines.append(truncatedLine(from: start, width: width, lineBreakMode: lineBreakMode, fallback: start ..< end))
+                break
+            }
+            lines.append(Line(leading: start ..< end, trailing: end ..< end, isTruncated: false, width: visibleWidth(of: start ..< end)))
+            start = end
+        }
+        guard !lines.isEmpty else {
+            return Result(lines: [], size: .zero, firstBaseline: 0, lastBaseline: 0, hasTruncatedRanges: false)
+        }
+        let lineCount = CGFloat(lines.count)
+        return Result(
+            lines: lines,
+            size: CGSize(
+                width: lines.reduce(0) { max($0, $1.width) },
+                height: lineCount * lineHeight + (lineCount - 1) * lineSpacing
+            ),
+            firstBaseline: metrics.ascender,
+            lastBaseline: (lineCount - 1) * (lineHeight + lineSpacing) + metrics.ascender,
+            hasTruncatedRanges: hasTruncatedRanges
+        )
+    }
+
+    /// The text shown by a line.
+    package func string(of line: Line) -> String {
+        var string = String(characters[line.leading])
+        if line.isTruncated {
+            string.append("\u{2026}")
+        }
+        string.append(contentsOf: characters[line.trailing])
+        if let last = string.last, last.isNewline {
+            string.removeLast()
+        }
+        return string
+    }
+
+    // MARK: - Line breaking
+
+    /// Returns the end of the line starting at a cluster.
+    ///
+    /// Whitespace hangs past the end of a line. A line always holds at least
+    /// one cluster, and a word wider than the line is broken between
+    /// clusters.
+    private func lineEnd(from start: Int, width: CGFloat, breaksCharacters: Bool) -> Int {
+        var lineWidth: CGFloat = 0
+        var lastOpportunity: Int?
+        var index = start
+        while index < clusters.count {
+            let cluster = clusters[index]
+            if index > start {
+                switch cluster.breakBefore {
+                case .mandatory: return index
+                case .allowed: lastOpportunity = index
+                case .prohibited: break
+                }
+            }
+            if !cluster.isWhitespace, index > start, lineWidth + cluster.advance > width {
+                return breaksCharacters ? index : lastOpportunity ?? index
+            }
+            lineWidth += cluster.advance
+            index += 1
+        }
+        return index
+    }
+
+    /// Returns the last line of a layout that doesn't show every cluster.
+    ///
+    /// The line holds the rest of the paragraph it starts in, truncated to
+    /// the width with an ellipsis as `lineBreakMode` specifies. Wrapping
+    /// modes keep the line as it was broken, and clipping cuts the paragraph
+    /// at the width without an ellipsis.
+    private func truncatedLine(from start: Int, width: CGFloat, lineBreakMode: NSLineBreakMode, fallback: Range<Int>) -> Line {
+        let paragraphEnd = paragraphEnd(from: start)
+        let isLastParagraph = paragraphEnd == clusters.count
+        let paragraph = start ..< trimmedEnd(of: start ..< paragraphEnd)
+        if lineBreakMode == .byWordWrapping || lineBreakMode == .byCharWrapping {
+            return Line(leading: fallback, trailing: fallback.upperBound ..< fallback.upperBound, isTruncated: false, width: visibleWidth(of: fallback))
+        }
+        if lineBreakMode == .byClipping {
+            let leading = prefix(of: paragraph, width: width)
+            return Line(leading: leading, trailing: leading.upperBound ..< leading.upperBound, isTruncated: false, width: visibleWidth(of: leading))
+        }
+        // A paragraph that fits, followed by more paragraphs, is only marked
+        // with an ellipsis when truncating its tail.
+        let paragraphWidth = visibleWidth(of: paragraph, limit: width)
+        if paragraphWidth <= width, !isLastParagraph, lineBreakMode != .byTruncatingTail {
+            return Line(leading: paragraph, trailing: paragraph.upperBound ..< paragraph.upperBound, isTruncated: false, width: paragraphWidth)
+        }
+        let available = max(width - ellipsisAdvance, 0)
+        let leading: Range<Int>
+        let trailing: Range<Int>
+        if lineBreakMode == .byTruncatingHead {
+            leading = start ..< start
+            trailing = suffix(of: paragraph, width: available)
+        } else if lineBreakMode == .byTruncatingMiddle {
+            leading = prefix(of: paragraph, width: available / 2)
+            trailing = suffix(
+                of: leading.upperBound ..< paragraph.upperBound,
+                width: available - visibleWidth(of: leading)
+            )
+        } else {
+            leading = prefix(of: paragraph, width: available)
+            trailing = paragraph.upperBound ..< paragraph.upperBound
+        }
+        return Line(
+            leading: leading,
+            trailing: trailing,
+            isTruncated: true,
+            width: visibleWidth(of: leading) + ellipsisAdvance + visibleWidth(of: trailing)
+        )
+    }
+
+    /// The index after the mandatory break ending the paragraph containing
+    /// a cluster.
+    private func paragraphEnd(from start: Int) -> Int {
+        var lower = 0
+        var upper = paragraphBreaks.count
+        while lower < upper {
+            let middle = (lower + upper) / 2
+            if paragraphBreaks[middle] < start {
+                lower = middle + 1
+            } else {
+                upper = middle
+            }
+        }
+        return lower < paragraphBreaks.count ? paragraphBreaks[lower] + 1 : clusters.count
+    }
+
+    /// The longest prefix of a range, without trailing whitespace, that
+    /// fits a width.
+    private func prefix(of range: Range<Int>, width: CGFloat) -> Range<Int> {
+        var lineWidth: CGFloat = 0
+        var end = range.lowerBound
+        while end < range.upperBound, lineWidth + clusters[end].advance <= width {
+            lineWidth += clusters[end].advance
+            end += 1
+        }
+        return range.lowerBound ..< trimmedEnd(of: range.lowerBound ..< end)
+    }
+
+    /// The longest suffix of a range, without leading whitespace, that fits
+    /// a width.
+    private func suffix(of range: Range<Int>, width: CGFloat) -> Range<Int> {
+        var lineWidth: CGFloat = 0
+        var start = range.upperBound
+        while start > range.lowerBound, lineWidth + clusters[start - 1].advance <= width {
+            lineWidth += clusters[start - 1].advance
+            start -= 1
+        }
+        while start < range.upperBound, clusters[start].isWhitespace {
+            start += 1
+        }
+        return start ..< range.upperBound
+    }
+
+    private func trimmedEnd(of range: Range<Int>) -> Int {
+        var end = range.upperBound
+        while end > range.lowerBound, clusters[end - 1].isWhitespace {
+            end -= 1
+        }
+        return end
+    }
+
+    /// The width of a range without its trailing whitespace, stopping once
+    /// it exceeds `limit`.
+    private func visibleWidth(of range: Range<Int>, limit: CGFloat = .infinity) -> CGFloat {
+        var width: CGFloat = 0
+        for index in range.lowerBound ..< trimmedEnd(of: range) {
+            width += clusters[index].advance
+            if width > limit {
+                break
+            }
+        }
+        return width
+    }
+
+    // MARK: - Cluster
+
+    private struct Cluster {
+        var advance: CGFloat
+
+        /// The line break opportunity between the previous cluster and this
+        /// one.
+        var breakBefore: LineBreakOpportunity
+
+        /// Whether the cluster hangs past the end of a line.
+        var isWhitespace: Bool
+    }
+}
+
+// MARK: - PortableTextLayout + Default metrics
+
+extension PortableTextLayout {
+    private static let _defaultMetrics = AtomicBox<any TextGlyphMetrics>(wrappedValue: makeDefaultMetrics())
+
+    /// The metrics used to measure text where no platform text engine is
+    /// available.
+    ///
+    /// Defaults to the metrics of the TrueType font at the path in
+    /// `OPENSWIFTUI_TEXT_FONT_PATH`, measured at
+    /// `OPENSWIFTUI_TEXT_FONT_SIZE` points, or to monospaced metrics
+    /// approximating a 17 point font.
+    ///
+    /// These metrics measure every run, regardless of its font: fonts don't
+    /// resolve to platform fonts where there is no platform text engine.
+    package static var defaultMetrics: any TextGlyphMetrics {
+        get { _defaultMetrics.wrappedValue }
+        set { _defaultMetrics.wrappedValue = newValue }
+    }
+
+    private static func makeDefaultMetrics() -> any TextGlyphMetrics {
+        let environment = ProcessInfo.processInfo.environment
+        let pointSize = environment["OPENSWIFTUI_TEXT_FONT_SIZE"].flatMap(Double.init).map { CGFloat($0) } ?? 17
+        if let path = environment["OPENSWIFTUI_TEXT_FONT_PATH"],
+           let metrics = try? TrueTypeTextGlyphMetrics(contentsOf: URL(fileURLWithPath: path), pointSize: pointSize) {
+            return metrics
+        }
+        return MonospaceTextGlyphMetrics.approximating(pointSize: pointSize)
+    }
+}
+
+// MARK: - LineBreakOpportunity
+
+private enum LineBreakOpportunity: UInt8 {
+    case prohibited
+    case allowed
+    case mandatory
+}
+
+// MARK: - LineBreakClass
+
+/// The line breaking classes of UAX #14 that affect the pair rules
+/// implemented here. Other classes resolve to `alphabetic` or, for scripts
+/// written without spaces, `ideographic`.
+private enum LineBreakClass: UInt8 {
+    case mandatoryBreak
+    case carriageReturn
+    case lineFeed
+    case nextLine
+    case space
+    case zeroWidthSpace
+    case glue
+    case wordJoiner
+    case breakAfter
+    case hyphen
+    case open
+    case close
+    case closeParenthesis
+    case exclamation
+    case infixSeparator
+    case quotation
+    case nonstarter
+    case inseparable
+    case prefixNumeric
+    case postfixNumeric
+    case numeric
+    case ideographic
+    case alphabetic
+
+    /// The class of a grapheme cluster, which is the class of its base
+    /// scalar (LB9). A cluster of a lone combining mark is alphabetic
+    /// (LB10).
+    init(_ character: Character) {
+        guard let scalar = character.unicodeScalars.first else {
+            self = .alphabetic
+            return
+        }
+        self.init(scalar)
+    }
+
+    init(_ scalar: Unicode.Scalar) {
+        let value = scalar.value
+        switch value {
+        case 0x0B, 0x0C, 0x2028, 0x2029: self = .mandatoryBreak
+        case 0x0D: self = .carriageReturn
+        case 0x0A: self = .lineFeed
+        case 0x85: self = .nextLine
+        case 0x20: self = .space
+        case 0x200B: self = .zeroWidthSpace
+        case 0x2060, 0xFEFF: self = .wordJoiner
+        case 0xA0, 0x202F, 0x2007, 0x180E, 0x0F0C: self = .glue
+        case 0x09, 0x7C, 0xAD, 0x058A, 0x05BE, 0x1680, 0x2000 ... 0x2006, 0x2008 ... 0x200A,
+             0x2010, 0x2012, 0x2013, 0x2027, 0x205F:
+            self = .breakAfter
+        case 0x2D: self = .hyphen
+        case 0x28, 0x5B, 0x7B, 0xA1, 0xBF, 0x201A, 0x201E, 0x3008, 0x300A, 0x300C, 0x300E,
+             0x3010, 0x3014, 0x3016, 0x3018, 0x301A, 0xFF08, 0xFF3B, 0xFF5B:
+            self = .open
+        case 0x7D, 0x3001, 0x3002, 0x3009, 0x300B, 0x300D, 0x300F, 0x3011, 0x3015, 0x3017,
+             0x3019, 0x301B, 0xFF0C, 0xFF0E, 0xFF5D:
+            self = .close
+        case 0x29, 0x5D, 0xFF09, 0xFF3D: self = .closeParenthesis
+        case 0x21, 0x3F, 0xFF01, 0xFF1F: self = .exclamation
+        case 0x2C, 0x2E, 0x3A, 0x3B, 0x037E, 0x0589, 0x060C, 0x060D, 0x2044, 0xFE10, 0xFE13, 0xFE14:
+            self = .infixSeparator
+        case 0x22, 0x27, 0xAB, 0xBB, 0x2018, 0x2019, 0x201B, 0x201C, 0x201D, 0x201F, 0x2039, 0x203A:
+            self = .quotation
+        case 0x3005, 0x301C, 0x303B, 0x309B ... 0x309E, 0x30A0, 0x30FB ... 0x30FE, 0xFF1A, 0xFF1B, 0xFF65,
+             // Small kana
+             0x3041, 0x3043, 0x3045, 0x3047, 0x3049, 0x3063, 0x3083, 0x3085, 0x3087, 0x308E, 0x3095, 0x3096,
+             0x30A1, 0x30A3, 0x30A5, 0x30A7, 0x30A9, 0x30C3, 0x30E3, 0x30E5, 0x30E7, 0x30EE, 0x30F5, 0x30F6:
+            self = .nonstarter
+        case 0x2024 ... 0x2026: self = .inseparable
+        case 0x24, 0x2B, 0x5C, 0xA3, 0xA5, 0x20A0 ... 0x20CF, 0x2116: self = .prefixNumeric
+        case 0x25, 0xA2, 0xB0, 0x2030 ... 0x2037, 0x2103, 0x2109: self = .postfixNumeric
+        case 0x30 ... 0x39: self = .numeric
+        case 0x1100 ... 0x115F, 0x2E80 ... 0x2FFF, 0x3040 ... 0x30FF, 0x3130 ... 0x318F,
+             0x3400 ... 0x4DBF, 0x4E00 ... 0x9FFF, 0xAC00 ... 0xD7A3, 0xF900 ... 0xFAFF,
+             0xFF10 ... 0xFF19, 0xFF21 ... 0xFF3A, 0xFF41 ... 0xFF5A,
+             0x20000 ... 0x2FFFD, 0x30000 ... 0x3FFFD:
+            self = .ideographic
+        default:
+            if scalar.properties.generalCategory == .decimalNumber {
+                self = .numeric
+            } else if value >= 0x1F000, scalar.properties.isEmoji {
+                self = .ideographic
+            } else {
+                self = .alphabetic
+            }
+        }
+    }
+
+    var isMandatoryBreak: Bool {
+        switch self {
+        case .mandatoryBreak, .carriageReturn, .lineFeed, .nextLine: true
+        default: false
+        }
+    }
+
+    /// Whether the cluster hangs past the end of a line and isn't measured.
+    var isWhitespace: Bool {
+        isMandatoryBreak || self == .space || self == .zeroWidthSpace
+    }
+
+    var isZeroWidth: Bool {
+        isMandatoryBreak || self == .zeroWidthSpace || self == .wordJoiner
+    }
+
+    /// The break opportunity between two clusters, following the pair rules
+    /// of UAX #14 from LB4 to LB31.
+    ///
+    /// - Parameters:
+    ///   - before: The class of the cluster before the opportunity.
+    ///   - lastNonSpace: The class of the last cluster before the
+    ///     opportunity that isn't a space, for the rules that look past
+    ///     spaces.
+    ///   - after: The class of the cluster after the opportunity.
+    static func opportunity(
+        between before: LineBreakClass,
+        lastNonSpace: LineBreakClass,
+        and after: LineBreakClass
+    ) -> LineBreakOpportunity {
+        // LB4, LB5: Break after hard line breaks.
+        if before.isMandatoryBreak {
+            return .mandatory
+        }
+        // LB6, LB7: Don't break before hard line breaks or spaces.
+        if after.isMandatoryBreak || after == .space || after == .zeroWidthSpace {
+            return .prohibited
+        }
+        // LB8: Break after zero width spaces, even followed by spaces.
+        if lastNonSpace == .zeroWidthSpace {
+            return .allowed
+        }
+        // LB11: Don't break around word joiners.
+        if before == .wordJoiner || after == .wordJoiner {
+            return .prohibited
+        }
+        // LB12, LB12a: Don't break after glue, nor before it except after
+        // spaces and hyphens.
+        if before == .glue || (after == .glue && before != .space && before != .breakAfter && before != .hyphen) {
+            return .prohibited
+        }
+        // LB13: Don't break before closing punctuation.
+        switch after {
+        case .close, .closeParenthesis, .exclamation, .infixSeparator: return .prohibited
+        default: break
+        }
+        // LB14: Don't break after opening punctuation, even with spaces.
+        if lastNonSpace == .open {
+            return .prohibited
+        }
+        // LB15: Don't break between a quotation and an opening punctuation.
+        if lastNonSpace == .quotation, after == .open {
+            return .prohibited
+        }
+        // LB16: Don't break between closing punctuation and a nonstarter.
+        if lastNonSpace == .close || lastNonSpace == .closeParenthesis, after == .nonstarter {
+            return .prohibited
+        }
+        // LB18: Break after spaces.
+        if before == .space {
+            return .allowed
+        }
+        // LB19: Don't break around quotations.
+        if before == .quotation || after == .quotation {
+            return .prohibited
+        }
+        // LB21, LB22: Don't break before hyphens, nonstarters and
+        // inseparable characters.
+        switch after {
+        case .breakAfter, .hyphen, .nonstarter, .inseparable: return .prohibited
+        default: break
+        }
+        switch (before, after) {
+        // LB23: Don't break between letters and numbers.
+        case (.alphabetic, .numeric), (.numeric, .alphabetic),
+             // LB24: Don't break between numeric prefixes or postfixes and
+             // letters.
+             (.prefixNumeric, .alphabetic), (.postfixNumeric, .alphabetic),
+             (.alphabetic, .prefixNumeric), (.alphabetic, .postfixNumeric),
+             (.prefixNumeric, .ideographic),
+             // LB25: Don't break numbers.
+             (.prefixNumeric, .numeric), (.postfixNumeric, .numeric),
+             (.prefixNumeric, .open), (.postfixNumeric, .open),
+             (.hyphen, .numeric), (.infixSeparator, .numeric), (.numeric, .numeric),
+             (.numeric, .prefixNumeric), (.numeric, .postfixNumeric),
+             (.close, .prefixNumeric), (.close, .postfixNumeric),
+             (.closeParenthesis, .prefixNumeric), (.closeParenthesis, .postfixNumeric),
+             // LB28, LB29: Don't break words, nor after infix separators
+             // within them.
+             (.alphabetic, .alphabetic), (.infixSeparator, .alphabetic),
+             // LB30: Don't break between letters and parentheses.
+             (.alphabetic, .open), (.numeric, .open),
+             (.closeParenthesis, .alphabetic), (.closeParenthesis, .numeric):
+            return .prohibited
+        default:
+            // LB31: Break everywhere else.
+            return .allowed
+        }
+    }
+}
+
+/* OpenSwiftUI Addition End */
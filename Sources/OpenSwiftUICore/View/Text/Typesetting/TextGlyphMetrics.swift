@@ -0,0 +1,361 @@
+//
+//  TextGlyphMetrics.swift
+//  OpenSwiftUICore
+//
+//  Status: Complete
+
+/* OpenSwiftUI Addition Begin */
+
+package import Foundation
+
+// MARK: - TextGlyphMetrics
+
+/// The horizontal advances and vertical extents used by
+/// `PortableTextLayout` to measure text.
+package protocol TextGlyphMetrics {
+    /// The advance of a grapheme cluster, in points.
+    func advance(of character: Character) -> CGFloat
+
+    /// The distance from the top of a line to its baseline.
+    var ascender: CGFloat { get }
+
+    /// The distance from the baseline to the bottom of a line, as a positive
+    /// value.
+    var descender: CGFloat { get }
+
+    /// The extra space added between two lines.
+    var leading: CGFloat { get }
+}
+
+extension TextGlyphMetrics {
+    /// The height of a line.
+    package var lineHeight: CGFloat {
+        ascender + descender + leading
+    }
+}
+
+// MARK: - MonospaceTextGlyphMetrics
+
+/// Metrics in which every grapheme cluster occupies a whole number of fixed
+/// width cells, like the characters of a terminal.
+///
+/// Wide characters, such as ideographs and emoji, occupy two cells, and
+/// control and format characters none.
+package struct MonospaceTextGlyphMetrics: TextGlyphMetrics, Hashable {
+    package var cellWidth: CGFloat
+
+    package var ascender: CGFloat
+
+    package var descender: CGFloat
+
+    package var leading: CGFloat
+
+    package init(cellWidth: CGFloat, ascender: CGFloat, descender: CGFloat, leading: CGFloat = 0) {
+        self.cellWidth = cellWidth
+        self.ascender = ascender
+        self.descender = descender
+        self.leading = leading
+    }
+
+    /// Metrics where a cell is one point wide and one point high, which
+    /// measure text in terminal columns and rows.
+    package static let terminal = MonospaceTextGlyphMetrics(cellWidth: 1, ascender: 1, descender: 0)
+
+    /// Metrics approximating a monospaced font of the given size.
+    package static func approximating(pointSize: CGFloat) -> MonospaceTextGlyphMetrics {
+        MonospaceTextGlyphMetrics(
+            cellWidth: (pointSize * 0.6).rounded(.up),
+            ascender: (pointSize * 0.95).rounded(.up),
+            descender: (pointSize * 0.25).rounded(.up)
+        )
+    }
+
+    package func advance(of character: Character) -> CGFloat {
+        CGFloat(Self.cellCount(of: character)) * cellWidth
+    }
+
+    /// The number of cells occupied by a grapheme cluster.
+    package static func cellCount(of character: Character) -> Int {
+        guard let first = character.unicodeScalars.first else {
+            return 0
+        }
+        let value = first.value
+        if value < 0x20 || (0x7F ..< 0xA0).contains(value) {
+            return 0
+        }
+        switch first.properties.generalCategory {
+        case .format, .nonspacingMark, .enclosingMark, .lineSeparator, .paragraphSeparator:
+            return 0
+        default:
+            break
+        }
+        if character.unicodeScalars.contains(where: { $0.value == 0xFE0F })
+            || (first.properties.isEmojiPresentation && value >= 0x1F000) {
+            return 2
+        }
+        return isWide(value) ? 2 : 1
+    }
+
+    /// Whether a scalar has the East Asian Wide or Fullwidth property.
+    private static func isWide(_ value: UInt32) -> Bool {
+        switch value {
+        case 0x1100 ... 0x115F, 0x231A ... 0x231B, 0x2329 ... 0x232A,
+             0x2E80 ... 0x303E, 0x3041 ... 0x33FF, 0x3400 ... 0x4DBF,
+             0x4E00 ... 0x9FFF, 0xA000 ... 0xA4CF, 0xA960 ... 0xA97F,
+             0xAC00 ... 0xD7A3, 0xF900 ... 0xFAFF, 0xFE10 ... 0xFE19,
+             0xFE30 ... 0xFE6F, 0xFF00 ... 0xFF60, 0xFFE0 ... 0xFFE6,
+             0x1F300 ... 0x1F64F, 0x1F900 ... 0x1F9FF,
+             0x20000 ... 0x2FFFD, 0x30000 ... 0x3FFFD:
+            true
+        default:
+            false
+        }
+    }
+}
+
+// MARK: - TrueTypeTextGlyphMetrics
+
+/// Metrics read from the `cmap`, `hmtx`, `hhea` and `head` tables of a
+/// TrueType or OpenType font.
+///
+/// The advance of a grapheme cluster is the advance of the glyph of its
+/// first scalar, without shaping or kerning. Missing glyphs use the advance
+/// of glyph 0.
+package struct TrueTypeTextGlyphMetrics: TextGlyphMetrics {
+    /// The size the font is measured at.
+    package var pointSize: CGFloat
+
+    private let unitsPerEm: CGFloat
+
+    private let ascent: CGFloat
+
+    private let descent: CGFloat
+
+    private let lineGap: CGFloat
+
+    /// The advance widths of the glyphs, in font units. Glyphs past the end
+    /// use the last advance.
+    private let advanceWidths: [UInt16]
+
+    /// The sorted ranges of scalars mapped to consecutive glyphs.
+    private let characterMap: [(start: UInt32, end: UInt32, glyph: UInt32)]
+
+    /// Explicit glyphs of the scalars of format 4 ranges that don't map to
+    /// consecutive glyphs.
+    private let glyphOverrides: [UInt32: UInt32]
+
+    package enum Failure: Error, Equatable {
+        /// A required table is missing.
+        case missingTable(String)
+        /// A table is shorter than its contents.
+        case malformedTable(String)
+    }
+
+    /// Reads the metrics of the font in a local file.
+    ///
+    /// - Parameters:
+    ///   - url: The URL of a `.ttf` or `.otf` file.
+    ///   - pointSize: The size the font is measured at.
+    package init(contentsOf url: URL, pointSize: CGFloat) throws {
+        try self.init(data: Data(contentsOf: url, options: .mappedIfSafe), pointSize: pointSize)
+    }
+
+    /// Reads the metrics of a font.
+    ///
+    /// - Parameters:
+    ///   - data: The contents of a `.ttf` or `.otf` file.
+    ///   - pointSize: The size the font is measured at.
+    package init(data: Data, pointSize: CGFloat) throws {
+        let font = FontData(bytes: [UInt8](data))
+        let tables = try font.tableDirectory()
+        func table(_ tag: String) throws -> Int {
+            guard let offset = tables[tag] else {
+                throw Failure.missingTable(tag)
+            }
+            return offset
+        }
+        let head = try table("head")
+        let hhea = try table("hhea")
+        let hmtx = try table("hmtx")
+        let cmap = try table("cmap")
+
+        let unitsPerEm = try font.uint16(at: head + 18, table: "head")
+        guard unitsPerEm != 0 else {
+            throw Failure.malformedTable("head")
+        }
+        self.pointSize = pointSize
+        self.unitsPerEm = CGFloat(unitsPerEm)
+        self.ascent = CGFloat(try font.int16(at: hhea + 4, table: "hhea"))
+        self.descent = -CGFloat(try font.int16(at: hhea + 6, table: "hhea"))
+        self.lineGap = CGFloat(try font.int16(at: hhea + 8, table: "hhea"))
+        let metricCount = Int(try font.uint16(at: hhea + 34, table: "hhea"))
+        self.advanceWidths = try (0 ..< metricCount).map { index in
+            try font.uint16(at: hmtx + index * 4, table: "hmtx")
+        }
+        (characterMap, glyphOverrides) = try font.characterMap(at: cmap)
+    }
+
+    package var ascender: CGFloat {
+        ascent * pointSize / unitsPerEm
+    }
+
+    package var descender: CGFloat {
+        descent * pointSize / unitsPerEm
+    }
+
+    package var leading: CGFloat {
+        max(0, lineGap) * pointSize / unitsPerEm
+    }
+
+    package func advance(of character: Character) -> CGFloat {
+        guard let scalar = character.unicodeScalars.first,
+              let last = advanceWidths.last else {
+            return 0
+        }
+        let glyph = Int(glyph(for: scalar.value))
+        let width = glyph < advanceWidths.count ? advanceWidths[glyph] : last
+        return CGFloat(width) * pointSize / unitsPerEm
+    }
+
+    /// The glyph of a scalar, or 0 if the font has none.
+    package func glyph(for scalar: UInt32) -> UInt32 {
+        if let glyph = glyphOverrides[scalar] {
+            return glyph
+        }
+        var lower = 0
+        var upper = characterMap.count
+        while lower < upper {
+            let middle = (lower + upper) / 2
+            let range = characterMap[middle]
+            if scalar < range.start {
+                upper = middle
+            } else if scalar > range.end {
+                lower = middle + 1
+            } else {
+                return range.glyph &+ (scalar - range.start)
+            }
+        }
+        return 0
+    }
+
+    // MARK: - FontData
+
+    private struct FontData {
+        var bytes: [UInt8]
+
+        func uint16(at offset: Int, table: String) throws -> UInt16 {
+            guard offset >= 0, offset + 2 <= bytes.count else {
+                throw Failure.malformedTable(table)
+            }
+            return UInt16(bytes[offset]) << 8 | UInt16(bytes[offset + 1])
+        }
+
+        func int16(at offset: Int, table: String) throws -> Int16 {
+            Int16(bitPattern: try uint16(at: offset, table: table))
+        }
+
+        func uint32(at offset: Int, table: String) throws -> UInt32 {
+            UInt32(try uint16(at: offset, table: table)) << 16
+                | UInt32(try uint16(at: offset + 2, table: table))
+        }
+
+        /// The offsets of the tables, by tag.
+        func tableDirectory() throws -> [String: Int] {
+            let tableCount = Int(try uint16(at: 4, table: "sfnt"))
+            var tables: [String: Int] = [:]
+            for index in 0 ..< tableCount {
+                let record = 12 + index * 16
+                guard record + 16 <= bytes.count else {
+                    throw Failure.malformedTable("sfnt")
+                }
+                let tag = String(decoding: bytes[record ..< record + 4], as: UTF8.self)
+                tables[tag] = Int(try uint32(at: record + 8, table: "sfnt"))
+            }
+            return tables
+        }
+
+        /// Reads the best Unicode subtable of a `cmap` table: format 12
+        /// when there is one, format 4 otherwise.
+        func characterMap(at cmap: Int) throws -> ([(start: UInt32, end: UInt32, glyph: UInt32)], [UInt32: UInt32]) {
+            let subtableCount = Int(try uint16(at: cmap + 2, table: "cmap"))
+            var format4: Int?
+            for index in 0 ..< subtableCount {
+                let record = cmap + 4 + index * 8
+                let platform = try uint16(at: record, table: "cmap")
+                let encoding = try uint16(at: record + 2, table: "cmap")
+                let subtable = cmap + Int(try uint32(at: record + 4, table: "cmap"))
+                guard platform == 0 || (platform == 3 && (encoding == 1 || encoding == 10)) else {
+                    continue
+                }
+                switch try uint16(at: subtable, table: "cmap") {
+                case 12: return (try format12(at: subtable), [:])
+                case 4: format4 = format4 ?? subtable
+                default: break
+                }
+            }
+            guard let format4 else {
+                throw Failure.missingTable("cmap")
+            }
+            return try self.format4(at: format4)
+        }
+
+        private func format12(at subtable: Int) throws -> [(start: UInt32, end: UInt32, glyph: UInt32)] {
+            let groupCount = Int(try uint32(at: subtable + 12, table: "cmap"))
+            guard subtable + 16 + groupCount * 12 <= bytes.count else {
+                throw Failure.malformedTable("cmap")
+            }
+            return try (0 ..< groupCount).map { index in
+                let group = subtable + 16 + index * 12
+                return (
+                    try uint32(at: group, table: "cmap"),
+                    try uint32(at: group + 4, table: "cmap"),
+                    try uint32(at: group + 8, table: "cmap")
+                )
+            }
+        }
+
+        private func format4(at subtable: Int) throws -> ([(start: UInt32, end: UInt32, glyph: UInt32)], [UInt32: UInt32]) {
+            let segmentCount = Int(try uint16(at: subtable + 6, table: "cmap")) / 2
+            let endCodes = subtable + 14
+            let startCodes = endCodes + segmentCount * 2 + 2
+            let deltas = startCodes + segmentCount * 2
+            let rangeOffsets = deltas + segmentCount * 2
+            var ranges: [(start: UInt32, end: UInt32, glyph: UInt32)] = []
+            var overrides: [UInt32: UInt32] = [:]
+            for segment in 0 ..< segmentCount {
+                let end = try uint16(at: endCodes + segment * 2, table: "cmap")
+                let start = try uint16(at: startCodes + segment * 2, table: "cmap")
+                let delta = try uint16(at: deltas + segment * 2, table: "cmap")
+                let rangeOffsetPosition = rangeOffsets + segment * 2
+                let rangeOffset = Int(try uint16(at: rangeOffsetPosition, table: "cmap"))
+                guard start <= end, start != 0xFFFF else {
+                    continue
+                }
+                if rangeOffset == 0 {
+                    // Glyphs are the scalars shifted by the delta, modulo
+                    // 65536, so a range may wrap around.
+                    let firstGlyph = start &+ delta
+                    let wrapCount = UInt16.max - firstGlyph
+                    if end - start > wrapCount {
+                        let split = start + wrapCount
+                        ranges.append((UInt32(start), UInt32(split), UInt32(firstGlyph)))
+                        ranges.append((UInt32(split) + 1, UInt32(end), 0))
+                    } else {
+                        ranges.append((UInt32(start), UInt32(end), UInt32(firstGlyph)))
+                    }
+                } else {
+                    for scalar in start ... end {
+                        let position = rangeOffsetPosition + rangeOffset + Int(scalar - start) * 2
+                        let glyph = try uint16(at: position, table: "cmap")
+                        if glyph != 0 {
+                            overrides[UInt32(scalar)] = UInt32(glyph &+ delta)
+                        }
+                    }
+                }
+            }
+            return (ranges.sorted { $0.start < $1.start }, overrides)
+        }
+    }
+}
+
+/* OpenSwiftUI Addition End */
@@ -0,0 +1,246 @@
+//
+//  TextMetricsCache.swift
+//  OpenSwiftUICore
+//
+//  Status: Complete
+
+/* OpenSwiftUI Addition Begin */
+
+package import Foundation
+#if canImport(CoreText)
+import CoreText
+#endif
+import UIFoundation_Private
+
+// MARK: - TextMetricsCache
+
+/// A process-wide cache of text measurements, shared by every resolved text.
+///
+/// The metrics cache of a `ResolvedStyledText` is discarded whenever the
+/// text is resolved again, and each row of a list resolves its own copy of
+/// the same label. This cache keeps the measurements of attributed strings
+/// by a strong hash of their contents and the measurement parameters, so
+/// equal strings are measured once across instances.
+///
+/// Entries are evicted in least recently used order once their estimated
+/// size exceeds `byteLimit`. A hit is only returned for a string equal to
+/// the one that was measured, so a weak fingerprint of an attribute value
+/// can cost hits but never return the metrics of other text.
+///
+/// The cache is thread-safe: measurements run outside its lock, so threads
+/// measuring different text don't wait for each other.
+@available(OpenSwiftUI_v6_0, *)
+package final class TextMetricsCache {
+    /// The cache shared by every resolved text.
+    package static let shared = TextMetricsCache()
+
+    private let storage: AtomicBox<Storage>
+
+    /// Creates a cache.
+    ///
+    /// - Parameter byteLimit: The estimated size, in bytes, past which
+    ///   entries are evicted.
+    package init(byteLimit: Int = 4 << 20) {
+        storage = AtomicBox(wrappedValue: Storage(byteLimit: byteLimit))
+    }
+
+    /// The estimated size, in bytes, past which entries are evicted.
+    package var byteLimit: Int {
+        get { storage.access { $0.entries.costLimit } }
+        set { storage.access { $0.entries.costLimit = max(newValue, 0) } }
+    }
+
+    /// The counters of the lookups of the cache.
+    package var statistics: Statistics {
+        storage.access { storage in
+            var statistics = Statistics()
+            statistics.hits = storage.hits
+            statistics.misses = storage.misses
+            statistics.evictions = storage.entries.statistics.evictions
+            return statistics
+        }
+    }
+
+    /// The number of cached measurements.
+    package var count: Int {
+        storage.access { $0.entries.count }
+    }
+
+    /// The estimated size of the cached measurements, in bytes.
+    package var byteCount: Int {
+        storage.access { $0.entries.totalCost }
+    }
+
+    /// Returns the cached metrics of a measurement, measuring and caching
+    /// them on a miss.
+    ///
+    /// - Parameters:
+    ///   - key: The contents and parameters of the measurement.
+    ///   - string: The measured string, whose contents `key` hashes.
+    ///   - measure: A closure measuring `string`.
+    package func metrics(
+        for key: Key,
+        string: NSAttributedString,
+        measure: () -> NSAttributedString.Metrics
+    ) -> NSAttributedString.Metrics {
+        let cached = storage.access { $0.entries.value(forKey: key) }
+        if let cached, cached.string === string || cached.string.isEqual(to: string) {
+            storage.access { $0.hits += 1 }
+            return cached.metrics
+        }
+        let metrics = measure()
+        let value = Value(string: string.copy() as! NSAttributedString, metrics: metrics)
+        storage.access { storage in
+            storage.misses += 1
+            storage.entries.setValue(value, forKey: key, cost: Self.cost(of: string))
+        }
+        return metrics
+    }
+
+    /// Removes every cached measurement and resets the counters.
+    package func reset() {
+        storage.access { storage in
+            storage = Storage(byteLimit: storage.entries.costLimit)
+        }
+    }
+
+    /// The estimated size of an entry: the characters of its string and the
+    /// bookkeeping of the entry.
+    private static func cost(of string: NSAttributedString) -> Int {
+        string.length * MemoryLayout<UInt16>.size + 256
+    }
+
+    // MARK: - TextMetricsCache.Key
+
+    /// The contents and parameters of a measurement.
+    package struct Key: Hashable {
+        /// A strong hash of the string, its attributes and their ranges,
+        /// including the paragraph style.
+        package var contentHash: StrongHash
+
+        /// The width the string is measured in.
+        package var width: CGFloat
+
+        /// The height the string is measured in.
+        package var height: CGFloat
+
+        package var lineLimit: Int?
+
+        package var lowerLineLimit: Int?
+
+        package var minScaleFactor: CGFloat
+
+        package var bodyHeadOutdent: CGFloat
+
+        package var widthIsFlexible: Bool
+
+        package var isCollapsible: Bool
+
+        package var wantsNumberOfLineFragments: Bool
+
+        package init(
+            contentHash: StrongHash,
+            width: CGFloat,
+            height: CGFloat,
+            lineLimit: Int?,
+            lowerLineLimit: Int?,
+            minScaleFactor: CGFloat,
+            bodyHeadOutdent: CGFloat,
+            widthIsFlexible: Bool,
+            isCollapsible: Bool,
+            wantsNumberOfLineFragments: Bool
+        ) {
+            self.contentHash = contentHash
+            self.width = width
+            self.height = height
+            self.lineLimit = lineLimit
+            self.lowerLineLimit = lowerLineLimit
+            self.minScaleFactor = minScaleFactor
+            self.bodyHeadOutdent = bodyHeadOutdent
+            self.widthIsFlexible = widthIsFlexible
+            self.isCollapsible = isCollapsible
+            self.wantsNumberOfLineFragments = wantsNumberOfLineFragments
+        }
+    }
+
+    package typealias Statistics = LRUCacheStatistics
+
+    // MARK: - Storage
+
+    private struct Value {
+        var string: NSAttributedString
+
+        var metrics: NSAttributedString.Metrics
+    }
+
+    private struct Storage {
+        var entries: LRUCache<Key, Value>
+
+        var hits = 0
+
+        var misses = 0
+
+        init(byteLimit: Int) {
+            entries = LRUCache(costLimit: byteLimit)
+        }
+    }
+}
+
+// MARK: - NSAttributedString + contentHash
+
+extension NSAttributedString {
+    /// A strong hash of the string, and of the ranges, names and values of
+    /// its attributes.
+    ///
+    /// Fonts are hashed by name and size, paragraph styles by the properties
+    /// that affect layout, and other objects by their `hash`, so equal
+    /// strings built separately hash alike.
+    package var contentHash: StrongHash {
+        var hasher = StrongHasher()
+        hasher.combine(string)
+        enumerateAttributes(in: NSRange(location: 0, length: length)) { attributes, range, _ in
+            hasher.combine(range.location)
+            hasher.combine(range.length)
+            for (name, value) in attributes.sorted(by: { $0.key.rawValue < $1.key.rawValue }) {
+                hasher.combine(name.rawValue)
+                Self.combineAttributeValue(value, into: &hasher)
+            }
+        }
+        return hasher.finalize()
+    }
+
+    private static func combineAttributeValue(_ value: Any, into hasher: inout StrongHasher) {
+        hasher.combine(String(reflecting: type(of: value)))
+        #if canImport(CoreText)
+        if CFGetTypeID(value as AnyObject) == CTFontGetTypeID() {
+            let font = value as! CTFont
+            hasher.combine(CTFontCopyPostScriptName(font) as String)
+            hasher.combine(Double(CTFontGetSize(font)))
+            return
+        }
+        #endif
+        switch value {
+        case let style as NSParagraphStyle:
+            hasher.combine(style.lineBreakMode.rawValue)
+            hasher.combine(style.baseWritingDirection.rawValue)
+            hasher.combine(Double(style.lineSpacing))
+            hasher.combine(Double(style.lineHeightMultiple))
+            hasher.combine(Double(style.minimumLineHeight))
+            hasher.combine(Double(style.maximumLineHeight))
+            hasher.combine(Double(style.firstLineHeadIndent))
+            hasher.combine(style.hyphenationFactor)
+        case let string as String:
+            hasher.combine(string)
+        case let object as NSObject:
+            hasher.combine(object.hash)
+        case let value as AnyHashable:
+            hasher.combine(value.hashValue)
+        default:
+            // Equal strings are still told apart by `isEqual(to:)`, so an
+            // unhashable value only costs cache hits.
+            break
+        }
+    }
+}
+
+/* OpenSwiftUI Addition End */
@@ -17,6 +17,74 @@
 extern pthread_t pthread_main_thread_np(void);
 #endif
 
+#define MOVABLE_LOCK_SUPPORTED (OPENSWIFTUI_TARGET_OS_DARWIN || OPENSWIFTUI_TARGET_OS_LINUX)
+
+#if OPENSWIFTUI_TARGET_OS_LINUX
+#include <limits.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+// glibc has no pthread_main_thread_np, and the library may be loaded from
+// any thread. The main thread is the one whose thread ID is the process
+// ID, so capture it the first time it is seen. Until then it is zero.
+static pthread_t _main_thread;
+
+static inline pthread_t pthread_main_thread_np(void) {
+    pthread_t main_thread = __atomic_load_n(&_main_thread, __ATOMIC_ACQUIRE);
+    if (!main_thread && syscall(SYS_gettid) == getpid()) {
+        main_thread = pthread_self();
+        __atomic_store_n(&_main_thread, main_thread, __ATOMIC_RELEASE);
+    }
+    return main_thread;
+}
+
+// The owner holds the mutex, so contending threads queue on the mutex,
+// which glibc doesn't hand off in order. Threads other than the main one
+// first take a ticket and wait, outside the mutex, until it is served;
+// the ticket is served again when its holder releases the lock. The main
+// thread bypasses the queue so that it can always run syncMain callbacks.
+static inline void take_ticket(MovableLock lock) {
+    uint32_t ticket = __atomic_fetch_add(&lock->next_ticket, 1, __ATOMIC_RELAXED);
+    for (;;) {
+        uint32_t serving = __atomic_load_n(&lock->serving_ticket, __ATOMIC_ACQUIRE);
+        if (serving == ticket) {
+            return;
+        }
+        syscall(SYS_futex, &lock->serving_ticket, FUTEX_WAIT_PRIVATE, serving, NULL, NULL, 0);
+    }
+}
+
+static inline void serve_next_ticket(MovableLock lock) {
+    __atomic_fetch_add(&lock->serving_ticket, 1, __ATOMIC_RELEASE);
+    syscall(SYS_futex, &lock->serving_ticket, FUTEX_WAKE_PRIVATE, INT_MAX, NULL, NULL, 0);
+}
+#endif
+
+#if MOVABLE_LOCK_SUPPORTED
+// Returns the main thread of a lock, which may be created before the main
+// thread is known outside Darwin.
+static inline pthread_t lock_main_thread(MovableLock lock) {
+    #if OPENSWIFTUI_TARGET_OS_LINUX
+    if (!lock->main_thread) {
+        lock->main_thread = pthread_main_thread_np();
+    }
+    #endif
+    return lock->main_thread;
+}
+
+static inline void signal_main_thread(MovableLock lock) {
+    #if OPENSWIFTUI_TARGET_OS_DARWIN
+    pthread_cond_signal_thread_np(&lock->lock_condition, lock->main_thread);
+    #else
+    // No directed signal outside Darwin. Wake every waiter instead: the main
+    // thread picks up the pending callback and the others go back to sleep
+    // because the lock is still owned.
+    pthread_cond_broadcast(&lock->lock_condition);
+    #endif
+}
+#endif
+
 static void wait_for_lock(MovableLock lock, pthread_t thread);
 static void sync_main_callback(MovableLock lock);
 
@@ -32,7 +100,7 @@ MovableLock _MovableLockCreate() {
     pthread_cond_init(&lock->lock_condition, NULL);
     pthread_cond_init(&lock->main_callback_condition, NULL);
     pthread_cond_init(&lock->broadcast_condition, NULL);
-    #if OPENSWIFTUI_TARGET_OS_DARWIN
+    #if MOVABLE_LOCK_SUPPORTED
     lock->main_thread = pthread_main_thread_np();
     #endif
     return lock;
@@ -57,24 +125,34 @@ bool _MovableLockIsOutermostOwner(MovableLock lock) {
 }
 
 void _MovableLockLock(MovableLock lock) {
-    #if OPENSWIFTUI_TARGET_OS_DARWIN
+    #if MOVABLE_LOCK_SUPPORTED
     pthread_t owner = pthread_self();
     if (owner == lock->owner_thread) {
         lock->lock_level += 1;
         return;
     }
+    #if OPENSWIFTUI_TARGET_OS_LINUX
+    bool has_ticket = owner != pthread_main_thread_np();
+    if (has_ticket) {
+        take_ticket(lock);
+    }
+    #endif
     pthread_mutex_lock(&lock->mutex);
+    lock_main_thread(lock);
     while (lock->owner_thread) {
         [[clang::noinline]]
         wait_for_lock(lock, owner);
     }
     lock->owner_thread = owner;
     lock->lock_level = 1;
+    #if OPENSWIFTUI_TARGET_OS_LINUX
+    lock->owner_has_ticket = has_ticket;
+    #endif
     #endif
 }
 
 void _MovableLockUnlock(MovableLock lock) {
-    #if OPENSWIFTUI_TARGET_OS_DARWIN
+    #if MOVABLE_LOCK_SUPPORTED
     lock->lock_level -= 1;
     if (lock->lock_level != 0) {
         return;
@@ -82,25 +160,34 @@ void _MovableLockUnlock(MovableLock lock) {
     if (lock->waiter_count != 0) {
         pthread_cond_signal(&lock->lock_condition);
     }
-    lock->owner_thread = NULL;
+    lock->owner_thread = (pthread_t)0;
+    #if OPENSWIFTUI_TARGET_OS_LINUX
+    bool has_ticket = lock->owner_has_ticket;
+    lock->owner_has_ticket = false;
     pthread_mutex_unlock(&lock->mutex);
+    if (has_ticket) {
+        serve_next_ticket(lock);
+    }
+    #else
+    pthread_mutex_unlock(&lock->mutex);
+    #endif
     #endif
 }
 
 void _MovableLockSyncMain(MovableLock lock, const void *main_callback_context, void (*main_callback)(const void *main_callback_context)) {
-    #if OPENSWIFTUI_TARGET_OS_DARWIN
-    if (pthread_self() == lock->main_thread) {
+    #if MOVABLE_LOCK_SUPPORTED
+    if (pthread_self() == lock_main_thread(lock)) {
         main_callback(main_callback_context);
     } else {
         lock->main_callback = main_callback;
         lock->main_callback_context = main_callback_context;
         if (lock->main_thread_waiting) {
-            pthread_cond_signal_thread_np(&lock->lock_condition, lock->main_thread);
+            signal_main_thread(lock);
         } else if (!lock->main_callback_pending) {
             lock->main_callback_pending = true;
             dispatch_async_f(dispatch_get_main_queue(), lock, (dispatch_function_t)&sync_main_callback);
             if (lock->main_thread_waiting) {
-                pthread_cond_signal_thread_np(&lock->lock_condition, lock->main_thread);
+                signal_main_thread(lock);
             }
         }
         while (lock->main_callback) {
@@ -111,11 +198,19 @@ void _MovableLockSyncMain(MovableLock lock, const void *main_callback_context, v
 }
 
 void _MovableLockWait(MovableLock lock) {
-    #if OPENSWIFTUI_TARGET_OS_DARWIN
+    #if MOVABLE_LOCK_SUPPORTED
     pthread_t owner = pthread_self();
     uint32_t level = lock->lock_level;
     lock->lock_level = 0;
-    lock->owner_thread = NULL;
+    lock->owner_thread = (pthread_t)0;
+    #if OPENSWIFTUI_TARGET_OS_LINUX
+    // Let the next queued thread in while waiting. The lock is taken back
+    // below without a ticket, since this thread already holds the mutex.
+    if (lock->owner_has_ticket) {
+        lock->owner_has_ticket = false;
+        serve_next_ticket(lock);
+    }
+    #endif
     if (lock->waiter_count != 0) {
         pthread_cond_broadcast(&lock->lock_condition);
     }
@@ -130,13 +225,13 @@ void _MovableLockWait(MovableLock lock) {
 }
 
 void _MovableLockBroadcast(MovableLock lock) {
-    #if OPENSWIFTUI_TARGET_OS_DARWIN
+    #if MOVABLE_LOCK_SUPPORTED
     pthread_cond_broadcast(&lock->broadcast_condition);
     #endif
 }
 
 static void wait_for_lock(MovableLock lock, pthread_t owner) {
-    #if OPENSWIFTUI_TARGET_OS_DARWIN
+    #if MOVABLE_LOCK_SUPPORTED
     lock->waiter_count += 1;
     if (lock->main_thread == owner) {
         lock->main_thread_waiting = true;
@@ -165,7 +260,7 @@ static void wait_for_lock(MovableLock lock, pthread_t owner) {
 }
 
 static void sync_main_callback(MovableLock lock) {
-    #if OPENSWIFTUI_TARGET_OS_DARWIN
+    #if MOVABLE_LOCK_SUPPORTED
     [[clang::noinline]]
     _MovableLockLock(lock);
     lock->main_callback_pending = false;
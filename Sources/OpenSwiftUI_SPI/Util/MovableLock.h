@@ -26,6 +26,11 @@ typedef struct MovableLock_s {
     const void * _Nullable main_callback_context;
     bool main_callback_pending;
     bool main_thread_waiting;
+    #if OPENSWIFTUI_TARGET_OS_LINUX
+    bool owner_has_ticket;
+    uint32_t next_ticket;
+    uint32_t serving_ticket;
+    #endif
 } MovableLock_t;
 
 typedef MovableLock_t *MovableLock __attribute((swift_newtype(struct)));
@@ -0,0 +1,456 @@
+//
+//  PathString.c
+//  OpenSwiftUI_SPI
+
+#if !defined(__APPLE__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+
+#include "PathString.h"
+
+#include <locale.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if OPENSWIFTUI_TARGET_OS_DARWIN
+#include <xlocale.h>
+#else
+#include <pthread.h>
+#endif
+
+// MARK: - Locale
+
+#if OPENSWIFTUI_TARGET_OS_DARWIN
+// A NULL locale is the C locale for the xlocale functions.
+#define PATH_STRING_C_LOCALE NULL
+#else
+static locale_t path_string_c_locale;
+static pthread_once_t path_string_c_locale_once = PTHREAD_ONCE_INIT;
+
+static void path_string_c_locale_init(void) {
+    path_string_c_locale = newlocale(LC_ALL_MASK, "C", (locale_t)0);
+}
+
+static locale_t path_string_get_c_locale(void) {
+    pthread_once(&path_string_c_locale_once, &path_string_c_locale_init);
+    return path_string_c_locale;
+}
+#define PATH_STRING_C_LOCALE path_string_get_c_locale()
+#endif
+
+// MARK: - Numbers
+
+static const double powers_of_ten[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+
+static inline bool is_digit(char c) {
+    return (unsigned char)(c - '0') < 10;
+}
+
+static const char *parse_number_slow(const char *ptr, double *value) {
+    char *end;
+    *value = strtod_l(ptr, &end, PATH_STRING_C_LOCALE);
+    return end;
+}
+
+// Parses a decimal number exactly when both its significand and the power
+// of ten it is scaled by are exact doubles, and defers to strtod otherwise.
+// Returns the end of the number, or ptr if there is no number.
+static const char *parse_number(const char *ptr, double *value) {
+    const char *p = ptr;
+    bool negative = false;
+    if (*p == '+' || *p == '-') {
+        negative = *p == '-';
+        p++;
+    }
+    uint64_t significand = 0;
+    int significant_digits = 0;
+    int exponent = 0;
+    bool has_digits = false;
+    while (is_digit(*p)) {
+        has_digits = true;
+        if (significand != 0 || *p != '0') {
+            if (++significant_digits > 19) {
+                return parse_number_slow(ptr, value);
+            }
+        }
+        significand = significand * 10 + (uint64_t)(*p - '0');
+        p++;
+    }
+    if (*p == '.') {
+        p++;
+        while (is_digit(*p)) {
+            has_digits = true;
+            if (significand != 0 || *p != '0') {
+                if (++significant_digits > 19) {
+                    return parse_number_slow(ptr, value);
+                }
+            }
+            significand = significand * 10 + (uint64_t)(*p - '0');
+            exponent--;
+            p++;
+        }
+    }
+    if (!has_digits) {
+        // Inf, hexadecimal floats and the like.
+        return parse_number_slow(ptr, value);
+    }
+    if (*p == 'e' || *p == 'E') {
+        const char *q = p + 1;
+        bool negative_exponent = false;
+        if (*q == '+' || *q == '-') {
+            negative_exponent = *q == '-';
+            q++;
+        }
+        if (is_digit(*q)) {
+            int explicit_exponent = 0;
+            while (is_digit(*q)) {
+                if (explicit_exponent < 10000) {
+                    explicit_exponent = explicit_exponent * 10 + (*q - '0');
+                }
+                q++;
+            }
+            exponent += negative_exponent ? -explicit_exponent : explicit_exponent;
+            p = q;
+        }
+    }
+    if (*p == '.' || *p == 'x' || *p == 'X' || *p == 'p' || *p == 'P') {
+        return parse_number_slow(ptr, value);
+    }
+    if (significand > (UINT64_C(1) << 53) || exponent < -22 || exponent > 22) {
+        if (significand != 0) {
+            return parse_number_slow(ptr, value);
+        }
+        exponent = 0;
+    }
+    double result = (double)significand;
+    if (exponent >= 0) {
+        result *= powers_of_ten[exponent];
+    } else {
+        result /= powers_of_ten[-exponent];
+    }
+    *value = negative ? -result : result;
+    return p;
+}
+
+// MARK: - Parsing
+
+#define PATH_STRING_EMIT(element, ...) do { \
+    const double points[] = { __VA_ARGS__ }; \
+    if (!callback(info, (element), points)) { \
+        return false; \
+    } \
+} while (0)
+
+bool _PathParseString(const char *utf8CString, void *info, PathStringCallback callback) {
+    double numbers[6];
+    int count = 0;
+    double currentX = 0.0, currentY = 0.0;
+    double lastControlX = 0.0, lastControlY = 0.0;
+    const char *ptr = utf8CString;
+    for (;;) {
+        switch (*ptr) {
+            case 0:
+                return true;
+            case '\t': case '\n': case '\f': case '\r': case ' ':
+                ptr++;
+                continue;
+            case 'I':
+                if (ptr[1] != 'n' || ptr[2] != 'f') {
+                    return false;
+                }
+                // Inf is parsed as a number.
+                __attribute__((fallthrough));
+            case '+': case '-': case '.': case '0' ... '9':
+            case 'E': case 'P': case 'X': case 'e': case 'p': case 'x': {
+                if (count == 6) {
+                    return false;
+                }
+                const char *end = parse_number(ptr, &numbers[count]);
+                if (end == ptr) {
+                    return false;
+                }
+                count++;
+                ptr = end;
+                continue;
+            }
+            case 'm':
+                if (count != 2) {
+                    return false;
+                }
+                PATH_STRING_EMIT(PathStringElementMoveToPoint, numbers[0], numbers[1]);
+                currentX = lastControlX = numbers[0];
+                currentY = lastControlY = numbers[1];
+                break;
+            case 'l':
+                if (count != 2) {
+                    return false;
+                }
+                PATH_STRING_EMIT(PathStringElementAddLineToPoint, numbers[0], numbers[1]);
+                currentX = lastControlX = numbers[0];
+                currentY = lastControlY = numbers[1];
+                break;
+            case 'c':
+                if (count != 6) {
+                    return false;
+                }
+                PATH_STRING_EMIT(PathStringElementAddCurveToPoint,
+                                 numbers[0], numbers[1],
+                                 numbers[2], numbers[3],
+                                 numbers[4], numbers[5]);
+                lastControlX = numbers[2];
+                lastControlY = numbers[3];
+                currentX = numbers[4];
+                currentY = numbers[5];
+                break;
+            case 'q':
+                if (count != 4) {
+                    return false;
+                }
+                PATH_STRING_EMIT(PathStringElementAddQuadCurveToPoint,
+                                 numbers[0], numbers[1],
+                                 numbers[2], numbers[3]);
+                lastControlX = numbers[0];
+                lastControlY = numbers[1];
+                currentX = numbers[2];
+                currentY = numbers[3];
+                break;
+            case 't': {
+                if (count != 2) {
+                    return false;
+                }
+                double reflectedX = currentX * 2.0 - lastControlX;
+                double reflectedY = currentY * 2.0 - lastControlY;
+                PATH_STRING_EMIT(PathStringElementAddQuadCurveToPoint,
+                                 reflectedX, reflectedY,
+                                 numbers[0], numbers[1]);
+                lastControlX = reflectedX;
+                lastControlY = reflectedY;
+                currentX = numbers[0];
+                currentY = numbers[1];
+                break;
+            }
+            case 'v':
+                if (count != 4) {
+                    return false;
+                }
+                PATH_STRING_EMIT(PathStringElementAddCurveToPoint,
+                                 currentX, currentY,
+                                 numbers[0], numbers[1],
+                                 numbers[2], numbers[3]);
+                lastControlX = numbers[0];
+                lastControlY = numbers[1];
+                currentX = numbers[2];
+                currentY = numbers[3];
+                break;
+            case 'y':
+                if (count != 4) {
+                    return false;
+                }
+                PATH_STRING_EMIT(PathStringElementAddCurveToPoint,
+                                 numbers[0], numbers[1],
+                                 numbers[2], numbers[3],
+                                 numbers[2], numbers[3]);
+                lastControlX = numbers[2];
+                lastControlY = numbers[3];
+                break;
+            case 'h':
+                if (count != 0) {
+                    return false;
+                }
+                if (!callback(info, PathStringElementCloseSubpath, numbers)) {
+                    return false;
+                }
+                lastControlX = 0.0;
+                lastControlY = 0.0;
+                break;
+            case 'r': {
+                if (ptr[1] != 'e' || count != 4) {
+                    return false;
+                }
+                double minX = numbers[0], minY = numbers[1];
+                double maxX = minX + numbers[2], maxY = minY + numbers[3];
+                PATH_STRING_EMIT(PathStringElementMoveToPoint, minX, minY);
+                PATH_STRING_EMIT(PathStringElementAddLineToPoint, maxX, minY);
+                PATH_STRING_EMIT(PathStringElementAddLineToPoint, maxX, maxY);
+                PATH_STRING_EMIT(PathStringElementAddLineToPoint, minX, maxY);
+                if (!callback(info, PathStringElementCloseSubpath, numbers)) {
+                    return false;
+                }
+                ptr++;
+                break;
+            }
+            default:
+                return false;
+        }
+        count = 0;
+        ptr++;
+    }
+}
+
+#undef PATH_STRING_EMIT
+
+#if OPENSWIFTUI_CF_CGTYPES
+static bool path_storage_append(void *info, PathStringElement element, const double *points) {
+    CGFloat cgPoints[6];
+    int count;
+    switch (element) {
+        case PathStringElementMoveToPoint: case PathStringElementAddLineToPoint: count = 2; break;
+        case PathStringElementAddQuadCurveToPoint: count = 4; break;
+        case PathStringElementAddCurveToPoint: count = 6; break;
+        default: count = 0; break;
+    }
+    for (int i = 0; i < count; i++) {
+        cgPoints[i] = (CGFloat)points[i];
+    }
+    #if OPENSWIFTUI_RENDERBOX
+    RBPathStorageAppendElement((RBPathStorageRef)info, (RBPathElement)element, cgPoints, NULL);
+    #else
+    ORBPathStorageAppendElement((ORBPathStorageRef)info, (ORBPathElement)element, cgPoints, NULL);
+    #endif
+    return true;
+}
+
+#if OPENSWIFTUI_RENDERBOX
+bool _PathStorageParseString(RBPathStorageRef storage, const char *utf8CString) {
+#else
+bool _PathStorageParseString(ORBPathStorageRef storage, const char *utf8CString) {
+#endif
+    return _PathParseString(utf8CString, (void *)storage, &path_storage_append);
+}
+#endif
+
+// MARK: - Description
+
+static bool path_description_reserve(PathDescription *description, size_t additional) {
+    size_t required = description->length + additional;
+    if (required <= description->capacity) {
+        return true;
+    }
+    size_t capacity = description->capacity < 64 ? 64 : description->capacity;
+    while (capacity < required) {
+        capacity *= 2;
+    }
+    char *bytes = realloc(description->bytes, capacity);
+    if (bytes == NULL) {
+        return false;
+    }
+    description->bytes = bytes;
+    description->capacity = capacity;
+    return true;
+}
+
+static void path_description_append(PathDescription *description, const char *bytes, size_t length) {
+    if (!path_description_reserve(description, length)) {
+        return;
+    }
+    memcpy(description->bytes + description->length, bytes, length);
+    description->length += length;
+}
+
+// Formats a coordinate like "%g " in the C locale, writing integers below
+// one million, the common case of rounded coordinates, without printf.
+static void path_description_append_coordinate(PathDescription *description, double value) {
+    if (description->step != 0.0) {
+        value = description->step * round(value * description->inverseStep);
+    }
+    char buffer[64];
+    size_t length;
+    if (value == trunc(value) && fabs(value) < 1e6) {
+        char digits[8];
+        size_t digit_count = 0;
+        long magnitude = labs((long)value);
+        do {
+            digits[digit_count++] = (char)('0' + magnitude % 10);
+            magnitude /= 10;
+        } while (magnitude != 0);
+        length = 0;
+        if (signbit(value)) {
+            buffer[length++] = '-';
+        }
+        while (digit_count != 0) {
+            buffer[length++] = digits[--digit_count];
+        }
+        buffer[length++] = ' ';
+    } else {
+        #if OPENSWIFTUI_TARGET_OS_DARWIN
+        int result = snprintf_l(buffer, sizeof(buffer), NULL, "%g ", value);
+        #else
+        locale_t previous = uselocale(PATH_STRING_C_LOCALE);
+        int result = snprintf(buffer, sizeof(buffer), "%g ", value);
+        uselocale(previous);
+        #endif
+        if (result <= 0) {
+            return;
+        }
+        length = (size_t)result < sizeof(buffer) ? (size_t)result : sizeof(buffer) - 1;
+    }
+    path_description_append(description, buffer, length);
+}
+
+PathDescription _PathDescriptionMake(double step) {
+    PathDescription description = {
+        NULL,
+        0,
+        0,
+        step,
+        1.0 / step,
+    };
+    return description;
+}
+
+void _PathDescriptionAppendElement(PathDescription *description, PathStringElement element, const double *points) {
+    int count;
+    char command;
+    switch (element) {
+        case PathStringElementMoveToPoint:
+            count = 1;
+            command = 'm';
+            break;
+        case PathStringElementAddLineToPoint:
+            count = 1;
+            command = 'l';
+            break;
+        case PathStringElementAddQuadCurveToPoint:
+            count = 2;
+            command = 'q';
+            break;
+        case PathStringElementAddCurveToPoint:
+            count = 3;
+            command = 'c';
+            break;
+        case PathStringElementCloseSubpath:
+            count = 0;
+            command = 'h';
+            break;
+        default:
+            return;
+    }
+    if (count != 0 && points == NULL) {
+        return;
+    }
+    path_description_append(description, " ", 1);
+    for (int i = 0; i < count * 2; i++) {
+        path_description_append_coordinate(description, points[i]);
+    }
+    path_description_append(description, &command, 1);
+}
+
+const char *_PathDescriptionGetCString(PathDescription *description) {
+    if (!path_description_reserve(description, 1)) {
+        return "";
+    }
+    description->bytes[description->length] = '\0';
+    return description->bytes;
+}
+
+void _PathDescriptionDestroy(PathDescription *description) {
+    free(description->bytes);
+    description->bytes = NULL;
+    description->length = 0;
+    description->capacity = 0;
+}
@@ -0,0 +1,91 @@
+//
+//  PathString.h
+//  OpenSwiftUI_SPI
+
+#ifndef PathString_h
+#define PathString_h
+
+#include "OpenSwiftUIBase.h"
+#include <stddef.h>
+
+#if OPENSWIFTUI_CF_CGTYPES
+#if OPENSWIFTUI_RENDERBOX
+#include <RenderBox/RenderBox.h>
+#else
+#include <OpenRenderBox/OpenRenderBox.h>
+#endif
+#endif
+
+OPENSWIFTUI_ASSUME_NONNULL_BEGIN
+
+/// The elements of a path string, with the values of `CGPathElementType`.
+typedef OPENSWIFTUI_ENUM(int32_t, PathStringElement) {
+    PathStringElementMoveToPoint = 0,
+    PathStringElementAddLineToPoint = 1,
+    PathStringElementAddQuadCurveToPoint = 2,
+    PathStringElementAddCurveToPoint = 3,
+    PathStringElementCloseSubpath = 4,
+};
+
+/// Receives an element of a parsed path string and its points: one for a
+/// move or line, the control point then the end point of a quadratic curve,
+/// both control points then the end point of a cubic curve, none for a
+/// close.
+///
+/// - Returns: `false` to stop parsing and fail.
+typedef bool (*PathStringCallback)(void * _Nullable info, PathStringElement element, const double *points);
+
+/// Parses a path string, the format of `_CGPathParseString`, without
+/// CoreGraphics.
+///
+/// Commands follow their space-separated numbers: `m` (x y), `l` (x y),
+/// `c` (cp1x cp1y cp2x cp2y x y), `q` (cpx cpy x y), `t` (x y, reflecting
+/// the previous control point), `v` (cp2x cp2y x y, from the current
+/// point), `y` (cp1x cp1y x y, ending at the second control point), `h`
+/// and `re` (x y width height). Decimal numbers are converted exactly
+/// without `strtod` when they have at most 19 significant digits and a
+/// small exponent, which covers coordinates written by
+/// `_PathDescriptionAppendElement`.
+///
+/// - Returns: `true` if the whole string was parsed, `false` if it is
+///   malformed or the callback stopped parsing.
+bool _PathParseString(const char *utf8CString, void * _Nullable info, PathStringCallback callback);
+
+#if OPENSWIFTUI_CF_CGTYPES
+/// Parses a path string straight into path storage, appending an element
+/// for each command.
+#if OPENSWIFTUI_RENDERBOX
+bool _PathStorageParseString(RBPathStorageRef storage, const char *utf8CString);
+#else
+bool _PathStorageParseString(ORBPathStorageRef storage, const char *utf8CString);
+#endif
+#endif
+
+/// A path string being written, the format of `_CGPathCopyDescription`.
+typedef struct PathDescription {
+    char * _Nullable bytes;
+    size_t length;
+    size_t capacity;
+    double step;
+    double inverseStep;
+} PathDescription;
+
+/// Creates an empty description.
+///
+/// - Parameter step: The rounding step for coordinates. When non-zero,
+///   coordinates are rounded to the nearest multiple of this value.
+PathDescription _PathDescriptionMake(double step) OPENSWIFTUI_SWIFT_NAME(PathDescription.init(step:));
+
+/// Appends an element and its points, in the order of `PathStringCallback`.
+void _PathDescriptionAppendElement(PathDescription *description, PathStringElement element, const double * _Nullable points) OPENSWIFTUI_SWIFT_NAME(PathDescription.append(self:element:points:));
+
+/// The null-terminated string written so far, valid until the description
+/// is next changed.
+const char *_PathDescriptionGetCString(PathDescription *description) OPENSWIFTUI_SWIFT_NAME(PathDescription.cString(self:));
+
+/// Frees the bytes of the description.
+void _PathDescriptionDestroy(PathDescription *description) OPENSWIFTUI_SWIFT_NAME(PathDescription.destroy(self:));
+
+OPENSWIFTUI_ASSUME_NONNULL_END
+
+#endif /* PathString_h */
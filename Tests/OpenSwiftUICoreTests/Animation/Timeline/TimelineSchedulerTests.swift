@@ -0,0 +1,72 @@
+//
+//  TimelineSchedulerTests.swift
+//  OpenSwiftUICoreTests
+
+@testable import OpenSwiftUICore
+import Testing
+
+struct TimelineSchedulerTests {
+    @Test
+    func coalescing() {
+        let scheduler = TimelineScheduler(tolerance: 0.1)
+        let ids = (0 ..< 4).map { _ in UniqueID() }
+        scheduler.schedule(ids[0], at: Time(seconds: 1.02), interval: 1)
+        scheduler.schedule(ids[1], at: Time(seconds: 1.00), interval: 1)
+        scheduler.schedule(ids[2], at: Time(seconds: 1.05), interval: 1)
+        // Outside the tolerance of the earliest deadline.
+        scheduler.schedule(ids[3], at: Time(seconds: 1.50), interval: 1)
+        #expect(scheduler.count == 4)
+        #expect(scheduler.wakeTime == Time(seconds: 1.00) + 0.1)
+
+        scheduler.advance(to: scheduler.wakeTime)
+        #expect(scheduler.count == 1)
+        #expect(scheduler.wakeTime == Time(seconds: 1.50) + 0.1)
+        #expect(scheduler.statistics.wakeups == 1)
+        #expect(scheduler.statistics.deadlines == 3)
+        #expect(scheduler.statistics.savedWakeups == 2)
+
+        scheduler.advance(to: Time(seconds: 1.6))
+        #expect(scheduler.count == 0)
+        #expect(scheduler.wakeTime == .infinity)
+        #expect(scheduler.statistics.savedWakeups == 2)
+    }
+
+    @Test
+    func intervalLimitsTolerance() {
+        let scheduler = TimelineScheduler(tolerance: 0.1)
+        let slow = UniqueID()
+        let fast = UniqueID()
+        scheduler.schedule(slow, at: Time(seconds: 1), interval: 60)
+        scheduler.schedule(fast, at: Time(seconds: 1.05), interval: 0.1)
+        // The fast timeline can only be delayed by a tenth of its interval,
+        // so it ends the window of the slow one early.
+        #expect(scheduler.wakeTime == Time(seconds: 1.05) + 0.1 * 0.1)
+    }
+
+    @Test
+    func rescheduleAndCancel() {
+        let scheduler = TimelineScheduler(tolerance: 0)
+        let ids = (0 ..< 16).map { _ in UniqueID() }
+        for (index, id) in ids.enumerated() {
+            scheduler.schedule(id, at: Time(seconds: Double(index + 1)), interval: 1)
+        }
+        scheduler.schedule(ids[15], at: Time(seconds: 0.5), interval: 1)
+        #expect(scheduler.wakeTime == Time(seconds: 0.5))
+        scheduler.cancel(ids[15])
+        scheduler.cancel(ids[0])
+        scheduler.cancel(ids[0])
+        #expect(scheduler.count == 14)
+        #expect(scheduler.wakeTime == Time(seconds: 2))
+        scheduler.schedule(ids[1], at: Time(seconds: 20), interval: 1)
+        #expect(scheduler.wakeTime == Time(seconds: 3))
+
+        var served: [Time] = []
+        while scheduler.wakeTime != .infinity {
+            let time = scheduler.wakeTime
+            scheduler.advance(to: time)
+            served.append(time)
+        }
+        #expect(served == (3 ... 15).map { Time(seconds: Double($0)) } + [Time(seconds: 20)])
+        #expect(scheduler.statistics.savedWakeups == 0)
+    }
+}
@@ -21,4 +21,22 @@ struct CachedEnvironmentTests {
         let attribute2 = env.attribute(id: .layoutDirection) { $0.layoutDirection }
         #expect(attribute1 == attribute2)
     }
+
+    @Test
+    func manyAttributes() {
+        let graph = Graph(shared: Graph())
+        let globalSubgraph = Subgraph(graph: graph)
+        Subgraph.current = globalSubgraph
+        defer { Subgraph.current = nil }
+        var env = CachedEnvironment(.init(value: .init()))
+        let ids = (0 ..< 100).map { _ in CachedEnvironment.ID() }
+        let attributes = ids.enumerated().map { index, id in
+            env.attribute(id: id) { _ in index }
+        }
+        #expect(env.mapCount == 100)
+        for (id, attribute) in zip(ids, attributes).reversed() {
+            #expect(env.attribute(id: id) { _ in -1 } == attribute)
+        }
+        #expect(env.mapCount == 100)
+    }
 }
@@ -98,6 +98,75 @@ struct ProtobufDecoderTests {
         #expect(try "0a020010".decodePBHexString(PackedIntMessage.self).values == [0, 8])
     }
     
+    @Test
+    func varintDecode() throws {
+        // Enough bytes follow each value to decode it from a single load.
+        let values: [UInt] = [0, 1, 0x7F, 0x80, 0x3FFF, 0x4000, 1 << 48, 1 << 56 - 1, 1 << 56, .max]
+        let data = ProtobufEncoder.encoding { encoder in
+            for value in values {
+                encoder.uintField(1, value, defaultValue: nil)
+            }
+            encoder.fixed64Field(2, .max)
+        }
+        var decoder = ProtobufDecoder(data)
+        var decoded: [UInt] = []
+        while let field = try decoder.nextField() {
+            switch field.tag {
+            case 1: decoded.append(try decoder.uintField(field))
+            default: try decoder.skipField(field)
+            }
+        }
+        #expect(decoded == values)
+    }
+
+    @Test
+    func repeatedDecode() throws {
+        let uints = (0 ..< 100).map { UInt($0 % 3 == 0 ? $0 * 1000 : $0) }
+        let data = ProtobufEncoder.encoding { encoder in
+            encoder.floatsField(1, [1, -2, 0.5])
+            encoder.doublesField(2, [1, 65535])
+            encoder.uintsField(3, uints)
+            encoder.cgFloatsField(4, [3, 4])
+            encoder.floatField(1, 8)
+        }
+        var decoder = ProtobufDecoder(data)
+        var floats: [Float] = []
+        var doubles: [Double] = []
+        var decodedUInts: [UInt] = []
+        var cgFloats: [CGFloat] = []
+        while let field = try decoder.nextField() {
+            switch field.tag {
+            case 1: try decoder.floatsField(field, into: &floats)
+            case 2: try decoder.doublesField(field, into: &doubles)
+            case 3:
+                // The rest of a packed field that was started one value at a
+                // time is decoded at once.
+                if decodedUInts.isEmpty {
+                    decodedUInts.append(try decoder.uintField(field))
+                } else {
+                    try decoder.uintsField(field, into: &decodedUInts)
+                }
+            case 4: try decoder.cgFloatsField(field, into: &cgFloats)
+            default: try decoder.skipField(field)
+            }
+        }
+        #expect(floats == [1, -2, 0.5, 8])
+        #expect(doubles == [1, 65535])
+        #expect(decodedUInts == uints)
+        #expect(cgFloats == [3, 4])
+    }
+
+    @Test
+    func truncatedRepeatedDecode() {
+        #expect(throws: Error.self) {
+            var floats: [Float] = []
+            var decoder = ProtobufDecoder(Data(hexString: "0a050000803f00")!)
+            while let field = try decoder.nextField() {
+                try decoder.floatsField(field, into: &floats)
+            }
+        }
+    }
+
     @Test
     func messageDecode() throws {
         let expectedForFalse = "0a00"
@@ -126,4 +195,40 @@ struct ProtobufDecoderTests {
         #expect(try expectedForZero.decodePBHexString(CodableMessage.self).value == 0)
         #expect(try expectedForOne.decodePBHexString(CodableMessage.self).value == 1)
     }
+
+    @Test
+    func mappedBorrowedDecode() throws {
+        let data = try ProtobufEncoder.encoding { encoder in
+            try encoder.stringField(1, "OpenSwiftUI")
+            try encoder.messageField(2, IntegerMessage(intValue: 1, unsignedIntValue: 2))
+            encoder.intField(3, 7)
+        }
+        let url = FileManager.default.temporaryDirectory
+            .appendingPathComponent("ProtobufDecoderTests-\(UUID().uuidString).pb")
+        try data.write(to: url)
+        defer { try? FileManager.default.removeItem(at: url) }
+
+        var bytes: ProtobufDecoder.Bytes?
+        var message: ProtobufLazyMessage<IntegerMessage>?
+        var value = 0
+        do {
+            var decoder = try ProtobufDecoder(mappingContentsOf: url)
+            while let field = try decoder.nextField() {
+                switch field.tag {
+                case 1: bytes = try decoder.bytesField(field)
+                case 2: message = try decoder.lazyMessageField(field)
+                case 3: value = try decoder.intField(field)
+                default: try decoder.skipField(field)
+                }
+            }
+        }
+        // The borrowed values outlive the decoder.
+        #expect(bytes?.isEqual(to: "OpenSwiftUI") == true)
+        #expect(bytes?.isEqual(to: "OpenSwift") == false)
+        #expect(bytes?.string == "OpenSwiftUI")
+        #expect(bytes?.data == Data("OpenSwiftUI".utf8))
+        #expect(message?.byteCount == 4)
+        #expect(try message?.decode() == IntegerMessage(intValue: 1, unsignedIntValue: 2))
+        #expect(value == 7)
+    }
 }
@@ -72,6 +72,35 @@ struct ProtobufEncoderTests {
         #expect((try PackedIntMessage(values: [0, 8]).pbHexString) == "0a020010")
     }
     
+    @Test
+    func repeatedEncode() throws {
+        let data = ProtobufEncoder.encoding { encoder in
+            encoder.floatsField(1, [1, -2, 0.5])
+            encoder.doublesField(2, [1, 65535])
+            encoder.uintsField(3, [0, 4, 300, 1])
+            encoder.uintsField(4, [])
+        }
+        #expect(data.hexString == "0a0c0000803f000000c00000003f" + "1210000000000000f03f00000000e0ffef40" + "1a050004ac0201")
+    }
+
+    @Test
+    func nestedLongMessageEncode() throws {
+        let payload = Data(repeating: 0xFF, count: 200)
+        let data = ProtobufEncoder.encoding { encoder in
+            encoder.messageField(1) { encoder in
+                encoder.messageField(1) { encoder in
+                    encoder.dataField(1, payload)
+                }
+                encoder.uintField(2, 1)
+            }
+            encoder.messageField(2) { encoder in
+                encoder.uintField(2, 0x80)
+            }
+        }
+        let payloadHex = String(repeating: "ff", count: 200)
+        #expect(data.hexString == "0ad0010acb010ac801\(payloadHex)1001" + "1203108001")
+    }
+
     @Test
     func messageEncode() throws {
         let falseMessage = BoolMessage(value: false)
@@ -91,4 +91,25 @@ struct BloomFilterTests {
         #expect(emptyFilter.mayContain(emptyFilter), "Empty filter should contain itself")
     }
     #endif
+
+    @Test
+    func wideFilter() {
+        let types: [any Any.Type] = [Int.self, String.self, Bool.self, Double.self, Float.self, [Int].self, [String: Int].self, Int8.self]
+        var union = WideBloomFilter()
+        for type in types {
+            let filter = WideBloomFilter(type: type)
+            #expect(!filter.isEmpty)
+            #expect(filter.bitCount <= 3)
+            #expect(filter == WideBloomFilter(type: type))
+            union.formUnion(filter)
+        }
+        for type in types {
+            #expect(union.mayContain(WideBloomFilter(type: type)))
+        }
+        #expect(union.mayContain(WideBloomFilter()))
+        #expect(!WideBloomFilter().mayContain(union))
+        #expect(WideBloomFilter.all.mayContain(union))
+        #expect(WideBloomFilter.all.bitCount == 256)
+        #expect(WideBloomFilter(hashValue: 0).union(WideBloomFilter(hashValue: 1)).bitCount > 3)
+    }
 }
@@ -0,0 +1,104 @@
+//
+//  LRUCacheTests.swift
+//  OpenSwiftUICoreTests
+
+@testable import OpenSwiftUICore
+import Testing
+
+struct LRUCacheTests {
+    @Test
+    func leastRecentlyUsedEviction() {
+        var cache = LRUCache<String, Int>(costLimit: 20)
+        cache.setValue(1, forKey: "a", cost: 10)
+        cache.setValue(2, forKey: "b", cost: 10)
+        #expect(cache.value(forKey: "a") == 1)
+        cache.setValue(3, forKey: "c", cost: 10) // Evicts b
+        #expect(cache.peekValue(forKey: "b") == nil)
+        #expect(cache.peekValue(forKey: "a") == 1)
+        #expect(cache.value(forKey: "c") == 3)
+        #expect(cache.value(forKey: "b") == nil)
+        #expect(cache.count == 2)
+        #expect(cache.totalCost == 20)
+
+        var expected = LRUCacheStatistics()
+        expected.hits = 2
+        expected.misses = 1
+        expected.evictions = 1
+        #expect(cache.statistics == expected)
+
+        cache.costLimit = 10 // Evicts a
+        #expect(cache.peekValue(forKey: "a") == nil)
+        #expect(cache.count == 1)
+    }
+
+    @Test
+    func replaceValue() {
+        var cache = LRUCache<String, Int>(costLimit: 100)
+        cache.setValue(1, forKey: "a", cost: 10)
+        cache.setValue(2, forKey: "a", cost: 30)
+        #expect(cache.count == 1)
+        #expect(cache.totalCost == 30)
+        #expect(cache.removeValue(forKey: "a") == 2)
+        #expect(cache.totalCost == 0)
+        #expect(cache.removeValue(forKey: "a") == nil)
+    }
+
+    @Test
+    func pinnedValuesAreNotEvicted() {
+        var cache = LRUCache<String, Int>(costLimit: 20)
+        cache.setValue(1, forKey: "a", cost: 10)
+        #expect(cache.pin("a"))
+        #expect(cache.pin("a"))
+        #expect(!cache.pin("missing"))
+        cache.setValue(2, forKey: "b", cost: 10)
+        cache.setValue(3, forKey: "c", cost: 10) // Evicts b, skipping pinned a
+        #expect(cache.peekValue(forKey: "a") == 1)
+        #expect(cache.peekValue(forKey: "b") == nil)
+        #expect(cache.pinnedCost == 10)
+
+        cache.trim(toCost: 0)
+        #expect(cache.count == 1)
+        #expect(cache.totalCost == 10)
+
+        cache.costLimit = 5
+        #expect(cache.isPinned("a"))
+        cache.unpin("a")
+        #expect(cache.isPinned("a"))
+        cache.unpin("a") // Over the limit once unpinned
+        #expect(cache.count == 0)
+        #expect(cache.pinnedCost == 0)
+    }
+
+    @Test
+    func unpinnedValueBecomesMostRecentlyUsed() {
+        var cache = LRUCache<String, Int>(costLimit: 3)
+        cache.setValue(1, forKey: "a", cost: 1)
+        cache.pin("a")
+        cache.setValue(2, forKey: "b", cost: 1)
+        cache.setValue(3, forKey: "c", cost: 1)
+        #expect(cache.value(forKey: "a") == 1)
+        cache.unpin("a")
+        cache.setValue(4, forKey: "d", cost: 1) // Evicts b, the oldest unpinned value
+        #expect(cache.peekValue(forKey: "b") == nil)
+        #expect(cache.peekValue(forKey: "a") == 1)
+        cache.setValue(5, forKey: "e", cost: 1) // Then c, used before a was unpinned
+        #expect(cache.peekValue(forKey: "c") == nil)
+        #expect(cache.peekValue(forKey: "a") == 1)
+        #expect(cache.statistics.evictions == 2)
+    }
+
+    @Test
+    func reusesFreeSlots() {
+        var cache = LRUCache<Int, Int>(costLimit: 3)
+        for value in 0 ..< 100 {
+            cache.setValue(value, forKey: value, cost: 1)
+        }
+        #expect(cache.count == 3)
+        #expect(cache.peekValue(forKey: 97) == 97)
+        #expect(cache.peekValue(forKey: 99) == 99)
+        cache.removeAll()
+        #expect(cache.count == 0)
+        #expect(cache.totalCost == 0)
+        #expect(cache.statistics.evictions == 97)
+    }
+}
@@ -250,4 +250,50 @@ struct PropertyListTrackerTests {
         #expect(tracker1.value(plist1, for: IntKey.self) == 24)
         #expect(tracker1.value(plist2, for: IntKey.self) == 25)
     }
+
+    @Test
+    func indexedLookup() {
+        var plist = PropertyList()
+        plist[StringFromIntLookup.Primary.self] = "p"
+        plist.prependValue(0, for: StringFromIntLookup.Secondary.self)
+        plist[StringKey.self] = "s"
+        for value in 1 ... 40 {
+            plist.prependValue(value, for: IntKey.self)
+        }
+        var other = PropertyList()
+        other[BoolKey.self] = true
+        other[StringKey.self] = "o"
+        var overridden = plist
+        overridden.override(with: other)
+
+        #expect(!plist.isIndexed)
+        for _ in 0 ..< 20 {
+            #expect(plist[IntKey.self] == 40)
+            #expect(plist[StringKey.self] == "s")
+            #expect(plist[BoolKey.self] == false)
+            #expect(plist.valueWithSecondaryLookup(StringFromIntLookup.self) == "p")
+            #expect(overridden[StringKey.self] == "o")
+            #expect(overridden[BoolKey.self] == true)
+            #expect(overridden[IntKey.self] == 40)
+        }
+        #expect(plist.isIndexed)
+        #expect(overridden.isIndexed)
+
+        var values: [Int] = []
+        plist.forEach(keyType: IntKey.self) { value, _ in values.append(value) }
+        #expect(values == Array((1 ... 40).reversed()))
+
+        plist.prependValue(7, for: StringFromIntLookup.Secondary.self)
+        for _ in 0 ..< 20 {
+            #expect(plist.valueWithSecondaryLookup(StringFromIntLookup.self) == "7")
+        }
+        #expect(plist.isIndexed)
+
+        var short = PropertyList()
+        short[IntKey.self] = 1
+        for _ in 0 ..< 20 {
+            #expect(short[IntKey.self] == 1)
+        }
+        #expect(!short.isIndexed)
+    }
 }
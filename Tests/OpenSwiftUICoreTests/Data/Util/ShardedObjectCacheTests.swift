@@ -0,0 +1,74 @@
+//
+//  ShardedObjectCacheTests.swift
+//  OpenSwiftUICoreTests
+
+@testable import OpenSwiftUICore
+import Foundation
+import Testing
+
+struct ShardedObjectCacheTests {
+    @Test
+    func accessCount() {
+        var accessCounts: [Int: Int] = [:]
+        let cache: ShardedObjectCache<Int, String> = ShardedObjectCache { key in
+            accessCounts[key, default: 0] += 1
+            return "\(key)"
+        }
+        #expect(cache[0] == "0")
+        #expect(cache[0] == "0")
+        #expect(cache[1] == "1")
+        #expect(accessCounts == [0: 1, 1: 1])
+        #expect(cache.count == 2)
+        var expected = ShardedObjectCache<Int, String>.Statistics()
+        expected.hits = 1
+        expected.misses = 2
+        #expect(cache.statistics == expected)
+
+        cache.reset()
+        #expect(cache.count == 0)
+        #expect(cache.statistics == .init())
+    }
+
+    @Test
+    func layout() {
+        let cache = ShardedObjectCache<Int, Int>(shardCount: 3, bucketCount: 5, waysPerBucket: 2) { $0 }
+        #expect(cache.shardCount == 4)
+        #expect(cache.bucketCount == 8)
+        #expect(cache.waysPerBucket == 2)
+    }
+
+    @Test
+    func eviction() {
+        let cache = ShardedObjectCache<Int, Int>(shardCount: 1, bucketCount: 1, waysPerBucket: 2) { $0 }
+        _ = cache[0]
+        _ = cache[1]
+        _ = cache[0]
+        _ = cache[2] // Evicts 1, the least recently used key
+        #expect(cache.statistics.evictions == 1)
+        _ = cache[0]
+        #expect(cache.statistics.hits == 2)
+        _ = cache[1]
+        #expect(cache.statistics.misses == 4)
+        #expect(cache.count == 2)
+    }
+
+    @Test
+    func singleFlight() {
+        let constructions = AtomicBox(wrappedValue: 0)
+        let cache = ShardedObjectCache<Int, Int> { key in
+            constructions.access { $0 += 1 }
+            Thread.sleep(forTimeInterval: 0.05)
+            return key * 2
+        }
+        let results = AtomicBox(wrappedValue: [Int]())
+        DispatchQueue.concurrentPerform(iterations: 8) { _ in
+            let value = cache[21]
+            results.access { $0.append(value) }
+        }
+        #expect(constructions.wrappedValue == 1)
+        #expect(results.wrappedValue == Array(repeating: 42, count: 8))
+        let statistics = cache.statistics
+        #expect(statistics.misses == 1)
+        #expect(statistics.hits + statistics.coalescedMisses == 7)
+    }
+}
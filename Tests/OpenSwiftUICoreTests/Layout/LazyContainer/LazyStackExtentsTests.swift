@@ -0,0 +1,60 @@
+//
+//  LazyStackExtentsTests.swift
+//  OpenSwiftUICoreTests
+
+@testable import OpenSwiftUICore
+import Foundation
+import Testing
+
+struct LazyStackExtentsTests {
+    @Test
+    func estimatedOffsets() {
+        var extents = LazyStackExtents(count: 100_000, spacing: 2, estimatedExtent: 10)
+        #expect(extents.offset(of: 0) == 0)
+        #expect(extents.offset(of: 3) == 36)
+        #expect(extents.totalLength() == 100_000 * 12 - 2)
+        #expect(extents.measuredCount == 0)
+    }
+
+    @Test
+    func measurementsUpdateEstimate() {
+        var extents = LazyStackExtents(count: 10, spacing: 0, estimatedExtent: 10)
+        extents.record(20, at: 2)
+        extents.record(40, at: 5)
+        #expect(extents.estimatedExtent == 30)
+        #expect(extents.extent(at: 2) == 20)
+        #expect(extents.extent(at: 3) == 30)
+        // 0 and 1 are estimated, 2 is measured.
+        #expect(extents.offset(of: 3) == 80)
+        #expect(extents.totalLength() == 20 + 40 + 8 * 30)
+        extents.record(30, at: 2)
+        #expect(extents.measuredCount == 2)
+        #expect(extents.extent(at: 2) == 30)
+        extents.record(.nan, at: 1)
+        extents.record(10, at: 10)
+        #expect(extents.measuredCount == 2)
+    }
+
+    @Test
+    func visibleIndices() {
+        var extents = LazyStackExtents(count: 100_000, spacing: 0, estimatedExtent: 10)
+        #expect(extents.indices(in: 0 ... 100) == 0 ..< 10)
+        #expect(extents.indices(in: 5 ... 25) == 0 ..< 3)
+        #expect(extents.indices(in: 500_000 ... 500_050) == 50_000 ..< 50_005)
+        #expect(extents.indices(in: 2_000_000 ... 2_000_100) == 100_000 ..< 100_000)
+        #expect(extents.indices(in: 0 ... .infinity) == 0 ..< 100_000)
+    }
+
+    @Test
+    func shrinkingCountDropsMeasurements() {
+        var extents = LazyStackExtents(count: 10, spacing: 0, estimatedExtent: 10)
+        extents.record(50, at: 8)
+        extents.record(20, at: 1)
+        extents.count = 5
+        #expect(extents.measuredCount == 1)
+        #expect(extents.estimatedExtent == 20)
+        #expect(extents.totalLength() == 100)
+        extents.removeAllMeasurements()
+        #expect(extents.estimatedExtent == 10)
+    }
+}
@@ -0,0 +1,124 @@
+//
+//  LazyStackTests.swift
+//  OpenSwiftUICoreTests
+
+import Foundation
+import OpenAttributeGraphShims
+@testable import OpenSwiftUICore
+import Testing
+
+@MainActor
+@Suite(.disabled(if: attributeGraphVendor == .oag))
+struct LazyStackTests {
+    /// Reports `region` to the lazy stacks below it, as a scroll view would.
+    private struct VisibleRegion: ViewModifier, UnaryViewModifier, PrimitiveViewModifier {
+        var region: CGRect
+
+        nonisolated static func _makeView(
+            modifier: _GraphValue<Self>,
+            inputs: _ViewInputs,
+            body: @escaping (_Graph, _ViewInputs) -> _ViewOutputs
+        ) -> _ViewOutputs {
+            var inputs = inputs
+            inputs.base[LazyStackVisibleRegionInput.self] = OptionalAttribute(
+                modifier[offset: { .of(&$0.region) }].value
+            )
+            return body(_Graph(), inputs)
+        }
+    }
+
+    private struct ContentView: View {
+        var offset: CGFloat
+
+        var body: some View {
+            LazyVStack(spacing: 0) {
+                ForEach(0 ..< 10_000, id: \.self) { _ in
+                    Color.red.frame(height: 10)
+                }
+            }
+            .modifier(VisibleRegion(region: CGRect(x: 0, y: offset, width: 100, height: 100)))
+            .frame(width: 100, height: 100, alignment: .top)
+        }
+    }
+
+    private struct IdealSizeView: View {
+        var body: some View {
+            LazyVStack(spacing: 0) {
+                ForEach(0 ..< 10_000, id: \.self) { _ in
+                    Color.red.frame(height: 10)
+                }
+            }
+            .fixedSize()
+        }
+    }
+
+    /// Updates the graph until the stack's window settles, then returns the
+    /// identity and minimum y of each row in the display list.
+    private func rows(of graph: ViewGraph) -> [(identity: Int, y: Double)] {
+        for _ in 0 ..< 4 {
+            Update.perform {
+                _ = graph.displayList()
+                graph.flushTransactions()
+            }
+        }
+        let description = graph.displayList().0.description
+        return description.components(separatedBy: "(item #:identity ").dropFirst().compactMap { item in
+            guard let identity = Int(item.prefix { $0.isNumber }),
+                  let frame = item.range(of: "(frame (") else {
+                return nil
+            }
+            let origin = item[frame.upperBound...].prefix { $0 != ";" }.split(separator: " ")
+            guard origin.count == 2, let y = Double(origin[1]) else {
+                return nil
+            }
+            return (identity, y)
+        }
+    }
+
+    @Test
+    func instantiatesVisibleRowsAndRecyclesScrolledOutRows() {
+        let graph = ViewGraph(
+            rootViewType: ContentView.self,
+            requestedOutputs: [.layout, .displayList]
+        )
+        graph.instantiateOutputs()
+        graph.setRootView(ContentView(offset: 0))
+        graph.setProposedSize(CGSize(width: 100, height: 100))
+
+        // Ten visible rows plus half a viewport of overscan on each side.
+        let top = rows(of: graph)
+        #expect(top.count >= 10)
+        #expect(top.count <= 20)
+        #expect(top.contains { $0.y == 0 })
+        #expect(top.allSatisfy { $0.y < 200 })
+
+        graph.setRootView(ContentView(offset: 50_000))
+        let middle = rows(of: graph)
+        #expect(middle.count >= 10)
+        #expect(middle.count <= 20)
+        #expect(middle.contains { $0.y == 50_000 })
+        // The rows scrolled out of the window are evicted...
+        #expect(middle.allSatisfy { abs($0.y - 50_000) < 200 })
+        // ...and their subgraphs were rebound to the new rows rather than
+        // rebuilt, so the new rows keep their display list identities.
+        let topIdentities = Set(top.map(\.identity))
+        #expect(middle.contains { topIdentities.contains($0.identity) })
+    }
+
+    @Test
+    func idealSizeInstantiatesAPageOfRows() {
+        let graph = ViewGraph(
+            rootViewType: IdealSizeView.self,
+            requestedOutputs: [.layout, .displayList]
+        )
+        graph.instantiateOutputs()
+        graph.setRootView(IdealSizeView())
+        graph.setProposedSize(CGSize(width: 100, height: 100))
+
+        // Without a proposed height nothing bounds the visible region, so
+        // only a page of estimated rows is instantiated.
+        let page = rows(of: graph)
+        #expect(!page.isEmpty)
+        #expect(page.count < 200)
+    }
+}
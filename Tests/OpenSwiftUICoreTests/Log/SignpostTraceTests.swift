@@ -0,0 +1,97 @@
+//
+//  SignpostTraceTests.swift
+//  OpenSwiftUICoreTests
+
+import Foundation
+import OpenSwiftUICore
+import Testing
+
+@Suite(.serialized)
+struct SignpostTraceTests {
+    @Test
+    func recordsEventsWhileRecording() {
+        SignpostTrace.stop()
+        SignpostTrace.record(.instant, category: "SignpostTraceTests", name: "Ignored")
+        SignpostTrace.start()
+        defer {
+            SignpostTrace.stop()
+            SignpostTrace.reset()
+        }
+        SignpostTrace.record(.begin, category: "SignpostTraceTests", name: "Interval", message: "value %d", id: 7, arguments: 42)
+        SignpostTrace.record(.end, category: "SignpostTraceTests", name: "Interval", id: 7)
+
+        let events = SignpostTrace.events()
+            .map(\.event)
+            .filter { $0.category.description == "SignpostTraceTests" }
+        #expect(events.map(\.phase) == [.begin, .end])
+        #expect(events.map(\.name.description) == ["Interval", "Interval"])
+        #expect(events[0].argumentCount == 1)
+        #expect(events[0].arguments.0 == 42)
+        #expect(events[0].timestamp <= events[1].timestamp)
+    }
+
+    @Test
+    func chromeTraceJSON() throws {
+        SignpostTrace.start()
+        defer {
+            SignpostTrace.stop()
+            SignpostTrace.reset()
+        }
+        SignpostTrace.record(.asyncBegin, category: "SignpostTraceTests", name: "Transaction", id: 0x10)
+
+        let json = SignpostTrace.chromeTraceJSON()
+        let object = try #require(JSONSerialization.jsonObject(with: Data(json.utf8)) as? [String: Any])
+        let events = try #require(object["traceEvents"] as? [[String: Any]])
+        let event = try #require(events.first { $0["cat"] as? String == "SignpostTraceTests" })
+        #expect(event["name"] as? String == "Transaction")
+        #expect(event["ph"] as? String == "b")
+        #expect(event["id"] as? String == "0x10")
+    }
+
+    @Test
+    func chromeTraceJSONArguments() throws {
+        SignpostTrace.start()
+        defer {
+            SignpostTrace.stop()
+            SignpostTrace.reset()
+        }
+        SignpostTrace.record(
+            .instant,
+            category: "SignpostTraceArguments",
+            name: "Quoted \"name\"",
+            message: "line\nbreak",
+            id: 0xABC,
+            arguments: 7, UInt32(9), Int64(11)
+        )
+
+        let json = SignpostTrace.chromeTraceJSON()
+        let object = try #require(JSONSerialization.jsonObject(with: Data(json.utf8)) as? [String: Any])
+        let events = try #require(object["traceEvents"] as? [[String: Any]])
+        let event = try #require(events.first { $0["cat"] as? String == "SignpostTraceArguments" })
+        #expect(event["name"] as? String == "Quoted \"name\"")
+        #expect(event["ph"] as? String == "i")
+        #expect(event["ts"] is NSNumber)
+        let arguments = try #require(event["args"] as? [String: Any])
+        #expect(arguments["object"] as? String == "0xabc")
+        #expect(arguments["message"] as? String == "line\nbreak")
+        #expect((arguments["arg0"] as? NSNumber)?.uint64Value == 7)
+        #expect((arguments["arg1"] as? NSNumber)?.uint64Value == 9)
+        #expect((arguments["arg2"] as? NSNumber)?.uint64Value == 11)
+    }
+
+    @Test
+    func signpostIntervalIsRecorded() {
+        SignpostTrace.start()
+        defer {
+            SignpostTrace.stop()
+            SignpostTrace.reset()
+        }
+        let value = Signpost.render.traceInterval(object: nil, "render") { 1 }
+
+        #expect(value == 1)
+        #if !canImport(Darwin)
+        let names = SignpostTrace.events().map { $0.event.name.description }
+        #expect(names.filter { $0 == "Render" }.count >= 2)
+        #endif
+    }
+}
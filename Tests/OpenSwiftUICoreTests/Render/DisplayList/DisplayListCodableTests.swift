@@ -0,0 +1,116 @@
+//
+//  DisplayListCodableTests.swift
+//  OpenSwiftUICoreTests
+
+@testable import OpenSwiftUICore
+import Foundation
+import Testing
+
+@MainActor
+struct DisplayListCodableTests {
+    private func colorItem(_ identity: UInt32, version: Int, frame: CGRect) -> DisplayList.Item {
+        DisplayList.Item(
+            .content(.init(.color(.init(red: 1, green: 0, blue: 0, opacity: 1)), seed: .init())),
+            frame: frame,
+            identity: .init(decodedValue: identity),
+            version: .init(decodedValue: version)
+        )
+    }
+
+    private func roundTrip<T>(_ value: T) throws -> T where T: ProtobufMessage {
+        var decoder = ProtobufDecoder(try ProtobufEncoder.encoding(value))
+        return try T(from: &decoder)
+    }
+
+    @Test
+    func pathRoundTrip() throws {
+        var path = Path()
+        path.move(to: CGPoint(x: 1, y: 2))
+        path.addLine(to: CGPoint(x: 10, y: 2))
+        path.addQuadCurve(to: CGPoint(x: 10, y: 10), control: CGPoint(x: 15, y: 5))
+        path.addCurve(to: CGPoint(x: 1, y: 10), control1: CGPoint(x: 8, y: 12), control2: CGPoint(x: 3, y: 12))
+        path.closeSubpath()
+        var elements: [Path.Element] = []
+        try roundTrip(path).forEach { elements.append($0) }
+        var expected: [Path.Element] = []
+        path.forEach { expected.append($0) }
+        #expect(elements == expected)
+        #expect(try roundTrip(Path(CGRect(x: 0, y: 0, width: 4, height: 4))) == Path(CGRect(x: 0, y: 0, width: 4, height: 4)))
+        #expect(try roundTrip(Path()).isEmpty)
+    }
+
+    @Test
+    func listRoundTrip() throws {
+        let child = colorItem(2, version: 3, frame: CGRect(x: 0, y: 0, width: 5, height: 5))
+        let clip = Path(ellipseIn: CGRect(x: 0, y: 0, width: 10, height: 10))
+        let list = DisplayList([
+            DisplayList.Item(
+                .effect(.clip(clip, FillStyle(eoFill: true)), DisplayList(child)),
+                frame: CGRect(x: 10, y: 20, width: 30, height: 40),
+                identity: .init(decodedValue: 1),
+                version: .init(decodedValue: 4)
+            ),
+            DisplayList.Item(
+                .effect(.opacity(0.5), DisplayList()),
+                frame: .zero,
+                identity: .none,
+                version: .init(decodedValue: 1)
+            ),
+        ])
+        let decoded = try roundTrip(list)
+        #expect(decoded == list)
+        guard case let .effect(.clip(path, style, _), children) = decoded.items[0].value else {
+            Issue.record("Expected a clip effect")
+            return
+        }
+        #expect(path == clip)
+        #expect(style.isEOFilled)
+        #expect(children.items[0].frame == child.frame)
+        guard case let .content(content) = children.items[0].value,
+              case let .color(color) = content.value else {
+            Issue.record("Expected color content")
+            return
+        }
+        #expect(color == Color.Resolved(red: 1, green: 0, blue: 0, opacity: 1))
+        guard case let .effect(.opacity(opacity), _) = decoded.items[1].value else {
+            Issue.record("Expected an opacity effect")
+            return
+        }
+        #expect(opacity == 0.5)
+    }
+
+    @Test
+    func deltaFrames() throws {
+        var recorder = DisplayList.Recorder(keyframeInterval: 3)
+        let first = DisplayList([
+            colorItem(1, version: 1, frame: CGRect(x: 0, y: 0, width: 10, height: 10)),
+            colorItem(2, version: 1, frame: CGRect(x: 10, y: 0, width: 10, height: 10)),
+        ])
+        var second = first
+        second.translate(by: CGSize(width: 0, height: 5), version: .init())
+        second.append(colorItem(3, version: 2, frame: CGRect(x: 20, y: 0, width: 10, height: 10)))
+
+        let keyframe = try recorder.encodeFrame(first, time: Time(seconds: 1))
+        let delta = try recorder.encodeFrame(second, time: Time(seconds: 2))
+        var keyframeRecorder = DisplayList.Recorder()
+        #expect(delta.count < (try keyframeRecorder.encodeFrame(second, time: Time(seconds: 2))).count)
+
+        var player = DisplayList.Player()
+        let frames = try player.decodeFrames(keyframe + delta)
+        #expect(frames.count == 2)
+        #expect(frames[0].isKeyframe)
+        #expect(!frames[1].isKeyframe)
+        #expect(frames[1].time == Time(seconds: 2))
+        #expect(frames[1].list == second)
+        #expect(frames[1].list.items.map(\.frame) == second.items.map(\.frame))
+
+        var latePlayer = DisplayList.Player()
+        #expect(try latePlayer.decodeFrames(delta).isEmpty)
+        _ = try recorder.encodeFrame(second, time: Time(seconds: 3))
+        let nextKeyframe = try recorder.encodeFrame(second, time: Time(seconds: 4))
+        let lateFrames = try latePlayer.decodeFrames(nextKeyframe)
+        #expect(lateFrames.count == 1)
+        #expect(lateFrames[0].isKeyframe)
+        #expect(lateFrames[0].list == second)
+    }
+}
@@ -0,0 +1,192 @@
+//
+//  DisplayListSoftwareRendererTests.swift
+//  OpenSwiftUICoreTests
+
+import Foundation
+import OpenCoreGraphicsShims
+@_spi(Private) @_spi(SoftwareRenderer) import OpenSwiftUICore
+import Testing
+
+struct DisplayListSoftwareRendererTests {
+    @Test
+    func emptyListIsTransparent() {
+        let bitmap = DisplayList().softwareBitmap(size: CGSize(width: 4.0, height: 3.0))
+
+        #expect(bitmap.width == 4)
+        #expect(bitmap.height == 3)
+        #expect(bitmap.bytesPerRow == 16)
+        #expect(bitmap.data == [UInt8](repeating: 0, count: 48))
+    }
+
+    @Test
+    func colorContentFill() {
+        let item = item(
+            .content(.init(
+                .color(.init(colorSpace: .sRGBLinear, red: 1.0, green: 0.0, blue: 0.0)),
+                seed: .init(decodedValue: 2)
+            )),
+            frame: CGRect(x: 1.0, y: 1.0, width: 2.0, height: 2.0)
+        )
+        let bitmap = DisplayList(item).softwareBitmap(size: CGSize(width: 4.0, height: 4.0))
+
+        #expect(pixel(bitmap, x: 0, y: 0) == [0, 0, 0, 0])
+        #expect(pixel(bitmap, x: 1, y: 1) == [255, 0, 0, 255])
+        #expect(pixel(bitmap, x: 2, y: 2) == [255, 0, 0, 255])
+        #expect(pixel(bitmap, x: 3, y: 3) == [0, 0, 0, 0])
+    }
+
+    @Test
+    func partialPixelCoverage() {
+        let item = item(
+            .content(.init(
+                .color(.init(colorSpace: .sRGBLinear, red: 1.0, green: 1.0, blue: 1.0)),
+                seed: .init(decodedValue: 2)
+            )),
+            frame: CGRect(x: 0.0, y: 0.0, width: 1.5, height: 1.0)
+        )
+        let bitmap = DisplayList(item).softwareBitmap(size: CGSize(width: 2.0, height: 1.0))
+
+        #expect(pixel(bitmap, x: 0, y: 0) == [255, 255, 255, 255])
+        #expect(pixel(bitmap, x: 1, y: 0)[3] == 128)
+    }
+
+    @Test
+    func shapeContentFill() {
+        let color = Color.Resolved(colorSpace: .sRGBLinear, red: 0.0, green: 1.0, blue: 0.0)
+        let item = item(
+            .content(.init(
+                .shape(Path(CGRect(x: 0.0, y: 0.0, width: 2.0, height: 2.0)), _AnyResolvedPaint(color), FillStyle()),
+                seed: .init(decodedValue: 3)
+            )),
+            frame: CGRect(x: 2.0, y: 0.0, width: 4.0, height: 4.0)
+        )
+        let bitmap = DisplayList(item).softwareBitmap(size: CGSize(width: 4.0, height: 4.0))
+
+        #expect(pixel(bitmap, x: 1, y: 1) == [0, 0, 0, 0])
+        #expect(pixel(bitmap, x: 3, y: 1) == [0, 255, 0, 255])
+        #expect(pixel(bitmap, x: 3, y: 2) == [0, 0, 0, 0])
+    }
+
+    @Test
+    func opacityAndTransformEffects() {
+        let child = item(
+            .content(.init(
+                .color(.init(colorSpace: .sRGBLinear, red: 0.0, green: 0.0, blue: 1.0)),
+                seed: .init(decodedValue: 2)
+            )),
+            frame: CGRect(x: 0.0, y: 0.0, width: 1.0, height: 1.0)
+        )
+        let transformed = item(
+            .effect(
+                .transform(.affine(CGAffineTransform(translationX: 2.0, y: 1.0))),
+                DisplayList(child)
+            ),
+            frame: .zero
+        )
+        let faded = item(
+            .effect(.opacity(0.5), DisplayList(transformed)),
+            frame: .zero
+        )
+        let bitmap = DisplayList(faded).softwareBitmap(size: CGSize(width: 4.0, height: 4.0))
+
+        #expect(pixel(bitmap, x: 0, y: 0) == [0, 0, 0, 0])
+        #expect(pixel(bitmap, x: 2, y: 1) == [0, 0, 128, 128])
+    }
+
+    @Test(arguments: [false, true])
+    func clipEffect(inverse: Bool) {
+        let child = item(
+            .content(.init(
+                .color(.init(colorSpace: .sRGBLinear, red: 1.0, green: 1.0, blue: 1.0)),
+                seed: .init(decodedValue: 2)
+            )),
+            frame: CGRect(x: 0.0, y: 0.0, width: 4.0, height: 4.0)
+        )
+        let clipped = item(
+            .effect(
+                .clip(
+                    Path(CGRect(x: 0.0, y: 0.0, width: 2.0, height: 4.0)),
+                    FillStyle(),
+                    inverse ? .inverse : []
+                ),
+                DisplayList(child)
+            ),
+            frame: .zero
+        )
+        let bitmap = DisplayList(clipped).softwareBitmap(size: CGSize(width: 4.0, height: 4.0))
+
+        // An inverse clip keeps the region outside the clip shape.
+        let inside: [UInt8] = inverse ? [0, 0, 0, 0] : [255, 255, 255, 255]
+        let outside: [UInt8] = inverse ? [255, 255, 255, 255] : [0, 0, 0, 0]
+        #expect(pixel(bitmap, x: 1, y: 2) == inside)
+        #expect(pixel(bitmap, x: 2, y: 2) == outside)
+    }
+
+    @Test
+    func tilingMatchesSingleTile() {
+        let item = item(
+            .content(.init(
+                .color(.init(colorSpace: .sRGBLinear, red: 0.25, green: 0.5, blue: 0.75)),
+                seed: .init(decodedValue: 2)
+            )),
+            frame: CGRect(x: 1.25, y: 2.5, width: 17.0, height: 9.75)
+        )
+        let list = DisplayList(item)
+        let size = CGSize(width: 24.0, height: 16.0)
+
+        #expect(list.softwareBitmap(size: size, tileSize: 4).data == list.softwareBitmap(size: size, tileSize: 64).data)
+    }
+
+    @Test
+    func halfFloatFormat() {
+        let item = item(
+            .content(.init(
+                .color(.init(colorSpace: .sRGBLinear, red: 1.0, green: 0.0, blue: 0.0)),
+                seed: .init(decodedValue: 2)
+            )),
+            frame: CGRect(x: 0.0, y: 0.0, width: 1.0, height: 1.0)
+        )
+        let bitmap = DisplayList(item).softwareBitmap(
+            size: CGSize(width: 1.0, height: 1.0),
+            pixelFormat: .rgba16Float
+        )
+
+        #expect(bitmap.bytesPerRow == 8)
+        #expect(bitmap.data == [0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C])
+    }
+
+    @Test(arguments: [
+        (Float(0.0), UInt16(0x0000)),
+        (0.5, 0x3800),
+        (1.0, 0x3C00),
+        (-2.0, 0xC000),
+        (65504.0, 0x7BFF),
+        (100_000.0, 0x7C00),
+    ])
+    func halfFloatBits(value: Float, bits: UInt16) {
+        #expect(softwareHalfFloatBits(value) == bits)
+    }
+
+    private func pixel(
+        _ bitmap: _RendererConfiguration.SoftwareOptions.Bitmap,
+        x: Int,
+        y: Int
+    ) -> [UInt8] {
+        let offset = y * bitmap.bytesPerRow + x * bitmap.pixelFormat.bytesPerPixel
+        return Array(bitmap.data[offset ..< offset + bitmap.pixelFormat.bytesPerPixel])
+    }
+
+    private func item(
+        _ value: DisplayList.Item.Value,
+        frame: CGRect,
+        identity: DisplayList.Identity = .init(decodedValue: 1),
+        version: DisplayList.Version = .init(decodedValue: 0)
+    ) -> DisplayList.Item {
+        DisplayList.Item(
+            value,
+            frame: frame,
+            identity: identity,
+            version: version
+        )
+    }
+}
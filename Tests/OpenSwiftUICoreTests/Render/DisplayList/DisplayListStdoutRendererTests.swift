@@ -45,6 +45,36 @@ struct DisplayListStdoutRendererTests {
         """)
     }
 
+    @Test
+    func reusedFlatListDescription() {
+        func colorList(_ frames: [CGRect]) -> DisplayList {
+            DisplayList(frames.enumerated().map { offset, frame in
+                item(
+                    .content(.init(
+                        .color(.init(colorSpace: .sRGBLinear, red: 0.0, green: 0.0, blue: 1.0)),
+                        seed: .init(decodedValue: UInt16(offset + 1))
+                    )),
+                    frame: frame
+                )
+            })
+        }
+        let surface = CGSize(width: 100.0, height: 80.0)
+        let first = colorList([
+            CGRect(x: 0.0, y: 0.0, width: 10.0, height: 10.0),
+            CGRect(x: 20.0, y: 0.0, width: 10.0, height: 10.0),
+        ])
+        let second = colorList([CGRect(x: 5.0, y: 5.0, width: 20.0, height: 20.0)])
+
+        var flatList = FlatDisplayList()
+        for list in [first, second, first] {
+            #expect(list.stdoutDescription(
+                surface: surface,
+                version: .init(decodedValue: 1),
+                flatList: &flatList
+            ) == list.stdoutDescription(surface: surface, version: .init(decodedValue: 1)))
+        }
+    }
+
     @Test
     func shapeContentDescription() {
         let color = Color.Resolved(colorSpace: .sRGBLinear, red: 0.0, green: 1.0, blue: 0.0)
@@ -270,6 +300,81 @@ struct DisplayListStdoutRendererTests {
         """)
     }
 
+    @Test
+    func incrementalTerminalUpdateRewritesOnlyDamagedCells() {
+        let terminalSize = _RendererConfiguration.StdoutOptions.TerminalSize(columns: 4, rows: 2)
+        let surface = CGSize(width: 4.0, height: 2.0)
+        let red = Color.Resolved(colorSpace: .sRGBLinear, red: 1.0, green: 0.0, blue: 0.0)
+        func list(x: CGFloat) -> DisplayList {
+            DisplayList(item(
+                .content(.init(.color(red), seed: .init(decodedValue: 1))),
+                frame: CGRect(x: x, y: 0.0, width: 2.0, height: 1.0)
+            ))
+        }
+        var frame: StdoutTerminalFrame?
+
+        #expect(list(x: 0.0).stdoutTerminalUpdate(
+            from: &frame,
+            surface: surface,
+            version: .init(decodedValue: 1),
+            terminalSize: terminalSize,
+            colorMode: .monochrome
+        ) == "\u{001B}[H\u{001B}[2J\u{001B}[1;1H██  \u{001B}[2;1H    ")
+        #expect(list(x: 0.0).stdoutTerminalUpdate(
+            from: &frame,
+            surface: surface,
+            version: .init(decodedValue: 1),
+            terminalSize: terminalSize,
+            colorMode: .monochrome
+        ) == "")
+        #expect(list(x: 2.0).stdoutTerminalUpdate(
+            from: &frame,
+            surface: surface,
+            version: .init(decodedValue: 2),
+            terminalSize: terminalSize,
+            colorMode: .monochrome
+        ) == "\u{001B}[1;1H  ██")
+        #expect(frame?.damage == [.init(columns: 0..<4, rows: 0..<1)])
+    }
+
+    @Test
+    func incrementalTerminalUpdateMergesDamagedRows() {
+        let terminalSize = _RendererConfiguration.StdoutOptions.TerminalSize(columns: 8, rows: 3)
+        let surface = CGSize(width: 8.0, height: 3.0)
+        let fill = item(
+            .content(.init(
+                .color(.init(colorSpace: .sRGBLinear, red: 0.0, green: 0.0, blue: 1.0)),
+                seed: .init(decodedValue: 1)
+            )),
+            frame: CGRect(x: 6.0, y: 0.0, width: 2.0, height: 3.0)
+        )
+        var frame: StdoutTerminalFrame?
+        _ = DisplayList().stdoutTerminalUpdate(
+            from: &frame,
+            surface: surface,
+            version: .init(decodedValue: 1),
+            terminalSize: terminalSize,
+            colorMode: .monochrome
+        )
+
+        #expect(DisplayList(fill).stdoutTerminalUpdate(
+            from: &frame,
+            surface: surface,
+            version: .init(decodedValue: 2),
+            terminalSize: terminalSize,
+            colorMode: .monochrome
+        ) == "\u{001B}[1;7H██\u{001B}[2;7H██\u{001B}[3;7H██")
+        #expect(frame?.damage == [.init(columns: 6..<8, rows: 0..<3)])
+
+        #expect(DisplayList(fill).stdoutTerminalUpdate(
+            from: &frame,
+            surface: surface,
+            version: .init(decodedValue: 3),
+            terminalSize: .init(columns: 4, rows: 3),
+            colorMode: .monochrome
+        ).hasPrefix("\u{001B}[H\u{001B}[2J"))
+    }
+
     private func item(
         _ value: DisplayList.Item.Value,
         frame: CGRect,
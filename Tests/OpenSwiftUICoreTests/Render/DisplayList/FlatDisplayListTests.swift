@@ -0,0 +1,152 @@
+//
+//  FlatDisplayListTests.swift
+//  OpenSwiftUICoreTests
+
+@testable import OpenSwiftUICore
+import Foundation
+import Testing
+
+@MainActor
+struct FlatDisplayListTests {
+    private func item(_ value: DisplayList.Item.Value, identity: UInt32, version: Int? = nil, frame: CGRect = CGRect(x: 0, y: 0, width: 10, height: 10)) -> DisplayList.Item {
+        DisplayList.Item(
+            value,
+            frame: frame,
+            identity: .init(decodedValue: identity),
+            version: .init(decodedValue: version ?? Int(identity))
+        )
+    }
+
+    private func color(_ identity: UInt32, version: Int? = nil, opacity: Float = 1) -> DisplayList.Item {
+        item(.content(.init(.color(.init(red: 1, green: 0, blue: 0, opacity: opacity)), seed: .init(decodedValue: 1))), identity: identity, version: version)
+    }
+
+    private var nestedList: DisplayList {
+        DisplayList([
+            color(1),
+            item(.effect(.mask(DisplayList(color(3))), DisplayList([color(4), color(5)])), identity: 2),
+            item(.states([
+                (StrongHash(of: 1), DisplayList(color(7))),
+                (StrongHash(of: 2), DisplayList(color(8))),
+            ]), identity: 6),
+            item(.content(.init(.flattened(DisplayList(color(10)), .zero, .init()), seed: .init(decodedValue: 1))), identity: 9),
+        ])
+    }
+
+    private func identities(_ body: ((DisplayList.Identity, inout Bool) -> Void) -> Bool) -> [UInt32] {
+        var identities: [UInt32] = []
+        body { identity, _ in identities.append(identity.value) }
+        return identities
+    }
+
+    @Test
+    func roundTrip() {
+        let list = nestedList
+        let flatList = FlatDisplayList(list)
+        #expect(flatList.roots.count == 4)
+        #expect(flatList.nodes.count == 10)
+        #expect(flatList.contents.count == 8)
+        let restored = DisplayList(flatList)
+        #expect(restored == list)
+        #expect(restored.features == list.features)
+        #expect(restored.properties == list.properties)
+        guard case let .effect(.mask(mask, _), children) = restored.items[1].value else {
+            Issue.record("Expected a mask effect")
+            return
+        }
+        #expect(mask.items.map(\.identity.value) == [3])
+        #expect(children.items.map(\.identity.value) == [4, 5])
+    }
+
+    @Test
+    func forEachIdentity() {
+        let list = nestedList
+        let flatList = FlatDisplayList(list)
+        #expect(identities { flatList.forEachIdentity($0) } == identities { list.forEachIdentity($0) })
+        #expect(identities { flatList.forEachIdentity($0) } == Array(1 ... 10))
+        var visited = 0
+        flatList.forEachIdentity { _, stop in
+            visited += 1
+            stop = visited == 3
+        }
+        #expect(visited == 3)
+    }
+
+    @Test
+    func canonicalize() {
+        let list = DisplayList([
+            item(.effect(.opacity(1), DisplayList(color(2))), identity: 1, frame: CGRect(x: 5, y: 5, width: 10, height: 10)),
+            item(.effect(.opacity(0), DisplayList(color(4))), identity: 3),
+            color(5, opacity: 0),
+            item(.effect(.identity, DisplayList()), identity: 6),
+        ])
+        var flatList = FlatDisplayList()
+        flatList.assign(nestedList)
+        flatList.assign(list)
+        flatList.canonicalize()
+        let canonical = DisplayList(flatList)
+        var expected = list.items
+        for index in expected.indices {
+            expected[index].canonicalize()
+        }
+        #expect(canonical.items.count == expected.count)
+        for (item, expected) in zip(canonical.items, expected) {
+            #expect(item.identity == expected.identity)
+            #expect(item.frame == expected.frame)
+            #expect(String(describing: item.value) == String(describing: expected.value))
+        }
+        guard case .content = canonical.items[0].value else {
+            Issue.record("Expected the opacity effect to collapse into its content")
+            return
+        }
+        #expect(canonical.items[0].frame.origin == CGPoint(x: 5, y: 5))
+    }
+
+    @Test
+    func parallelCanonicalize() {
+        let groups = (0 ..< 200).map { group in
+            let children = (0 ..< 64).map { child in
+                let identity = UInt32(1000 + group * 64 + child)
+                let opacity: Float = child % 3 == 0 ? 1 : (child % 3 == 1 ? 0 : 0.5)
+                return item(.effect(.opacity(opacity), DisplayList(color(identity, version: 1))), identity: 0, version: 1)
+            }
+            return item(.effect(.identity, DisplayList(children)), identity: UInt32(group + 1), version: 1)
+        }
+        let list = DisplayList(groups)
+        var serial = FlatDisplayList(list)
+        var parallel = FlatDisplayList(list)
+        #expect(parallel.nodes.count > FlatDisplayList.parallelThreshold)
+        serial.canonicalize(parallel: false)
+        parallel.canonicalize(parallel: true)
+        #expect(DisplayList(parallel) == DisplayList(serial))
+        #expect(String(describing: DisplayList(parallel)) == String(describing: DisplayList(serial)))
+    }
+
+    @Test
+    func identityIndex() {
+        let flatList = FlatDisplayList(nestedList)
+        let index = flatList.identityIndex()
+        #expect(index.count == 10)
+        for identity in UInt32(1) ... 10 {
+            guard let node = index[.init(decodedValue: identity)] else {
+                Issue.record("Missing identity \(identity)")
+                continue
+            }
+            #expect(flatList.nodes[node].identity.value == identity)
+        }
+        #expect(index[.init(decodedValue: 11)] == nil)
+
+        let groups = (0 ..< 200).map { group in
+            let children = (0 ..< 64).map { child in color(UInt32(1000 + group * 64 + child), version: 1) }
+            return item(.effect(.opacity(0.5), DisplayList(children)), identity: UInt32(group + 1), version: 1)
+        }
+        let large = FlatDisplayList(DisplayList(groups))
+        let serialIndex = large.identityIndex(parallel: false)
+        let parallelIndex = large.identityIndex(parallel: true)
+        #expect(parallelIndex.count == 200 * 65)
+        #expect(parallelIndex.count == serialIndex.count)
+        for identity in [UInt32(1), 200, 1000, 1000 + 200 * 64 - 1] {
+            #expect(parallelIndex[.init(decodedValue: identity)] == serialIndex[.init(decodedValue: identity)])
+        }
+    }
+}
@@ -0,0 +1,77 @@
+//
+//  RuntimeMetadataSnapshotTests.swift
+//  OpenSwiftUICoreTests
+
+@testable import OpenSwiftUICore
+import Foundation
+import Testing
+
+@Suite(.serialized)
+struct RuntimeMetadataSnapshotTests {
+    struct Conforming: TestProtocol {}
+
+    struct Fields {
+        var value = 0
+    }
+
+    private static func temporaryURL() -> URL {
+        FileManager.default.temporaryDirectory
+            .appendingPathComponent("RuntimeMetadataSnapshotTests-\(UUID().uuidString)", isDirectory: true)
+            .appendingPathComponent("RuntimeMetadata.snapshot")
+    }
+
+    @Test
+    func archiving() throws {
+        let snapshot = RuntimeMetadataSnapshot(
+            binaryIdentifier: "binary",
+            conformances: [
+                .init(protocolDescriptor: "descriptor", type: "type"),
+            ],
+            fieldLayoutTypes: ["a", "b"]
+        )
+        let data = try ProtobufEncoder.encoding(snapshot)
+        var decoder = ProtobufDecoder(data)
+        #expect(try RuntimeMetadataSnapshot(from: &decoder) == snapshot)
+    }
+
+    @Test
+    func loadRejectsOtherBinary() throws {
+        let url = Self.temporaryURL()
+        defer { try? FileManager.default.removeItem(at: url.deletingLastPathComponent()) }
+        let snapshot = RuntimeMetadataSnapshot(binaryIdentifier: "binary", fieldLayoutTypes: ["a"])
+        try snapshot.save(to: url)
+        #expect(try RuntimeMetadataSnapshot.load(from: url, binaryIdentifier: "binary") == snapshot)
+        #expect(try RuntimeMetadataSnapshot.load(from: url, binaryIdentifier: "other") == nil)
+    }
+
+    @Test
+    func defaultURLPerBinary() throws {
+        let url = try #require(RuntimeMetadataSnapshot.defaultURL(binaryIdentifier: "binary"))
+        #expect(RuntimeMetadataSnapshot.defaultURL(binaryIdentifier: "binary") == url)
+        #expect(RuntimeMetadataSnapshot.defaultURL(binaryIdentifier: "other") != url)
+        #expect(url.pathExtension == "snapshot")
+    }
+
+    @Test
+    func recordAndPrewarm() throws {
+        RuntimeMetadataSnapshot.isRecording = true
+        RuntimeMetadataSnapshot.resetRecording()
+        defer {
+            RuntimeMetadataSnapshot.isRecording = false
+            RuntimeMetadataSnapshot.resetRecording()
+        }
+        #expect(TestProtocolDescriptor.conformance(of: Conforming.self) != nil)
+        _ = Update.locked { DynamicPropertyCache.fields(of: Fields.self) }
+
+        let snapshot = RuntimeMetadataSnapshot.recorded(binaryIdentifier: "binary")
+        #expect(snapshot.conformances.contains(.init(
+            protocolDescriptor: try #require(_mangledTypeName(TestProtocolDescriptor.self)),
+            type: try #require(_mangledTypeName(Conforming.self))
+        )))
+        #expect(snapshot.fieldLayoutTypes.contains(try #require(_mangledTypeName(Fields.self))))
+
+        // Prewarming resolves the recorded names and answers the same way.
+        snapshot.prewarm()
+        #expect(TestProtocolDescriptor.conformance(of: Conforming.self)?.type == Conforming.self)
+    }
+}
@@ -0,0 +1,150 @@
+//
+//  PathClipperTests.swift
+//  OpenSwiftUICoreTests
+
+@testable import OpenSwiftUICore
+import Foundation
+import Testing
+
+struct PathClipperTests {
+    private let first = Path(CGRect(x: 0, y: 0, width: 10, height: 10))
+    private let second = Path(CGRect(x: 5, y: 5, width: 10, height: 10))
+
+    private func elements(of path: Path) -> [Path.Element] {
+        var elements: [Path.Element] = []
+        path.forEach { elements.append($0) }
+        return elements
+    }
+
+    @Test
+    func unionOutline() {
+        let union = first.union(second)
+        let elements = elements(of: union)
+        #expect(elements.count == 9)
+        #expect(elements.filter { $0 == .closeSubpath }.count == 1)
+        #expect(union.boundingRect == CGRect(x: 0, y: 0, width: 15, height: 15))
+        for eoFill in [false, true] {
+            #expect(union.contains(CGPoint(x: 2, y: 2), eoFill: eoFill))
+            #expect(union.contains(CGPoint(x: 7, y: 7), eoFill: eoFill))
+            #expect(union.contains(CGPoint(x: 12, y: 12), eoFill: eoFill))
+            #expect(!union.contains(CGPoint(x: 12, y: 2), eoFill: eoFill))
+        }
+    }
+
+    @Test
+    func intersection() {
+        let rects = first.intersection(second)
+        #expect(rects.rect() == CGRect(x: 5, y: 5, width: 5, height: 5))
+        let ellipse = Path(ellipseIn: CGRect(x: 0, y: 0, width: 10, height: 10))
+        let result = ellipse.intersection(second)
+        #expect(result.contains(CGPoint(x: 7, y: 7)))
+        #expect(!result.contains(CGPoint(x: 3, y: 3)))
+        #expect(!result.contains(CGPoint(x: 9.8, y: 9.8)))
+        #expect(first.intersection(Path(CGRect(x: 20, y: 20, width: 1, height: 1))).isEmpty)
+    }
+
+    @Test
+    func subtractingMakesHole() {
+        let outer = Path(CGRect(x: 0, y: 0, width: 30, height: 30))
+        let inner = Path(ellipseIn: CGRect(x: 10, y: 10, width: 10, height: 10))
+        let result = outer.subtracting(inner)
+        #expect(elements(of: result).filter { $0 == .closeSubpath }.count == 2)
+        #expect(result.contains(CGPoint(x: 5, y: 5)))
+        #expect(!result.contains(CGPoint(x: 15, y: 15)))
+        #expect(!result.contains(CGPoint(x: 15, y: 15), eoFill: true))
+    }
+
+    @Test
+    func symmetricDifference() {
+        let result = first.symmetricDifference(second)
+        #expect(result.contains(CGPoint(x: 2, y: 2)))
+        #expect(result.contains(CGPoint(x: 12, y: 12)))
+        #expect(!result.contains(CGPoint(x: 7, y: 7)))
+    }
+
+    @Test
+    func normalizedResolvesFillRule() {
+        var path = Path()
+        path.addRect(CGRect(x: 0, y: 0, width: 30, height: 30))
+        path.addRect(CGRect(x: 10, y: 10, width: 10, height: 10))
+        let evenOdd = path.normalized(eoFill: true)
+        #expect(!evenOdd.contains(CGPoint(x: 15, y: 15)))
+        #expect(evenOdd.contains(CGPoint(x: 5, y: 5)))
+        let nonZero = path.normalized(eoFill: false)
+        #expect(nonZero.contains(CGPoint(x: 15, y: 15), eoFill: true))
+        #expect(elements(of: nonZero).count == 5)
+    }
+
+    @Test
+    func crossingEdges() {
+        var bowtie = Path()
+        bowtie.addLines([
+            CGPoint(x: 0, y: 0),
+            CGPoint(x: 10, y: 10),
+            CGPoint(x: 10, y: 0),
+            CGPoint(x: 0, y: 10),
+        ])
+        bowtie.closeSubpath()
+        let result = bowtie.union(Path())
+        #expect(elements(of: result).filter { $0 == .closeSubpath }.count == 2)
+        #expect(result.contains(CGPoint(x: 2, y: 5)))
+        #expect(result.contains(CGPoint(x: 8, y: 5)))
+        #expect(!result.contains(CGPoint(x: 5, y: 2)))
+    }
+
+    @Test
+    func pentagram() {
+        // Rounding leaves the edge across the arms a few ulps off
+        // horizontal, and every edge crosses two others.
+        var star = Path()
+        star.addLines((0 ..< 5).map { index in
+            let angle = (-90 + 144 * Double(index)) * .pi / 180
+            return CGPoint(x: 10 + 10 * cos(angle), y: 10 + 10 * sin(angle))
+        })
+        star.closeSubpath()
+        let nonZero = star.normalized(eoFill: false)
+        let evenOdd = star.normalized(eoFill: true)
+        #expect(elements(of: evenOdd).filter { $0 == .closeSubpath }.count == 5)
+        for tip in [
+            CGPoint(x: 10, y: 2),
+            CGPoint(x: 3, y: 8),
+            CGPoint(x: 17, y: 8),
+            CGPoint(x: 6, y: 15),
+            CGPoint(x: 14, y: 15),
+        ] {
+            #expect(nonZero.contains(tip, eoFill: true))
+            #expect(evenOdd.contains(tip, eoFill: true))
+        }
+        #expect(nonZero.contains(CGPoint(x: 10, y: 10), eoFill: true))
+        #expect(!evenOdd.contains(CGPoint(x: 10, y: 10)))
+    }
+
+    @Test
+    func lineOperations() {
+        var line = Path()
+        line.move(to: CGPoint(x: -5, y: 5))
+        line.addLine(to: CGPoint(x: 15, y: 5))
+        #expect(elements(of: line.lineIntersection(first)) == [
+            .move(to: CGPoint(x: 0, y: 5)),
+            .line(to: CGPoint(x: 10, y: 5)),
+        ])
+        #expect(elements(of: line.lineSubtraction(first)) == [
+            .move(to: CGPoint(x: -5, y: 5)),
+            .line(to: CGPoint(x: 0, y: 5)),
+            .move(to: CGPoint(x: 10, y: 5)),
+            .line(to: CGPoint(x: 15, y: 5)),
+        ])
+    }
+
+    @Test
+    func trivialUnion() {
+        var path = Path()
+        path.formTrivialUnion(first)
+        #expect(path == first)
+        path.formTrivialUnion(Path(CGRect(x: 20, y: 0, width: 5, height: 5)))
+        #expect(elements(of: path).filter { $0 == .closeSubpath }.count == 2)
+        path.formTrivialUnion(second)
+        #expect(path.contains(CGPoint(x: 12, y: 12)))
+        #expect(path.contains(CGPoint(x: 22, y: 2)))
+    }
+}
@@ -0,0 +1,233 @@
+//
+//  PathGeometryTests.swift
+//  OpenSwiftUICoreTests
+
+@testable import OpenSwiftUICore
+import Foundation
+import Testing
+
+struct PathGeometryTests {
+    // MARK: - Elements
+
+    @Test
+    func rectElements() {
+        var elements: [Path.Element] = []
+        Path(CGRect(x: 0, y: 0, width: 10, height: 20)).forEach { elements.append($0) }
+        #expect(elements == [
+            .move(to: CGPoint(x: 0, y: 0)),
+            .line(to: CGPoint(x: 10, y: 0)),
+            .line(to: CGPoint(x: 10, y: 20)),
+            .line(to: CGPoint(x: 0, y: 20)),
+            .closeSubpath,
+        ])
+    }
+
+    @Test
+    func builtPath() {
+        var path = Path()
+        path.addLine(to: CGPoint(x: 5, y: 5))
+        #expect(path.isEmpty)
+        path.move(to: .zero)
+        path.addLine(to: CGPoint(x: 10, y: 0))
+        path.addQuadCurve(to: CGPoint(x: 10, y: 10), control: CGPoint(x: 20, y: 5))
+        #expect(path.currentPoint == CGPoint(x: 10, y: 10))
+        path.closeSubpath()
+        #expect(path.currentPoint == .zero)
+        let bounds = path.boundingRect
+        #expect(bounds.minX == 0)
+        #expect(abs(bounds.maxX - 15) < 1e-9)
+        #expect(bounds.maxY == 10)
+    }
+
+    @Test
+    func copyOnWrite() {
+        var path = Path()
+        path.move(to: .zero)
+        path.addLine(to: CGPoint(x: 10, y: 0))
+        let copy = path
+        path.addLine(to: CGPoint(x: 10, y: 10))
+        #expect(copy.currentPoint == CGPoint(x: 10, y: 0))
+        #expect(path.currentPoint == CGPoint(x: 10, y: 10))
+        #expect(copy != path)
+    }
+
+    @Test
+    func arcBounds() {
+        var path = Path()
+        path.addArc(
+            center: CGPoint(x: 50, y: 50),
+            radius: 10,
+            startAngle: .zero,
+            endAngle: .degrees(180),
+            clockwise: false
+        )
+        let bounds = path.boundingRect
+        #expect(abs(bounds.minX - 40) < 1e-6)
+        #expect(abs(bounds.maxX - 60) < 1e-6)
+        #expect(abs(bounds.maxY - 60) < 1e-3)
+        #expect(abs(bounds.minY - 50) < 1e-6)
+    }
+
+    // MARK: - Containment
+
+    @Test(arguments: [false, true])
+    func ellipseContains(eoFill: Bool) {
+        let path = Path(ellipseIn: CGRect(x: 0, y: 0, width: 100, height: 50))
+        #expect(path.contains(CGPoint(x: 50, y: 25), eoFill: eoFill))
+        #expect(path.contains(CGPoint(x: 2, y: 25), eoFill: eoFill))
+        #expect(!path.contains(CGPoint(x: 5, y: 5), eoFill: eoFill))
+        #expect(!path.contains(CGPoint(x: 101, y: 25), eoFill: eoFill))
+    }
+
+    @Test
+    func fillRules() {
+        var path = Path()
+        path.addRect(CGRect(x: 0, y: 0, width: 30, height: 30))
+        path.addRect(CGRect(x: 10, y: 10, width: 10, height: 10))
+        #expect(path.contains(CGPoint(x: 15, y: 15)))
+        #expect(!path.contains(CGPoint(x: 15, y: 15), eoFill: true))
+        #expect(path.contains(CGPoint(x: 5, y: 5), eoFill: true))
+    }
+
+    @Test
+    func batchedContainsMatchesScalar() {
+        let path = Path(roundedRect: CGRect(x: 0, y: 0, width: 40, height: 40), cornerRadius: 12)
+            .applying(CGAffineTransform(rotationAngle: 0.3))
+        let points = (0 ..< 64).map { index in
+            CGPoint(x: CGFloat(index % 8) * 7 - 10, y: CGFloat(index / 8) * 7 - 5)
+        }
+        let origin = CGPoint(x: 3, y: -2)
+        let result = path.contains(points: points, origin: origin)
+        for (index, point) in points.enumerated() {
+            let expected = path.contains(CGPoint(x: point.x - origin.x, y: point.y - origin.y))
+            #expect(result[index] == expected)
+        }
+    }
+
+    // MARK: - Stroke
+
+    @Test
+    func strokedLine() {
+        var path = Path()
+        path.move(to: CGPoint(x: 0, y: 0))
+        path.addLine(to: CGPoint(x: 100, y: 0))
+        let butt = path.strokedPath(StrokeStyle(lineWidth: 10))
+        #expect(butt.contains(CGPoint(x: 50, y: 4)))
+        #expect(!butt.contains(CGPoint(x: 50, y: 6)))
+        #expect(!butt.contains(CGPoint(x: -2, y: 0)))
+        let square = path.strokedPath(StrokeStyle(lineWidth: 10, lineCap: .square))
+        #expect(square.contains(CGPoint(x: -4, y: 0)))
+        let round = path.strokedPath(StrokeStyle(lineWidth: 10, lineCap: .round))
+        #expect(round.contains(CGPoint(x: -4, y: 0)))
+        #expect(!round.contains(CGPoint(x: -4, y: 4)))
+    }
+
+    @Test
+    func strokedJoins() {
+        var path = Path()
+        path.move(to: CGPoint(x: 0, y: 0))
+        path.addLine(to: CGPoint(x: 50, y: 0))
+        path.addLine(to: CGPoint(x: 50, y: 50))
+        let corner = CGPoint(x: 54, y: -4)
+        #expect(path.strokedPath(StrokeStyle(lineWidth: 10, lineJoin: .miter)).contains(corner))
+        #expect(!path.strokedPath(StrokeStyle(lineWidth: 10, lineJoin: .bevel)).contains(corner))
+        #expect(!path.strokedPath(StrokeStyle(lineWidth: 10, lineJoin: .round)).contains(corner))
+        #expect(!path.strokedPath(StrokeStyle(lineWidth: 10, lineJoin: .miter, miterLimit: 1)).contains(corner))
+    }
+
+    @Test
+    func strokedOutlineIgnoresFillRule() {
+        var path = Path()
+        path.move(to: CGPoint(x: 0, y: 0))
+        path.addLine(to: CGPoint(x: 50, y: 0))
+        path.addLine(to: CGPoint(x: 50, y: 50))
+        path.move(to: CGPoint(x: 0, y: 50))
+        path.addLine(to: CGPoint(x: 100, y: 50))
+        path.addRect(CGRect(x: 100, y: 100, width: 50, height: 50))
+        let stroked = path.strokedPath(StrokeStyle(lineWidth: 10, lineJoin: .round))
+        for point in [
+            CGPoint(x: 46, y: 4),
+            CGPoint(x: 50, y: 50),
+            CGPoint(x: 52, y: 48),
+            CGPoint(x: 100, y: 125),
+        ] {
+            #expect(stroked.contains(point, eoFill: false))
+            #expect(stroked.contains(point, eoFill: true))
+        }
+        #expect(!stroked.contains(CGPoint(x: 125, y: 125), eoFill: true))
+    }
+
+    @Test
+    func strokedDashes() {
+        var path = Path()
+        path.move(to: CGPoint(x: 0, y: 0))
+        path.addLine(to: CGPoint(x: 100, y: 0))
+        let dashed = path.strokedPath(StrokeStyle(lineWidth: 4, dash: [10, 10], dashPhase: 5))
+        #expect(dashed.contains(CGPoint(x: 2, y: 0)))
+        #expect(!dashed.contains(CGPoint(x: 8, y: 0)))
+        #expect(dashed.contains(CGPoint(x: 20, y: 0)))
+    }
+
+    @Test(arguments: [CGLineCap.round, .square])
+    func strokedDots(lineCap: CGLineCap) {
+        var path = Path()
+        path.move(to: CGPoint(x: 0, y: 0))
+        path.addLine(to: CGPoint(x: 100, y: 0))
+        let dotted = path.strokedPath(StrokeStyle(lineWidth: 4, lineCap: lineCap, dash: [0, 10]))
+        #expect(dotted.contains(CGPoint(x: 0, y: 1)))
+        #expect(dotted.contains(CGPoint(x: 10, y: 1)))
+        #expect(dotted.contains(CGPoint(x: 51, y: 0)))
+        #expect(!dotted.contains(CGPoint(x: 5, y: 0)))
+        #expect(!path.strokedPath(StrokeStyle(lineWidth: 4, lineCap: .butt, dash: [0, 10])).contains(CGPoint(x: 10, y: 0)))
+    }
+
+    // MARK: - Trim
+
+    @Test
+    func trimmedLine() {
+        var path = Path()
+        path.move(to: CGPoint(x: 0, y: 0))
+        path.addLine(to: CGPoint(x: 100, y: 0))
+        var elements: [Path.Element] = []
+        path.trimmedPath(from: 0.25, to: 0.5).forEach { elements.append($0) }
+        #expect(elements == [
+            .move(to: CGPoint(x: 25, y: 0)),
+            .line(to: CGPoint(x: 50, y: 0)),
+        ])
+        #expect(path.trimmedPath(from: 0.5, to: 0.5).isEmpty)
+    }
+
+    @Test
+    func trimmedRectKeepsClosure() {
+        let path = Path(CGRect(x: 0, y: 0, width: 10, height: 10))
+        var elements: [Path.Element] = []
+        path.trimmedPath(from: 0, to: 0.5).forEach { elements.append($0) }
+        #expect(elements == [
+            .move(to: CGPoint(x: 0, y: 0)),
+            .line(to: CGPoint(x: 10, y: 0)),
+            .line(to: CGPoint(x: 10, y: 10)),
+        ])
+        #expect(path.trimmedPath(from: 0, to: 1) == path)
+    }
+
+    @Test
+    func trimmedCurveStaysOnCurve() {
+        let path = Path(ellipseIn: CGRect(x: -10, y: -10, width: 20, height: 20))
+        let trimmed = path.trimmedPath(from: 0.125, to: 0.375)
+        var points: [CGPoint] = []
+        trimmed.forEach { element in
+            switch element {
+            case let .move(point), let .curve(point, _, _):
+                points.append(point)
+            default:
+                Issue.record("Unexpected element \(element)")
+            }
+        }
+        #expect(points.count == 3)
+        for point in points {
+            #expect(abs(sqrt(point.x * point.x + point.y * point.y) - 10) < 0.01)
+        }
+        #expect(abs(points[0].x - points[0].y) < 0.05)
+        #expect(abs(points[2].x + points[2].y) < 0.05)
+    }
+}
@@ -0,0 +1,47 @@
+//
+//  PathTests.swift
+//  OpenSwiftUICoreTests
+
+@testable import OpenSwiftUICore
+import Foundation
+import Testing
+
+struct PathTests {
+    // MARK: - String representation
+
+    @Test
+    func stringRoundTrip() throws {
+        let string = " 0 0 m 100 0 l 50 50 100 100 q 0 25 50 75 0 100 c h"
+        let path = try #require(Path(string))
+        var elements: [Path.Element] = []
+        path.forEach { elements.append($0) }
+        #expect(elements == [
+            .move(to: CGPoint(x: 0, y: 0)),
+            .line(to: CGPoint(x: 100, y: 0)),
+            .quadCurve(to: CGPoint(x: 100, y: 100), control: CGPoint(x: 50, y: 50)),
+            .curve(to: CGPoint(x: 0, y: 100), control1: CGPoint(x: 0, y: 25), control2: CGPoint(x: 50, y: 75)),
+            .closeSubpath,
+        ])
+        #expect(path.description == string)
+        #expect(Path("0 0 z") == nil)
+    }
+
+    @Test
+    func parsedPathGeometry() throws {
+        // Parsed paths are stored in RenderBox path storage in builds with
+        // the CF CG types, which are only enabled by default on Darwin.
+        // Elsewhere they are stored as `.elements`, and both must agree.
+        let string = " 10 20 m 110 20 l 110 70 l h"
+        let path = try #require(Path(string))
+        #expect(!path.isEmpty)
+        #expect(path.boundingRect == CGRect(x: 10, y: 20, width: 100, height: 50))
+        #expect(path == Path(string))
+        #expect(Path(path.description)?.description == string)
+
+        var edited = path
+        edited.move(to: CGPoint(x: 0, y: 0))
+        edited.addLine(to: CGPoint(x: 5, y: 5))
+        #expect(edited.description == string + " 0 0 m 5 5 l")
+        #expect(path.description == string)
+    }
+}
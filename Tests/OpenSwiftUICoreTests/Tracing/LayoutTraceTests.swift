@@ -0,0 +1,62 @@
+//
+//  LayoutTraceTests.swift
+//  OpenSwiftUICoreTests
+
+@testable import OpenSwiftUICore
+import Foundation
+import OpenAttributeGraphShims
+import Testing
+
+struct LayoutTraceTests {
+    @Test
+    func nestedQueries() {
+        let recorder = LayoutTrace.Recorder(graph: Graph(shared: Graph()))
+        let stack = AnyAttribute(rawValue: 8)
+        let child = AnyAttribute(rawValue: 16)
+        let proposal = _ProposedSize(width: 100, height: nil)
+        recorder.traceContentDescription(stack, "VStack")
+        Update.perform {
+            let size = recorder.traceSizeThatFits(stack, proposal: proposal) {
+                recorder.cacheLookup = (proposal, false)
+                for hit in [false, true, true] {
+                    _ = recorder.traceLengthThatFits(child, proposal: proposal, in: .vertical) {
+                        recorder.cacheLookup = (proposal, hit)
+                        return 10
+                    }
+                }
+                return CGSize(width: 100, height: 30)
+            }
+            #expect(size == CGSize(width: 100, height: 30))
+        }
+        _ = Update.perform {
+            recorder.traceSizeThatFits(child, proposal: proposal) { .zero }
+        }
+
+        #expect(recorder.frameCount == 2)
+        #expect(recorder.queryCount == 5)
+
+        let summaries = recorder.attributeSummaries()
+        #expect(summaries.map(\.attribute) == [16, 8])
+        #expect(summaries[0].measurements == 4)
+        #expect(summaries[0].maxMeasurementsPerFrame == 3)
+        #expect(summaries[0].cacheHits == 2)
+        #expect(summaries[0].cacheMisses == 1)
+        #expect(summaries[1].measurements == 1)
+        #expect(summaries[1].cacheMisses == 1)
+        #expect(summaries[1].cacheHitRate == 0)
+        #expect(summaries[1].selfDuration <= summaries[1].totalDuration)
+
+        let lines = recorder.foldedStacks().split(separator: "\n").map { String($0.split(separator: " ").dropLast().joined(separator: " ")) }
+        #expect(lines == [
+            "VStack #8.sizeThatFits",
+            "VStack #8.sizeThatFits;#16.lengthThatFits(vertical)",
+            "#16.sizeThatFits",
+        ])
+        #expect(recorder.report().contains("VStack #8"))
+
+        recorder.reset()
+        #expect(recorder.queryCount == 0)
+        #expect(recorder.attributeSummaries().isEmpty)
+        #expect(recorder.foldedStacks().isEmpty)
+    }
+}
@@ -310,6 +310,59 @@ struct Cache3Tests {
     }
 }
 
+// MARK: - AdaptiveCacheTests
+
+struct AdaptiveCacheTests {
+    @Test
+    func behavesLikeCache3() {
+        var cache = AdaptiveCache<Int, String>()
+        for key in 1 ... 4 {
+            cache.put(key, value: "\(key)")
+        }
+        #expect(cache.capacity == 3)
+        #expect(cache.find(1) == nil)
+        #expect(cache.find(2) == "2")
+        #expect(cache.find(4) == "4")
+    }
+
+    @Test
+    func growsWhenKeysCycle() {
+        var cache3 = Cache3<Int, Int>()
+        var cache = AdaptiveCache<Int, Int>()
+        var cache3Misses = 0
+        var misses = 0
+        for _ in 0 ..< 10 {
+            for key in 0 ..< 6 {
+                _ = cache3.get(key) {
+                    cache3Misses += 1
+                    return key
+                }
+                _ = cache.get(key) {
+                    misses += 1
+                    return key
+                }
+            }
+        }
+        #expect(cache3Misses == 60)
+        #expect(misses < 10)
+        #expect(cache.capacity > 3)
+        for key in 0 ..< 6 {
+            #expect(cache.find(key) == key)
+        }
+    }
+
+    @Test
+    func boundedCapacity() {
+        var cache = AdaptiveCache<Int, Int>()
+        for key in 0 ..< 1000 {
+            cache.put(key, value: key)
+        }
+        #expect(cache.capacity == AdaptiveCache<Int, Int>.maxTableCapacity * 3 / 4)
+        #expect(cache.find(999) == 999)
+        #expect(cache.find(0) == nil)
+    }
+}
+
 // MARK: - RandomAccessCollection + lowerBound
 
 struct RandomAccessCollectionLowerBoundTests {
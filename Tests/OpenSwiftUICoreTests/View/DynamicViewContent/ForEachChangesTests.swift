@@ -0,0 +1,147 @@
+//
+//  ForEachChangesTests.swift
+//  OpenSwiftUICoreTests
+
+@testable import OpenSwiftUICore
+import Foundation
+import OpenAttributeGraphShims
+import Testing
+
+struct ForEachChangesTests {
+    @Test
+    func differenceOffsets() {
+        let old = [1, 2, 3, 4, 5]
+        let new = [0, 1, 3, 4, 5, 6]
+        let changes = ForEachChanges(new.difference(from: old))
+        #expect(changes.removals == [1])
+        #expect(changes.insertions == [0, 5])
+        #expect(changes.isApplicable(oldCount: old.count, newCount: new.count))
+        #expect(!changes.isApplicable(oldCount: old.count, newCount: new.count + 1))
+        for (offset, element) in old.enumerated() {
+            let newOffset = changes.offset(movingFrom: offset)
+            #expect(newOffset == new.firstIndex(of: element))
+        }
+    }
+
+    @Test
+    func movedElements() {
+        let old = ["a", "b", "c", "d"]
+        let new = ["d", "a", "c", "b"]
+        let changes = ForEachChanges(new.difference(from: old).inferringMoves())
+        #expect(changes.isApplicable(oldCount: old.count, newCount: new.count))
+        for (offset, element) in old.enumerated() {
+            guard let newOffset = changes.offset(movingFrom: offset) else {
+                #expect(changes.removals.contains(offset))
+                continue
+            }
+            #expect(new[newOffset] == element)
+        }
+    }
+
+    @Test
+    func invalidOffsets() {
+        let changes = ForEachChanges(removals: [3, 3], insertions: [])
+        #expect(changes.removals == [3])
+        #expect(!changes.isApplicable(oldCount: 3, newCount: 2))
+        #expect(changes.isApplicable(oldCount: 4, newCount: 3))
+        #expect(ForEachChanges(removals: [], insertions: []).isEmpty)
+        #expect(ForEachChanges(removals: [], insertions: []) == ForEachChanges(removals: [], insertions: []))
+    }
+}
+
+// MARK: - ForEachChangesGraphTests
+
+@MainActor
+@Suite(.disabled(if: attributeGraphVendor == .oag))
+struct ForEachChangesGraphTests {
+    private struct ContentView: View {
+        var data: [Int]
+        var difference: CollectionDifference<Int>
+
+        var body: some View {
+            VStack(spacing: 0) {
+                ForEach(data, id: \.self) { value in
+                    Color.red.frame(width: 10, height: CGFloat(value))
+                }
+                .dataDifference(difference)
+            }
+        }
+    }
+
+    /// Returns the heights of the rows in the display list, from top to
+    /// bottom.
+    private func heights(of graph: ViewGraph) -> [Int] {
+        let description = graph.displayList().0.description
+        let frames = description.components(separatedBy: "(frame (").dropFirst().compactMap { frame in
+            let values = frame.prefix { $0 != ")" }
+                .split(whereSeparator: { $0 == " " || $0 == ";" })
+                .compactMap { Double($0) }
+            return values.count == 4 ? (y: values[1], height: values[3]) : nil
+        }
+        return frames.sorted { $0.y < $1.y }.map { Int($0.height) }
+    }
+
+    private func makeGraph(_ view: ContentView) -> ViewGraph {
+        let graph = ViewGraph(rootViewType: ContentView.self, requestedOutputs: [.layout, .displayList])
+        graph.instantiateOutputs()
+        graph.setRootView(view)
+        graph.setProposedSize(CGSize(width: 100, height: 100))
+        return graph
+    }
+
+    @Test
+    func repeatedEvaluationWithSameMove() {
+        let old = [1, 2, 3, 4]
+        let new = [4, 1, 2, 3]
+        let difference = new.difference(from: old).inferringMoves()
+        let graph = makeGraph(ContentView(data: old, difference: old.difference(from: [])))
+        #expect(heights(of: graph) == old)
+
+        graph.setRootView(ContentView(data: new, difference: difference))
+        #expect(heights(of: graph) == new)
+
+        // The body is evaluated again with the same data and difference.
+        for _ in 0 ..< 3 {
+            graph.setRootView(ContentView(data: new, difference: difference))
+            #expect(heights(of: graph) == new)
+        }
+
+        // A new rotation produces a difference with the same offsets, which
+        // must still be applied.
+        let rotated = [3, 4, 1, 2]
+        let next = rotated.difference(from: new).inferringMoves()
+        #expect(ForEachChanges(next) == ForEachChanges(difference))
+        graph.setRootView(ContentView(data: rotated, difference: next))
+        #expect(heights(of: graph) == rotated)
+        graph.setRootView(ContentView(data: rotated, difference: next))
+        #expect(heights(of: graph) == rotated)
+    }
+
+    @Test
+    func repeatedEvaluationWithSameRemovalAndInsertion() {
+        let old = [10, 20, 30, 40]
+        let new = [10, 30, 40, 50]
+        let difference = new.difference(from: old)
+        let graph = makeGraph(ContentView(data: old, difference: old.difference(from: [])))
+        #expect(heights(of: graph) == old)
+
+        for _ in 0 ..< 3 {
+            graph.setRootView(ContentView(data: new, difference: difference))
+            #expect(heights(of: graph) == new)
+        }
+    }
+
+    @Test
+    func differenceThatDoesNotMatchTheItems() {
+        let old = [1, 2, 3]
+        let new = [3, 1, 2]
+        let graph = makeGraph(ContentView(data: old, difference: old.difference(from: [])))
+        #expect(heights(of: graph) == old)
+
+        // Describes removing the first element and inserting at the end,
+        // which has the right counts but not the right elements.
+        let wrong = [2, 3, 1].difference(from: old)
+        graph.setRootView(ContentView(data: new, difference: wrong))
+        #expect(heights(of: graph) == new)
+    }
+}
@@ -186,6 +186,100 @@ struct NamedImageCacheTests {
         let cache = NamedImage.sharedCache
         _ = cache // Access should not crash
     }
+
+    @Test
+    func byteBudget() {
+        let cache = NamedImage.Cache(byteLimit: 1 << 20)
+        #expect(cache.byteLimit == 1 << 20)
+        cache.byteLimit = -1
+        #expect(cache.byteLimit == 0)
+        #expect(cache.count == 0)
+        #expect(cache.byteCount == 0)
+        #expect(cache.pinnedByteCount == 0)
+    }
+
+    @Test
+    func missesAreCounted() {
+        let cache = NamedImage.Cache()
+        let key = NamedImage.Key.uuid(UUID())
+        _ = try? cache.decode(key)
+        #expect(cache.statistics.misses == 1)
+        #expect(cache.statistics.hits == 0)
+        // Only cached images can be pinned.
+        #expect(!cache.pin(key))
+        cache.unpin(key)
+        cache.handleMemoryPressure(.warning)
+        cache.handleMemoryPressure(.critical)
+        #expect(cache.count == 0)
+    }
+
+    #if canImport(CoreGraphics)
+    /// Resolves archived images to blank square bitmaps of known sizes.
+    private final class StubArchiveDelegate: AnyArchivedViewDelegate {
+        var sides: [UUID: Int] = [:]
+
+        var resolved: [UUID] = []
+
+        override func resolveImage(uuid: UUID) throws -> Image.ResolvedUUID {
+            guard let side = sides[uuid],
+                  let context = CGContext(
+                      data: nil,
+                      width: side,
+                      height: side,
+                      bitsPerComponent: 8,
+                      bytesPerRow: 0,
+                      space: CGColorSpaceCreateDeviceRGB(),
+                      bitmapInfo: CGImageAlphaInfo.premultipliedLast.rawValue
+                  ),
+                  let image = context.makeImage() else {
+                throw NamedImage.Errors.missingUUIDImage
+            }
+            resolved.append(uuid)
+            return Image.ResolvedUUID(cgImage: image, scale: 1, orientation: .up)
+        }
+    }
+
+    @Test
+    func archivedImagesAreBoundedByByteLimit() throws {
+        let delegate = StubArchiveDelegate()
+        let (a, b, c) = (UUID(), UUID(), UUID())
+        for uuid in [a, b, c] {
+            delegate.sides[uuid] = 16 // 1 KiB decoded
+        }
+        let cache = NamedImage.Cache(archiveDelegate: delegate, byteLimit: 3000)
+
+        _ = try cache.decode(.uuid(a))
+        _ = try cache.decode(.uuid(b))
+        #expect(cache.byteCount == 2048)
+        #expect(cache.count == 2)
+
+        // Using a makes b the least recently used image, evicted by c.
+        _ = try cache.decode(.uuid(a))
+        _ = try cache.decode(.uuid(c))
+        #expect(delegate.resolved == [a, b, c])
+        #expect(cache.byteCount == 2048)
+        _ = try cache.decode(.uuid(a))
+        _ = try cache.decode(.uuid(b))
+        #expect(delegate.resolved == [a, b, c, b])
+
+        // Critical pressure keeps only the pinned image.
+        #expect(cache.pin(.uuid(a)))
+        cache.handleMemoryPressure(.critical)
+        #expect(cache.count == 1)
+        #expect(cache.byteCount == 1024)
+        #expect(cache.pinnedByteCount == 1024)
+        _ = try cache.decode(.uuid(a))
+        #expect(delegate.resolved == [a, b, c, b])
+
+        // Once unpinned, it is evicted past the byte limit.
+        cache.byteLimit = 512
+        #expect(cache.count == 1)
+        cache.unpin(.uuid(a))
+        #expect(cache.count == 0)
+        #expect(cache.byteCount == 0)
+        #expect(cache.pinnedByteCount == 0)
+    }
+    #endif
 }
 
 // MARK: - NamedImageProvider Tests
@@ -0,0 +1,119 @@
+//
+//  PortableTextLayoutTests.swift
+//  OpenSwiftUICoreTests
+
+@testable import OpenSwiftUICore
+import Foundation
+import Testing
+#if canImport(UIFoundation_Private)
+import UIFoundation_Private
+#endif
+
+struct PortableTextLayoutTests {
+    private func lines(
+        _ string: String,
+        width: CGFloat,
+        height: CGFloat = .infinity,
+        lineLimit: Int? = nil,
+        lineBreakMode: NSLineBreakMode = .byWordWrapping
+    ) -> [String] {
+        let layout = PortableTextLayout(string: string, metrics: MonospaceTextGlyphMetrics.terminal)
+        let result = layout.layout(
+            in: CGSize(width: width, height: height),
+            lineLimit: lineLimit,
+            lineBreakMode: lineBreakMode
+        )
+        return result.lines.map { layout.string(of: $0) }
+    }
+
+    @Test
+    func wordWrapping() {
+        let layout = PortableTextLayout(string: "Hello world again", metrics: MonospaceTextGlyphMetrics.terminal)
+        let result = layout.layout(in: CGSize(width: 11, height: .infinity))
+        #expect(result.lines.map { layout.string(of: $0) } == ["Hello world ", "again"])
+        #expect(result.size == CGSize(width: 11, height: 2))
+        #expect(result.firstBaseline == 1)
+        #expect(result.lastBaseline == 2)
+        #expect(!result.hasTruncatedRanges)
+    }
+
+    @Test
+    func lineBreakOpportunities() {
+        // No breaks inside numbers or before closing punctuation.
+        #expect(lines("Wait, 3.14!", width: 8) == ["Wait, ", "3.14!"])
+        // Ideographs break between any two characters.
+        #expect(lines("日本語テキスト", width: 6) == ["日本語", "テキス", "ト"])
+        // Words wider than the line are broken between characters.
+        #expect(lines("abcdef", width: 4) == ["abcd", "ef"])
+        #expect(lines("a bc", width: 3, lineBreakMode: .byCharWrapping) == ["a b", "c"])
+        #expect(lines("one\ntwo", width: .infinity) == ["one", "two"])
+    }
+
+    @Test
+    func truncation() {
+        let string = "Hello world again"
+        #expect(lines(string, width: 8, lineLimit: 1, lineBreakMode: .byTruncatingTail) == ["Hello w\u{2026}"])
+        #expect(lines(string, width: 8, lineLimit: 1, lineBreakMode: .byTruncatingHead) == ["\u{2026}d again"])
+        #expect(lines(string, width: 8, lineLimit: 1, lineBreakMode: .byTruncatingMiddle) == ["Hel\u{2026}gain"])
+        #expect(lines(string, width: 8, lineLimit: 1, lineBreakMode: .byClipping) == ["Hello wo"])
+        #expect(lines("a b c", width: 1, height: 2, lineBreakMode: .byTruncatingTail) == ["a ", "\u{2026}"])
+        #expect(lines("one\ntwo", width: 10, lineLimit: 1, lineBreakMode: .byTruncatingTail) == ["one\u{2026}"])
+    }
+
+    @Test
+    func graphemeClusters() {
+        let layout = PortableTextLayout(string: "e\u{301}\u{1F1EF}\u{1F1F5}", metrics: MonospaceTextGlyphMetrics.terminal)
+        #expect(layout.count == 2)
+        #expect(layout.layout(in: CGSize(width: 10, height: 10)).size.width == 3)
+    }
+
+    @Test
+    func trueTypeMetrics() throws {
+        let metrics = try TrueTypeTextGlyphMetrics(data: Self.makeFont(), pointSize: 10)
+        #expect(metrics.glyph(for: 0x41) == 1)
+        #expect(metrics.glyph(for: 0x42) == 0)
+        #expect(metrics.advance(of: "A") == 6)
+        #expect(metrics.advance(of: "B") == 5)
+        #expect(metrics.ascender == 8)
+        #expect(metrics.descender == 2)
+        #expect(metrics.leading == 0)
+        #expect(throws: TrueTypeTextGlyphMetrics.Failure.missingTable("head")) {
+            try TrueTypeTextGlyphMetrics(data: Data([0, 1, 0, 0, 0, 0]), pointSize: 10)
+        }
+    }
+
+    /// A font with two glyphs, mapping "A" to glyph 1.
+    private static func makeFont() -> Data {
+        func uint16(_ value: UInt16) -> [UInt8] {
+            [UInt8(value >> 8), UInt8(value & 0xFF)]
+        }
+        func uint32(_ value: UInt32) -> [UInt8] {
+            uint16(UInt16(value >> 16)) + uint16(UInt16(value & 0xFFFF))
+        }
+        var head = [UInt8](repeating: 0, count: 54)
+        head.replaceSubrange(18 ..< 20, with: uint16(1000))
+        var hhea = [UInt8](repeating: 0, count: 36)
+        hhea.replaceSubrange(4 ..< 6, with: uint16(800))
+        hhea.replaceSubrange(6 ..< 8, with: uint16(UInt16(bitPattern: -200)))
+        hhea.replaceSubrange(34 ..< 36, with: uint16(2))
+        let hmtx = uint16(500) + uint16(0) + uint16(600) + uint16(0)
+        let format4 = uint16(4) + uint16(32) + uint16(0)
+            + uint16(4) + uint16(4) + uint16(1) + uint16(0)
+            + uint16(0x41) + uint16(0xFFFF) + uint16(0)
+            + uint16(0x41) + uint16(0xFFFF)
+            + uint16(UInt16(1) &- 0x41) + uint16(1)
+            + uint16(0) + uint16(0)
+        let cmap = uint16(0) + uint16(1) + uint16(3) + uint16(1) + uint32(12) + format4
+        let tables: [(String, [UInt8])] = [("cmap", cmap), ("head", head), ("hhea", hhea), ("hmtx", hmtx)]
+        var font = uint32(0x0001_0000) + uint16(UInt16(tables.count)) + uint16(0) + uint16(0) + uint16(0)
+        var offset = 12 + tables.count * 16
+        for (tag, table) in tables {
+            font += Array(tag.utf8) + uint32(0) + uint32(UInt32(offset)) + uint32(UInt32(table.count))
+            offset += table.count
+        }
+        for (_, table) in tables {
+            font += table
+        }
+        return Data(font)
+    }
+}
@@ -0,0 +1,156 @@
+//
+//  TextMetricsCacheTests.swift
+//  OpenSwiftUICoreTests
+
+@testable import OpenSwiftUICore
+import Foundation
+import Testing
+import UIFoundation_Private
+#if canImport(CoreText)
+import CoreText
+#endif
+
+struct TextMetricsCacheTests {
+    private func metrics(width: CGFloat) -> NSAttributedString.Metrics {
+        NSAttributedString.Metrics(
+            size: CGSize(width: width, height: 10),
+            scale: 1,
+            firstBaseline: 8,
+            lastBaseline: 8,
+            baselineAdjustment: 0,
+            requestedWidth: width,
+            numberOfLines: nil,
+            hasTruncatedRanges: false
+        )
+    }
+
+    private func key(for string: NSAttributedString, width: CGFloat = 100) -> TextMetricsCache.Key {
+        TextMetricsCache.Key(
+            contentHash: string.contentHash,
+            width: width,
+            height: .infinity,
+            lineLimit: nil,
+            lowerLineLimit: nil,
+            minScaleFactor: 1,
+            bodyHeadOutdent: 0,
+            widthIsFlexible: false,
+            isCollapsible: false,
+            wantsNumberOfLineFragments: false
+        )
+    }
+
+    @Test
+    func sharedBetweenEqualStrings() {
+        let cache = TextMetricsCache()
+        var measureCount = 0
+        for _ in 0 ..< 3 {
+            let string = NSAttributedString(string: "Label")
+            let result = cache.metrics(for: key(for: string), string: string) {
+                measureCount += 1
+                return metrics(width: 42)
+            }
+            #expect(result == metrics(width: 42))
+        }
+        #expect(measureCount == 1)
+        var expected = TextMetricsCache.Statistics()
+        expected.hits = 2
+        expected.misses = 1
+        #expect(cache.statistics == expected)
+
+        // Another width is another measurement.
+        let string = NSAttributedString(string: "Label")
+        _ = cache.metrics(for: key(for: string, width: 50), string: string) {
+            measureCount += 1
+            return metrics(width: 50)
+        }
+        #expect(measureCount == 2)
+        #expect(cache.count == 2)
+
+        cache.reset()
+        #expect(cache.count == 0)
+        #expect(cache.byteCount == 0)
+        #expect(cache.statistics == .init())
+    }
+
+    @Test
+    func hitRequiresEqualString() {
+        let cache = TextMetricsCache()
+        let first = NSAttributedString(string: "First")
+        let second = NSAttributedString(string: "Second")
+        _ = cache.metrics(for: key(for: first), string: first) { metrics(width: 1) }
+        // A colliding key must not return the metrics of other text.
+        let result = cache.metrics(for: key(for: first), string: second) { metrics(width: 2) }
+        #expect(result == metrics(width: 2))
+        #expect(cache.statistics.misses == 2)
+    }
+
+    @Test
+    func contentHash() {
+        let plain = NSAttributedString(string: "Text")
+        let styled = NSAttributedString(string: "Text", attributes: [.init("Attribute"): 1])
+        #expect(plain.contentHash == NSAttributedString(string: "Text").contentHash)
+        #expect(plain.contentHash != styled.contentHash)
+        #expect(plain.contentHash != NSAttributedString(string: "Text!").contentHash)
+    }
+
+    @Test
+    func contentHashOfEqualStyledStrings() {
+        func styled(lineSpacing: CGFloat) -> NSAttributedString {
+            let style = NSMutableParagraphStyle()
+            style.lineBreakMode = .byTruncatingTail
+            style.lineSpacing = lineSpacing
+            var attributes: [NSAttributedString.Key: Any] = [
+                .kitParagraphStyle: style,
+                .init("Attribute"): NSNumber(value: 1),
+            ]
+            #if canImport(CoreText)
+            attributes[.kitFont] = CTFontCreateWithName("Helvetica" as CFString, 17, nil)
+            #endif
+            let string = NSMutableAttributedString(string: "Styled ")
+            string.append(NSAttributedString(string: "text", attributes: attributes))
+            return string
+        }
+        // Separately built attribute objects of equal strings hash alike.
+        #expect(styled(lineSpacing: 2).contentHash == styled(lineSpacing: 2).contentHash)
+        #expect(styled(lineSpacing: 2).contentHash != styled(lineSpacing: 3).contentHash)
+
+        let cache = TextMetricsCache()
+        var measureCount = 0
+        for _ in 0 ..< 2 {
+            let string = styled(lineSpacing: 2)
+            _ = cache.metrics(for: key(for: string), string: string) {
+                measureCount += 1
+                return metrics(width: 42)
+            }
+        }
+        #expect(measureCount == 1)
+    }
+
+    @Test
+    func leastRecentlyUsedEviction() {
+        let strings = ["a", "b", "c"].map { NSAttributedString(string: $0) }
+        // Each entry costs 258 bytes, so two entries fit.
+        let cache = TextMetricsCache(byteLimit: 600)
+        var measureCount = 0
+        func lookUp(_ index: Int) {
+            _ = cache.metrics(for: key(for: strings[index]), string: strings[index]) {
+                measureCount += 1
+                return metrics(width: CGFloat(index))
+            }
+        }
+        lookUp(0)
+        lookUp(1)
+        lookUp(0)
+        lookUp(2) // Evicts 1, the least recently used entry
+        #expect(cache.statistics.evictions == 1)
+        #expect(cache.count == 2)
+        #expect(cache.byteCount == 516)
+        lookUp(0)
+        #expect(measureCount == 3)
+        lookUp(1)
+        #expect(measureCount == 4)
+
+        cache.byteLimit = 300
+        #expect(cache.count == 1)
+    }
+}
@@ -2,10 +2,11 @@
 //  MovableLockTests.swift
 //  OpenSwiftUI_SPITests
 
+import Foundation
 import OpenSwiftUI_SPI
 import Testing
 
-#if canImport(Darwin)
+#if canImport(Darwin) || os(Linux)
 final class MovableLockTests {
     let lock: MovableLock
 
@@ -28,5 +29,33 @@ final class MovableLockTests {
         #expect(lock.isOwner == false)
         #expect(lock.isOutermostOwner == false)
     }
+
+    @Test
+    func recursiveOwner() {
+        lock.lock()
+        lock.lock()
+        #expect(lock.isOwner == true)
+        #expect(lock.isOutermostOwner == false)
+        lock.unlock()
+        #expect(lock.isOutermostOwner == true)
+        lock.unlock()
+        #expect(lock.isOwner == false)
+    }
+
+    @Test
+    func contention() {
+        let lock = lock
+        let iterations = 1_000
+        nonisolated(unsafe) var counter = 0
+        DispatchQueue.concurrentPerform(iterations: 4) { _ in
+            for _ in 0 ..< iterations {
+                lock.lock()
+                #expect(lock.isOwner == true)
+                counter += 1
+                lock.unlock()
+            }
+        }
+        #expect(counter == 4 * iterations)
+    }
 }
 #endif
@@ -0,0 +1,85 @@
+//
+//  PathStringTests.swift
+//  OpenSwiftUI_SPITests
+
+import OpenSwiftUI_SPI
+import Testing
+
+struct PathStringTests {
+    /// Parses a path string and describes the parsed elements.
+    private func roundTrip(_ string: String, step: Double = 0) -> String? {
+        var description = PathDescription(step: step)
+        defer { description.destroy() }
+        let parsed = withUnsafeMutablePointer(to: &description) { pointer in
+            _PathParseString(string, pointer) { info, element, points in
+                let description = info!.assumingMemoryBound(to: PathDescription.self)
+                description.pointee.append(element: element, points: points)
+                return true
+            }
+        }
+        guard parsed else {
+            return nil
+        }
+        return String(cString: description.cString())
+    }
+
+    @Test(arguments: [
+        ("100 0 m 200 100 l h", " 100 0 m 200 100 l h"),
+        ("0 0 m 50 0 100 100 q", " 0 0 m 50 0 100 100 q"),
+        ("0 0 m 25 0 75 100 100 100 c", " 0 0 m 25 0 75 100 100 100 c"),
+        // t reflects the previous control point
+        ("0 0 m 10 10 20 0 q 40 0 t", " 0 0 m 10 10 20 0 q 30 -10 40 0 q"),
+        // v starts at the current point
+        ("0 0 m 50 50 100 100 v", " 0 0 m 0 0 50 50 100 100 c"),
+        // y ends at the second control point
+        ("0 0 m 25 0 100 100 y", " 0 0 m 25 0 100 100 100 100 c"),
+        ("10 20 30 40 re", " 10 20 m 40 20 l 40 60 l 10 60 l h"),
+        ("-10 -20 m 30 40 l", " -10 -20 m 30 40 l"),
+        ("0.5 1.5 m 2.5 3.5 l", " 0.5 1.5 m 2.5 3.5 l"),
+        ("1e2 -2.5e-1 m 0x1p3 12345678.9 l", " 100 -0.25 m 8 1.23457e+07 l"),
+        ("0\t0\nm\n100\t100\tl", " 0 0 m 100 100 l"),
+    ])
+    func parse(input: String, expected: String) {
+        #expect(roundTrip(input) == expected)
+    }
+
+    @Test(arguments: ["0 0 z", "0 m", "1 2 3 4 5 6 7 m", "0 0 1 1 r", "0 0 m 1 1 l \u{1}"])
+    func parseMalformed(input: String) {
+        #expect(roundTrip(input) == nil)
+    }
+
+    @Test
+    func stopParsing() {
+        var count = 0
+        let parsed = _PathParseString("0 0 m 1 1 l 2 2 l", &count) { info, _, _ in
+            let count = info!.assumingMemoryBound(to: Int.self)
+            count.pointee += 1
+            return count.pointee < 2
+        }
+        #expect(!parsed)
+        #expect(count == 2)
+    }
+
+    @Test(arguments: [
+        (0.0, " 100 0 m 189.5 189.5 l 0 189.5 l h"),
+        (1.0, " 100 0 m 190 190 l 0 190 l h"),
+        (0.25, " 100 0 m 189.5 189.5 l 0 189.5 l h"),
+        (10.0, " 100 0 m 190 190 l 0 190 l h"),
+    ])
+    func describeWithStep(step: Double, expected: String) {
+        #expect(roundTrip("100 0 m 189.5 189.5 l 0 189.5 l h", step: step) == expected)
+    }
+
+    @Test
+    func exactNumbers() {
+        for number in ["0.1", "3.14159", "123456789012345678", "9007199254740993", "1e23", "2.2250738585072014e-308"] {
+            var value = 0.0
+            let parsed = _PathParseString("\(number) 0 m", &value) { info, _, points in
+                info!.assumingMemoryBound(to: Double.self).pointee = points[0]
+                return true
+            }
+            #expect(parsed)
+            #expect(value == Double(number)!)
+        }
+    }
+}